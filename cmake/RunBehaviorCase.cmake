@@ -71,6 +71,7 @@ set(CASE_EXPECT_COMPILE_FILE "${CASE_DIR}/expect.compile")
 set(CASE_EXPECT_STDOUT_FILE "${CASE_DIR}/expect.stdout")
 set(CASE_EXPECT_DIAGNOSTICS_FILE "${CASE_DIR}/expect.diagnostics")
 set(CASE_EXPECT_LL_FILE "${CASE_DIR}/expect.ll")
+set(CASE_COMPILE_ARGS_FILE "${CASE_DIR}/compile.args")
 
 if(DEFINED EXPECT_COMPILE)
     set(expected_compile "${EXPECT_COMPILE}")
@@ -99,10 +100,29 @@ endif()
 file(REMOVE_RECURSE "${CASE_OUTPUT_DIR}")
 file(MAKE_DIRECTORY "${CASE_OUTPUT_DIR}")
 
+set(case_emit_arg "--emit=exe")
+if(EXISTS "${CASE_EXPECT_LL_FILE}")
+    set(case_emit_arg "--emit=exe,ll")
+endif()
+
+# Cases that need other compiler options list them one per line in `compile.args`.
+set(case_compile_args "")
+if(EXISTS "${CASE_COMPILE_ARGS_FILE}")
+    file(STRINGS "${CASE_COMPILE_ARGS_FILE}" case_compile_args)
+endif()
+
+# With `ACE_COMPILE_SERVER` set to the socket of a running `ace --daemon`, cases are compiled by
+# that server instead of a fresh compiler process.
+set(case_server_args "")
+if(DEFINED ENV{ACE_COMPILE_SERVER})
+    set(case_server_args "--connect=$ENV{ACE_COMPILE_SERVER}")
+endif()
+
 execute_process(
     COMMAND "${CMAKE_COMMAND}" -E env
         "PATH=${ACE_TEST_PATH}"
-        "${ACE_BINARY}" "-o${CASE_OUTPUT_DIR}" "${CASE_PACKAGE_PATH}"
+        "${ACE_BINARY}" ${case_server_args}
+        "-o${CASE_OUTPUT_DIR}" "${case_emit_arg}" ${case_compile_args} "${CASE_PACKAGE_PATH}"
     WORKING_DIRECTORY "${SOURCE_DIR}"
     RESULT_VARIABLE compile_result
     OUTPUT_VARIABLE compile_stdout
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <optional>
 
 namespace Ace::AnonymousIdent
 {
@@ -22,10 +23,32 @@ namespace Ace::AnonymousIdent
 
     auto Create() -> std::string;
 
+    // Restarts numbering, so each compilation in a process gets the same identifiers.
+    auto ResetCounter() -> void;
+
     template <typename... Args>
     auto Create(const std::string& first, const Args&... rest) -> std::string
     {
         return Create() + "_" + Concat(first, rest...);
     }
 
+    // While alive, `Create` on this thread numbers identifiers after `optPrefix` with a counter
+    // of its own, so they do not depend on what other threads create. Without a prefix, it
+    // restores the process-wide counter until it is destroyed.
+    class PrefixScope
+    {
+    public:
+        PrefixScope(std::optional<std::string> optPrefix);
+        PrefixScope(const PrefixScope&) = delete;
+        ~PrefixScope();
+
+        auto operator=(const PrefixScope&) -> PrefixScope& = delete;
+
+        auto CreateLocal() -> std::optional<std::string>;
+
+    private:
+        std::optional<std::string> m_OptPrefix{};
+        size_t m_Counter{};
+        PrefixScope* m_OuterScope{};
+    };
 }
@@ -12,7 +12,7 @@
 
 namespace Ace::Application
 {
-    auto CollectSyntaxes(const std::shared_ptr<const ISyntax>& ast) -> std::vector<const ISyntax*>;
+    auto CollectSyntaxes(const ISyntax* const ast) -> std::vector<const ISyntax*>;
 
     auto CreateAndDeclareSymbols(const std::vector<const ISyntax*>& syntaxes)
         -> Diagnosed<std::vector<FunctionBlockBinding>>;
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <optional>
+
+#include "SrcLocation.hpp"
+#include "Scope.hpp"
+#include "Symbols/Symbol.hpp"
+
+namespace Ace
+{
+    class IGenericSymbol;
+
+    // A generic instance that a speculative binding needed, but was not allowed to create.
+    struct InstantiationRequest
+    {
+        SrcLocation SrcLocation{};
+        IGenericSymbol* Root{};
+        InstantiationContext Context{};
+    };
+
+    // Thrown out of a speculative binding that would change state other bindings read.
+    struct SpeculationAbort
+    {
+        std::optional<InstantiationRequest> OptInstantiationRequest{};
+    };
+
+    // Function bodies are first bound speculatively, on up to `-j` threads at once. A speculative
+    // binding may only change the scopes below its function's body scope, which no other
+    // binding reads. Instantiating a generic, declaring a symbol or creating a scope anywhere
+    // else throws a `SpeculationAbort` instead. The binding then rolls back the symbols it
+    // declared, and the main thread creates the requested instance or binds the body itself.
+    class BindingSpeculation
+    {
+    public:
+        BindingSpeculation(const std::shared_ptr<Scope>& bodyScope);
+        BindingSpeculation(const BindingSpeculation&) = delete;
+        ~BindingSpeculation();
+
+        auto operator=(const BindingSpeculation&) -> BindingSpeculation& = delete;
+
+        static auto OnInstantiate(
+            const SrcLocation& srcLocation,
+            IGenericSymbol* const root,
+            const InstantiationContext& context
+        ) -> void;
+        static auto OnDeclareSymbol(ISymbol* const symbol) -> void;
+        static auto OnCreateChild(const Scope* const scope) -> void;
+
+        // Removes the declared symbols, newest first. Scopes created by the binding are owned by
+        // its semas and go away with them.
+        auto Rollback() -> void;
+
+    private:
+        auto IsOwnScope(const Scope* const scope) const -> bool;
+
+        std::shared_ptr<Scope> m_BodyScope{};
+        std::vector<ISymbol*> m_DeclaredSymbols{};
+    };
+}
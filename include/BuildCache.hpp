@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <filesystem>
+
+#include "Compilation.hpp"
+
+namespace Ace::BuildCache
+{
+    // Combines values into one hash. Strings are hashed with their length, so adjacent strings
+    // cannot run into each other.
+    class Hasher
+    {
+    public:
+        auto Add(const std::string_view string) -> void;
+        auto AddValue(const uint64_t value) -> void;
+        auto Finish() const -> uint64_t;
+
+    private:
+        std::string m_Hashes{};
+    };
+
+    // Hash of everything a compilation reads: the compiler binary, the command line, the package
+    // file and every source file.
+    auto CreateInputHash(const Compilation* const compilation) -> uint64_t;
+
+    // A compilation is up to date when the last clean compilation into the same output directory
+    // had the same input hash and all requested artifacts still exist.
+    auto IsUpToDate(const Compilation* const compilation, const uint64_t inputHash) -> bool;
+    auto StoreInputHash(const Compilation* const compilation, const uint64_t inputHash) -> void;
+
+    // Object files are cached per codegen unit under `unitName`, keyed by a hash of the unit's
+    // unoptimized module and the codegen settings.
+    auto TryRestoreObjectFile(
+        const Compilation* const compilation,
+        const std::string& unitName,
+        const uint64_t moduleHash,
+        const std::filesystem::path& objectFilePath
+    ) -> bool;
+    auto StoreObjectFile(
+        const Compilation* const compilation,
+        const std::string& unitName,
+        const uint64_t moduleHash,
+        const std::filesystem::path& objectFilePath
+    ) -> void;
+}
@@ -24,6 +24,8 @@ namespace Ace
         auto GetBuffer() const -> const std::string& final;
 
         auto FormatLocation(const SrcLocation& location) const -> std::string final;
+        auto FindLine(const std::string_view::const_iterator characterIt) const
+            -> std::string_view final;
 
         auto GetArgs() const -> const std::vector<std::string_view>&;
 
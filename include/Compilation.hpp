@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <vector>
+#include <set>
 #include <string_view>
 #include <filesystem>
 
@@ -13,11 +14,31 @@
 #include "Scope.hpp"
 #include "Natives.hpp"
 #include "ErrorSymbols.hpp"
+#include "TimeTrace.hpp"
 
 namespace Ace
 {
     class ITypeSymbol;
 
+    enum class OptimizationLevel
+    {
+        O0,
+        O1,
+        O2,
+        O3,
+        Os,
+    };
+
+    enum class ArtifactKind
+    {
+        Exe,
+        Obj,
+        Bc,
+        Ll,
+        OptLl,
+        Sema,
+    };
+
     class Compilation
     {
     public:
@@ -31,6 +52,14 @@ namespace Ace
         auto GetPackageFileBuffer() const -> const FileBuffer*;
         auto GetPackage() const -> const Package&;
         auto GetOutputPath() const -> const std::filesystem::path&;
+        auto GetJobCount() const -> size_t;
+        auto GetOptimizationLevel() const -> OptimizationLevel;
+        auto GetCodegenUnitCount() const -> size_t;
+        auto IsSplittingCodegenUnitsByFile() const -> bool;
+        auto IsEmitting(const ArtifactKind artifactKind) const -> bool;
+        auto CreateArtifactPath(const ArtifactKind artifactKind) const -> std::filesystem::path;
+        auto IsUsingBuildCache() const -> bool;
+        auto GetTimeTracer() const -> TimeTracer*;
 
         auto GetGlobalScope() const -> const std::shared_ptr<Scope>&;
         auto GetPackageBodyScope() const -> const std::shared_ptr<Scope>&;
@@ -45,6 +74,13 @@ namespace Ace
         const FileBuffer* m_PackageFileBuffer{};
         Package m_Package{};
         std::filesystem::path m_OutputPath{};
+        size_t m_JobCount = 1;
+        OptimizationLevel m_OptimizationLevel = OptimizationLevel::O3;
+        size_t m_CodegenUnitCount = 1;
+        bool m_IsSplittingCodegenUnitsByFile{};
+        std::set<ArtifactKind> m_ArtifactKinds{};
+        bool m_IsUsingBuildCache = true;
+        std::unique_ptr<TimeTracer> m_TimeTracer{};
 
         GlobalScope m_GlobalScope{};
         std::shared_ptr<Scope> m_PackageBodyScope{};
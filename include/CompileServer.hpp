@@ -0,0 +1,29 @@
+#pragma once
+
+#include <vector>
+#include <string_view>
+#include <filesystem>
+#include <functional>
+
+#include "Diagnostic.hpp"
+
+namespace Ace::CompileServer
+{
+    // Compiles one request and returns its process exit code. Output goes to `std::cout` and
+    // `std::cerr`, which the server points at the client's own stdout and stderr.
+    using CompileFunction = std::function<int(const std::vector<std::string_view>& args)>;
+
+    // Accepts clients on a Unix domain socket and compiles their requests one at a time, from the
+    // client's working directory and with the client's environment. The socket is only accessible
+    // to the server's user, and clients of other users are rejected. Only returns when the socket
+    // cannot be set up.
+    auto Serve(const std::filesystem::path& socketPath, const CompileFunction& compile)
+        -> Expected<void>;
+
+    // Forwards `args` together with this process's working directory, environment, stdout and
+    // stderr to the server, then waits for the exit code of the compilation.
+    auto Connect(
+        const std::filesystem::path& socketPath,
+        const std::vector<std::string_view>& args
+    ) -> Expected<int>;
+}
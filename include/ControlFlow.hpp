@@ -1,6 +1,8 @@
 #pragma once
 
 #include <vector>
+#include <unordered_map>
+#include <cstddef>
 
 #include "Symbols/LabelSymbol.hpp"
 
@@ -21,8 +23,32 @@ namespace Ace
         LabelSymbol* LabelSymbol{};
     };
 
-    struct ControlFlowGraph
+    // A run of instructions that is only entered at its first instruction and only left after
+    // its last one. Successor indices refer to `ControlFlowGraph::GetBlocks()`, where the index
+    // one past the last block stands for falling off the end of the function.
+    struct ControlFlowBlock
     {
-        std::vector<ControlFlowInstruction> Instructions{};
+        size_t BeginInstructionIndex{};
+        size_t EndInstructionIndex{};
+        std::vector<size_t> SuccessorIndices{};
+    };
+
+    class ControlFlowGraph
+    {
+    public:
+        ControlFlowGraph(std::vector<ControlFlowInstruction> instructions);
+        ~ControlFlowGraph() = default;
+
+        auto GetInstructions() const -> const std::vector<ControlFlowInstruction>&;
+        auto GetBlocks() const -> const std::vector<ControlFlowBlock>&;
+        auto GetEndBlockIndex() const -> size_t;
+
+    private:
+        auto CreateBlocks() -> void;
+        auto LinkBlocks() -> void;
+
+        std::vector<ControlFlowInstruction> m_Instructions{};
+        std::vector<ControlFlowBlock> m_Blocks{};
+        std::unordered_map<LabelSymbol*, size_t> m_LabelToBlockIndexMap{};
     };
 }
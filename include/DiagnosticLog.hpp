@@ -5,4 +5,7 @@
 namespace Ace
 {
     auto LogDiagnosticGroup(const DiagnosticGroup& diagnosticGroup) -> void;
+
+    // Forgets groups logged so far, so the next group is not separated from earlier output.
+    auto ResetDiagnosticLog() -> void;
 }
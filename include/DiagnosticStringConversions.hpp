@@ -22,7 +22,7 @@ namespace Ace
 
     auto CreateSymbolCategoryStringWithArticle(const SymbolCategory symbolCategory) -> std::string;
 
-    auto CreateOpString(const Token& opToken) -> std::string;
+    auto CreateOpString(const TokenView& opToken) -> std::string;
 
     template <typename TSymbol> inline auto CreateSymbolTypeStringWithArticle() -> std::string
     {
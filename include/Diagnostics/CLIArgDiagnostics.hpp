@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <string_view>
 
 #include "Diagnostic.hpp"
 #include "SrcLocation.hpp"
@@ -14,4 +15,8 @@ namespace Ace
     auto CreateMissingCLIOptionValueError(const SrcLocation& srcLocation) -> DiagnosticGroup;
 
     auto CreateUnexpectedCLIOptionValueError(const SrcLocation& srcLocation) -> DiagnosticGroup;
+
+    auto CreateInvalidCLIOptionValueError(
+        const SrcLocation& srcLocation, const std::string_view expectedValue
+    ) -> DiagnosticGroup;
 }
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <string>
+#include <filesystem>
+
+#include "Diagnostic.hpp"
+
+namespace Ace
+{
+    auto CreateCompileServerListenError(
+        const std::filesystem::path& socketPath, const std::string& message
+    ) -> DiagnosticGroup;
+
+    auto CreateCompileServerConnectError(
+        const std::filesystem::path& socketPath, const std::string& message
+    ) -> DiagnosticGroup;
+
+    auto CreateCompileServerDisconnectedError(const std::filesystem::path& socketPath)
+        -> DiagnosticGroup;
+}
@@ -1,9 +1,21 @@
 #pragma once
 
+#include <string>
+#include <filesystem>
+
 #include "Symbols/All.hpp"
 #include "Diagnostic.hpp"
 
 namespace Ace
 {
     auto CreateMissingFunctionBlockError(FunctionSymbol* const functionSymbol) -> DiagnosticGroup;
+
+    auto CreateUnsupportedTargetError(const std::string& triple, const std::string& message)
+        -> DiagnosticGroup;
+
+    auto CreateUnsupportedObjectEmissionError(const std::string& triple) -> DiagnosticGroup;
+
+    auto CreateOutputFileOpenError(
+        const std::filesystem::path& path, const std::string& message
+    ) -> DiagnosticGroup;
 }
@@ -6,16 +6,18 @@
 
 namespace Ace
 {
-    auto CreateUnexpectedTokenError(const Token& unexpectedToken) -> DiagnosticGroup;
+    auto CreateUnexpectedTokenError(const TokenView& unexpectedToken) -> DiagnosticGroup;
 
-    auto CreateUnexpectedTokenError(const Token& unexpectedToken, const TokenKind expectedTokenKind)
-        -> DiagnosticGroup;
+    auto CreateUnexpectedTokenError(
+        const TokenView& unexpectedToken, const TokenKind expectedTokenKind
+    ) -> DiagnosticGroup;
 
-    auto CreateUnexpectedTokenExpectedLiteralError(const Token& unexpectedToken) -> DiagnosticGroup;
+    auto CreateUnexpectedTokenExpectedLiteralError(const TokenView& unexpectedToken)
+        -> DiagnosticGroup;
 
-    auto CreateUnexpectedTokenExpectedNewError(const Token& unexpectedToken) -> DiagnosticGroup;
+    auto CreateUnexpectedTokenExpectedNewError(const TokenView& unexpectedToken) -> DiagnosticGroup;
 
-    auto CreateUnexpectedTokenExpectedCompoundAssignmentOpError(const Token& unexpectedToken)
+    auto CreateUnexpectedTokenExpectedCompoundAssignmentOpError(const TokenView& unexpectedToken)
         -> DiagnosticGroup;
 
     auto CreateExpectedTraitError(const SrcLocation& srcLocation) -> DiagnosticGroup;
@@ -24,19 +26,19 @@ namespace Ace
 
     auto CreateEmptyTypeArgsError(const SrcLocation& srcLocation) -> DiagnosticGroup;
 
-    auto CreateExternInstanceFunctionError(const Token& externKeywordToken) -> DiagnosticGroup;
+    auto CreateExternInstanceFunctionError(const TokenView& externKeywordToken) -> DiagnosticGroup;
 
-    auto CreateUnknownModifierError(const Token& modifierToken) -> DiagnosticGroup;
+    auto CreateUnknownModifierError(const TokenView& modifierToken) -> DiagnosticGroup;
 
-    auto CreateForbiddenModifierError(const Token& modifierToken) -> DiagnosticGroup;
+    auto CreateForbiddenModifierError(const TokenView& modifierToken) -> DiagnosticGroup;
 
-    auto CreateEmptyModifiersError(const Token& colonColonToken) -> DiagnosticGroup;
+    auto CreateEmptyModifiersError(const TokenView& colonColonToken) -> DiagnosticGroup;
 
     auto CreateMissingTokenError(
         const SrcLocation& lastTokenSrcLocation, const TokenKind expectedTokenKind
     ) -> DiagnosticGroup;
 
-    auto CreateMissingSelfModifierAfterStrongPtrError(const Token& strongPtrModifierToken)
+    auto CreateMissingSelfModifierAfterStrongPtrError(const TokenView& strongPtrModifierToken)
         -> DiagnosticGroup;
 
     auto CreateUnconstrainedTypeParamError(const SrcLocation& srcLocation) -> DiagnosticGroup;
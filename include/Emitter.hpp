@@ -2,6 +2,8 @@
 
 #include <memory>
 #include <vector>
+#include <map>
+#include <string>
 #include <string_view>
 #include <chrono>
 
@@ -182,9 +184,6 @@ namespace Ace
 
         auto GetDropGluePtr(ITypeSymbol* const typeSymbol) const -> llvm::Constant*;
 
-        auto CreateOutputFilePath(const std::string_view name, const std::string_view extension)
-            -> std::filesystem::path;
-
         Compilation* m_Compilation{};
 
         llvm::LLVMContext m_Context{};
@@ -197,6 +196,7 @@ namespace Ace
         std::map<const ITypeSymbol*, llvm::Type*> m_TypeMap{};
         std::map<const GlobalVarSymbol*, llvm::Constant*> m_GlobalVarMap{};
         std::map<const FunctionSymbol*, llvm::Function*> m_FunctionMap{};
+        std::map<std::string, llvm::GlobalVariable*, std::less<>> m_StringMap{};
 
         std::map<const IVarSymbol*, llvm::Value*> m_LocalVarMap{};
         LabelBlockMap m_LabelBlockMap;
@@ -5,6 +5,8 @@
 #include <string>
 #include <string_view>
 #include <filesystem>
+#include <atomic>
+#include <cstddef>
 
 #include "SrcBuffer.hpp"
 #include "Diagnostic.hpp"
@@ -22,11 +24,11 @@ namespace Ace
     public:
         FileBuffer() = default;
         FileBuffer(const FileBuffer&) = delete;
-        FileBuffer(FileBuffer&&) = default;
+        FileBuffer(FileBuffer&&) = delete;
         ~FileBuffer() = default;
 
         auto operator=(const FileBuffer&) -> FileBuffer& = delete;
-        auto operator=(FileBuffer&&) -> FileBuffer& = default;
+        auto operator=(FileBuffer&&) -> FileBuffer& = delete;
 
         static auto Read(Compilation* const compilation, const std::filesystem::path& path)
             -> Expected<std::shared_ptr<const FileBuffer>>;
@@ -41,9 +43,12 @@ namespace Ace
         auto GetBuffer() const -> const std::string& final;
 
         auto FormatLocation(const SrcLocation& location) const -> std::string final;
+        auto FindLine(const std::string_view::const_iterator characterIt) const
+            -> std::string_view final;
 
         auto GetPath() const -> const std::filesystem::path&;
-        auto GetLines() const -> const std::vector<std::string_view>&;
+        auto GetLineCount() const -> size_t;
+        auto GetLine(const size_t lineIndex) const -> std::string_view;
         auto GetOrigin() const -> SourceOrigin;
 
         auto CreateFirstLocation() const -> SrcLocation;
@@ -53,7 +58,6 @@ namespace Ace
             Compilation* const compilation,
             const std::filesystem::path& path,
             std::string&& buffer,
-            std::vector<std::string_view>&& lines,
             const SourceOrigin origin
         );
 
@@ -65,7 +69,11 @@ namespace Ace
         Compilation* m_Compilation{};
         std::filesystem::path m_Path{};
         std::string m_Buffer{};
-        std::vector<std::string_view> m_Lines{};
+        // Offset of the first character of each line; a trailing newline does not start a line.
+        std::vector<size_t> m_LineBeginIndices{};
+        // Line of the last lookup. Diagnostics format and render the same location back to back,
+        // so checking it first usually skips the binary search.
+        mutable std::atomic<size_t> m_LastLineIndex{};
         SourceOrigin m_Origin{};
     };
 }
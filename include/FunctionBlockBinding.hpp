@@ -12,10 +12,10 @@ namespace Ace
     {
         FunctionBlockBinding(
             FunctionSymbol* const symbol,
-            const std::optional<std::shared_ptr<const BlockStmtSyntax>>& optBlockSyntax
+            const std::optional<const BlockStmtSyntax*>& optBlockSyntax
         );
 
         FunctionSymbol* Symbol{};
-        std::optional<std::shared_ptr<const BlockStmtSyntax>> OptBlockSyntax{};
+        std::optional<const BlockStmtSyntax*> OptBlockSyntax{};
     };
 }
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <vector>
+#include <optional>
+#include <cstddef>
+
+namespace Ace
+{
+    class ISymbol;
+    class ITypeSymbol;
+    class IGenericSymbol;
+
+    // Identifies a generic instance by its root and unaliased type args. The self type is only
+    // part of the key for prototypes, whose instances differ per implementing type.
+    struct GenericInstanceKey
+    {
+        auto operator==(const GenericInstanceKey& other) const -> bool = default;
+
+        const IGenericSymbol* Root{};
+        std::vector<const ISymbol*> TypeArgs{};
+        const ISymbol* SelfType{};
+    };
+
+    struct GenericInstanceKeyHash
+    {
+        auto operator()(const GenericInstanceKey& key) const -> size_t;
+    };
+
+    // Returns `std::nullopt` for a prototype without a self type, which no instance matches.
+    auto CreateGenericInstanceKey(
+        const IGenericSymbol* const root,
+        const std::vector<ITypeSymbol*>& typeArgs,
+        const std::optional<ITypeSymbol*>& optSelfType
+    ) -> std::optional<GenericInstanceKey>;
+}
@@ -4,10 +4,13 @@
 #include <map>
 #include <set>
 #include <unordered_map>
+#include <optional>
 
 #include "SrcLocation.hpp"
 #include "Diagnostic.hpp"
 #include "FunctionBlockBinding.hpp"
+#include "InternedString.hpp"
+#include "GenericInstanceKey.hpp"
 
 namespace Ace
 {
@@ -29,6 +32,12 @@ namespace Ace
             const InstantiationContext& context
         ) -> Expected<ISymbol*>;
         static auto OnSymbolDeclared(ISymbol* const symbol) -> void;
+        static auto OnSymbolRemoved(ISymbol* const symbol) -> void;
+        static auto FindInstance(
+            const IGenericSymbol* const root,
+            const std::vector<ITypeSymbol*>& typeArgs,
+            const std::optional<ITypeSymbol*>& optSelfType
+        ) -> std::optional<ISymbol*>;
         static auto GetGenericRoot(const IGenericSymbol* const instance) -> IGenericSymbol*;
 
         auto InstantiateBodies(const std::vector<FunctionBlockBinding>& functionBlockBindings)
@@ -51,10 +60,16 @@ namespace Ace
         auto CollectAndClearDeferredInstances() -> std::vector<IGenericSymbol*>;
         auto CollectAndClearReferencedMonosInstances() -> std::vector<IGenericSymbol*>;
 
+        auto FindRoot(const IGenericSymbol* const generic) const -> const IGenericSymbol*;
+        auto CreateInstanceKey(const IGenericSymbol* const instance) const
+            -> GenericInstanceKey;
+
         Scope* m_Scope{};
 
-        std::unordered_map<std::string, IGenericSymbol*> m_NameToRootMap{};
+        std::unordered_map<InternedString, IGenericSymbol*> m_NameToRootMap{};
         std::map<IGenericSymbol*, std::vector<IGenericSymbol*>> m_RootToMonosMap{};
+        std::unordered_map<GenericInstanceKey, IGenericSymbol*, GenericInstanceKeyHash>
+            m_KeyToInstanceMap{};
 
         bool m_DoDeferBodyInstantiation = true;
         std::set<const IGenericSymbol*> m_InstanceSet{};
@@ -1,14 +1,13 @@
 #pragma once
 
-#include <string>
-
 #include "SrcLocation.hpp"
+#include "InternedString.hpp"
 
 namespace Ace
 {
     struct Ident
     {
         SrcLocation SrcLocation{};
-        std::string String{};
+        InternedString String{};
     };
 }
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <vector>
+#include <map>
+
+namespace Ace
+{
+    class ISymbol;
+    class ITypeSymbol;
+    class InherentImplSymbol;
+
+    // Compilation-wide index of inherent impls by type root. Impls for a type parameter can apply
+    // to any type, so they are kept separately.
+    class InherentImplIndex
+    {
+    public:
+        auto Add(InherentImplSymbol* const impl) -> void;
+        auto Remove(InherentImplSymbol* const impl) -> void;
+        auto Clear() -> void;
+
+        // Returns every impl that may be an impl for `type`, in declaration order, which callers
+        // still confirm with `DoPlaceholdersOverlap`.
+        auto CollectCandidates(ITypeSymbol* const type) const -> std::vector<InherentImplSymbol*>;
+
+    private:
+        auto CollectBucket(InherentImplSymbol* const impl) -> std::vector<InherentImplSymbol*>&;
+
+        std::map<ISymbol*, std::vector<InherentImplSymbol*>> m_TypeRootToImplsMap{};
+        std::vector<InherentImplSymbol*> m_PlaceholderImpls{};
+    };
+}
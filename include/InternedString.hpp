@@ -0,0 +1,84 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <functional>
+#include <cstdint>
+
+namespace Ace
+{
+    struct InternedStringEntry
+    {
+        std::string String{};
+        uint32_t ID{};
+    };
+
+    // A handle to the single stored copy of a string. Equal strings share one entry, so copying,
+    // comparing and hashing handles never touches the characters. Entries live until
+    // `ResetInternedStrings` and are shared by all threads. Plain strings convert implicitly, so a
+    // name is interned once where it is created and compared by handle from then on.
+    class InternedString
+    {
+    public:
+        InternedString();
+        InternedString(const std::string_view string);
+        InternedString(const std::string& string);
+        InternedString(const char* const string);
+
+        auto GetID() const -> uint32_t
+        {
+            return m_Entry->ID;
+        }
+
+        auto GetString() const -> const std::string&
+        {
+            return m_Entry->String;
+        }
+
+        operator const std::string&() const
+        {
+            return m_Entry->String;
+        }
+
+        auto operator==(const InternedString& other) const -> bool
+        {
+            return m_Entry == other.m_Entry;
+        }
+
+        auto operator==(const std::string_view other) const -> bool
+        {
+            return m_Entry->String == other;
+        }
+
+        auto operator==(const std::string& other) const -> bool
+        {
+            return m_Entry->String == other;
+        }
+
+        auto operator==(const char* const other) const -> bool
+        {
+            return m_Entry->String == other;
+        }
+
+    private:
+        const InternedStringEntry* m_Entry{};
+    };
+
+    // Releases every entry but the empty string and restarts IDs, so the next strings get the
+    // same IDs as in a fresh process. No handle to a released entry may be used afterwards, so
+    // this is only called between compilations that run in one process.
+    auto ResetInternedStrings() -> void;
+
+    auto operator+(const std::string& lhs, const InternedString& rhs) -> std::string;
+    auto operator+(const InternedString& lhs, const std::string& rhs) -> std::string;
+    auto operator+(const char* const lhs, const InternedString& rhs) -> std::string;
+    auto operator+(const InternedString& lhs, const char* const rhs) -> std::string;
+}
+
+template <> struct std::hash<Ace::InternedString>
+{
+    auto operator()(const Ace::InternedString& string) const -> size_t
+    {
+        return string.GetID();
+    }
+};
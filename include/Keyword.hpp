@@ -1,7 +1,7 @@
 #pragma once
 
 #include <string_view>
-#include <unordered_map>
+#include <optional>
 
 #include "TokenKind.hpp"
 #include "Compilation.hpp"
@@ -9,13 +9,9 @@
 
 namespace Ace
 {
-    auto CreateKeywordToTokenKindMap() -> std::unordered_map<std::string_view, TokenKind>;
-    auto CreateTokenToKeywordKindMap() -> std::unordered_map<TokenKind, std::string_view>;
-
-    const std::unordered_map<std::string_view, TokenKind> KeywordToTokenKindMap =
-        CreateKeywordToTokenKindMap();
-    const std::unordered_map<TokenKind, std::string_view> TokenKindToKeywordMap =
-        CreateTokenToKeywordKindMap();
+    auto FindKeywordTokenKind(const std::string_view string) -> std::optional<TokenKind>;
+    auto IsKeywordTokenKind(const TokenKind tokenKind) -> bool;
+    auto GetKeyword(const TokenKind tokenKind) -> std::string_view;
 
     auto GetTokenKindNativeTypeSymbol(Compilation* const compilation, const TokenKind tokenKind)
         -> ITypeSymbol*;
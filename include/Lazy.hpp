@@ -2,9 +2,11 @@
 
 #include <optional>
 #include <functional>
+#include <mutex>
 
 namespace Ace
 {
+    // Runs `initializer` on first use, once even when several threads use it at the same time.
     template <typename T> class Lazy
     {
     public:
@@ -15,16 +17,20 @@ namespace Ace
 
         auto Get() const -> const T&
         {
-            if (!m_OptValue.has_value())
-            {
-                m_OptValue = m_Initializer();
-            }
+            std::call_once(
+                m_OnceFlag,
+                [&]()
+                {
+                    m_OptValue = m_Initializer();
+                }
+            );
 
             return *m_OptValue;
         }
 
     private:
         std::function<T()> m_Initializer;
+        mutable std::once_flag m_OnceFlag{};
         mutable std::optional<T> m_OptValue{};
     };
 }
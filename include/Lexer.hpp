@@ -9,5 +9,25 @@
 
 namespace Ace
 {
+    // Lexes a file one token at a time. Once the buffer is exhausted, every call yields the
+    // `EndOfFile` token.
+    class TokenStream
+    {
+    public:
+        TokenStream(const FileBuffer* const fileBuffer);
+        // Starts at `characterIndex`, which must be the beginning of the buffer or the end of a
+        // token, as lexing depends on nothing before it.
+        TokenStream(const FileBuffer* const fileBuffer, const size_t characterIndex);
+        ~TokenStream() = default;
+
+        auto GetFileBuffer() const -> const FileBuffer*;
+
+        auto LexNext() -> Diagnosed<Token>;
+
+    private:
+        const FileBuffer* m_FileBuffer{};
+        size_t m_CharacterIndex{};
+    };
+
     auto LexTokens(const FileBuffer* const fileBuffer) -> Diagnosed<std::vector<Token>>;
 }
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <string_view>
+
+namespace Ace
+{
+    // Each function returns the first character in `[it, endIt)` that ends the run it scans for, or
+    // `endIt`. They compare 32 (AVX2) or 16 (SSE2) characters at a time where the target allows it
+    // and fall back to a character loop otherwise.
+
+    // Whitespace as the lexer defines it: ' ', '\t', '\n', '\v' and '\f'.
+    auto ScanWhitespace(
+        std::string_view::const_iterator it,
+        const std::string_view::const_iterator endIt
+    ) -> std::string_view::const_iterator;
+
+    // Letters, digits and '_'.
+    auto ScanIdentContinue(
+        std::string_view::const_iterator it,
+        const std::string_view::const_iterator endIt
+    ) -> std::string_view::const_iterator;
+
+    auto ScanNumber(
+        std::string_view::const_iterator it,
+        const std::string_view::const_iterator endIt
+    ) -> std::string_view::const_iterator;
+
+    auto FindCharacter(
+        std::string_view::const_iterator it,
+        const std::string_view::const_iterator endIt,
+        const char character
+    ) -> std::string_view::const_iterator;
+
+    auto FindEitherCharacter(
+        std::string_view::const_iterator it,
+        const std::string_view::const_iterator endIt,
+        const char firstCharacter,
+        const char secondCharacter
+    ) -> std::string_view::const_iterator;
+}
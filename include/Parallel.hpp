@@ -0,0 +1,13 @@
+#pragma once
+
+#include <functional>
+
+namespace Ace
+{
+    // Runs `task(0)` to `task(taskCount - 1)` on up to `jobCount` threads. Tasks must only write
+    // their own result slot, so callers can merge results in index order and stay deterministic
+    // regardless of scheduling.
+    auto ParallelFor(
+        const size_t jobCount, const size_t taskCount, const std::function<void(size_t)>& task
+    ) -> void;
+}
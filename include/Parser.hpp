@@ -5,12 +5,18 @@
 #include <vector>
 
 #include "FileBuffer.hpp"
-#include "Token.hpp"
+#include "TokenCursor.hpp"
 #include "Diagnostic.hpp"
 #include "Syntaxes/All.hpp"
+#include "SyntaxArena.hpp"
 
 namespace Ace
 {
-    auto ParseAST(const std::string& packageName, const FileBuffer* const fileBuffer)
-        -> Expected<std::shared_ptr<const ModSyntax>>;
+    // Syntax nodes are created in `arena`, which must outlive the returned tree.
+    auto ParseAST(
+        SyntaxArena* const arena,
+        const std::string& packageName,
+        const FileBuffer* const fileBuffer,
+        TokenCursor tokenCursor
+    ) -> Expected<const ModSyntax*>;
 }
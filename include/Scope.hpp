@@ -2,18 +2,25 @@
 
 #include <memory>
 #include <vector>
+#include <list>
 #include <string>
 #include <optional>
 #include <algorithm>
 #include <iterator>
 #include <unordered_map>
+#include <span>
+#include <typeindex>
+#include <mutex>
 
 #include "Diagnostic.hpp"
 #include "Diagnostics/SymbolTypeDiagnostics.hpp"
 #include "Name.hpp"
 #include "SymbolCategory.hpp"
 #include "Ident.hpp"
+#include "InternedString.hpp"
 #include "GenericInstantiator.hpp"
+#include "TraitImplIndex.hpp"
+#include "InherentImplIndex.hpp"
 
 namespace Ace
 {
@@ -72,6 +79,52 @@ namespace Ace
         return unaliasedSymbol;
     }
 
+    // Symbols of one type declared in a scope, kept in declaration order.
+    class ISymbolIndex
+    {
+    public:
+        virtual ~ISymbolIndex() = default;
+
+        virtual auto Add(ISymbol* const symbol) -> void = 0;
+        virtual auto Remove(ISymbol* const symbol) -> void = 0;
+    };
+
+    template <typename TSymbol> class SymbolIndex : public ISymbolIndex
+    {
+    public:
+        auto Add(ISymbol* const symbol) -> void final
+        {
+            auto* const castedSymbol = dynamic_cast<TSymbol*>(symbol);
+            if (castedSymbol)
+            {
+                m_Symbols.push_back(castedSymbol);
+            }
+        }
+
+        auto Remove(ISymbol* const symbol) -> void final
+        {
+            auto* const castedSymbol = dynamic_cast<TSymbol*>(symbol);
+            if (!castedSymbol)
+            {
+                return;
+            }
+
+            const auto matchingSymbolIt = std::find(begin(m_Symbols), end(m_Symbols), castedSymbol);
+            if (matchingSymbolIt != end(m_Symbols))
+            {
+                m_Symbols.erase(matchingSymbolIt);
+            }
+        }
+
+        auto GetSymbols() const -> std::span<TSymbol* const>
+        {
+            return m_Symbols;
+        }
+
+    private:
+        std::vector<TSymbol*> m_Symbols{};
+    };
+
     auto IsCorrectSymbolCategory(
         const SrcLocation& srcLocation,
         const ISymbol* const symbol,
@@ -93,7 +146,7 @@ namespace Ace
     struct SymbolResolutionContext
     {
         auto IsLastNameSection() const -> bool;
-        auto GetName() const -> const std::string&;
+        auto GetName() const -> const InternedString&;
 
         SrcLocation SrcLocation{};
         std::shared_ptr<const Scope> BeginScope{};
@@ -135,6 +188,8 @@ namespace Ace
         auto GetName() const -> const std::optional<std::string>&;
         auto GetAnonymousName() const -> const std::optional<std::string>&;
         auto GetGenericInstantiator() -> GenericInstantiator&;
+        auto GetTraitImplIndex() const -> TraitImplIndex&;
+        auto GetInherentImplIndex() const -> InherentImplIndex&;
 
         auto FindMod() const -> std::optional<ModSymbol*>;
         auto FindPackageMod() const -> ModSymbol*;
@@ -144,7 +199,7 @@ namespace Ace
         auto HasChild(const std::shared_ptr<const Scope>& scope) const -> bool;
         auto CollectChildren() const -> std::vector<std::shared_ptr<Scope>>;
 
-        auto HasSymbolWithName(const std::string& name) const -> bool;
+        auto HasSymbolWithName(const InternedString& name) const -> bool;
 
         template <typename TSymbol>
         static auto DeclareSymbol(std::unique_ptr<TSymbol> ownedSymbol) -> Diagnosed<TSymbol*>
@@ -184,8 +239,7 @@ namespace Ace
                 }
             }
 
-            scope->m_SymbolMap[symbol->GetName().String].push_back(std::move(ownedSymbol));
-            scope->OnSymbolDeclared(symbol);
+            scope->AddSymbol(std::move(ownedSymbol));
 
             return Diagnosed{ symbol, std::move(diagnostics) };
         }
@@ -401,36 +455,34 @@ namespace Ace
             return Expected{ symbol, std::move(diagnostics) };
         }
 
-        template <typename TSymbol> auto CollectSymbols() const -> std::vector<TSymbol*>
+        // The returned span is invalidated when a symbol of the same type is declared in or
+        // removed from this scope, so copy it when the loop over it may declare symbols.
+        template <typename TSymbol> auto CollectSymbols() const -> std::span<TSymbol* const>
         {
-            std::vector<TSymbol*> symbols{};
+            // Const queries build indices lazily, so they lock like the mutations do.
+            std::lock_guard lock{ m_SymbolIndexMutex };
 
-            std::for_each(
-                begin(m_SymbolMap),
-                end(m_SymbolMap),
-                [&](const auto& pair)
-                {
-                    std::for_each(
-                        begin(pair.second),
-                        end(pair.second),
-                        [&](const std::unique_ptr<ISymbol>& ownedSymbol)
-                        {
-                            auto* const symbol = dynamic_cast<TSymbol*>(ownedSymbol.get());
-                            if (symbol)
-                            {
-                                symbols.push_back(symbol);
-                            }
-                        }
-                    );
-                }
-            );
+            auto& index = m_SymbolIndexMap[std::type_index{ typeid(TSymbol) }];
+            if (!index)
+            {
+                index = std::make_unique<SymbolIndex<TSymbol>>();
+                std::for_each(
+                    begin(m_DeclaredSymbols),
+                    end(m_DeclaredSymbols),
+                    [&](ISymbol* const symbol)
+                    {
+                        index->Add(symbol);
+                    }
+                );
+            }
 
-            return symbols;
+            return static_cast<const SymbolIndex<TSymbol>&>(*index).GetSymbols();
         }
 
         template <typename TSymbol> auto CollectSymbolsRecursive() const -> std::vector<TSymbol*>
         {
-            auto symbols = CollectSymbols<TSymbol>();
+            const auto scopeSymbols = CollectSymbols<TSymbol>();
+            std::vector<TSymbol*> symbols{ begin(scopeSymbols), end(scopeSymbols) };
 
             std::for_each(
                 begin(m_Children),
@@ -493,11 +545,12 @@ namespace Ace
         auto AddChild(const std::optional<std::string>& optName) -> std::shared_ptr<Scope>;
 
         auto GetDeclaredSymbol(
-            const std::string& name,
+            const InternedString& name,
             const std::vector<ITypeSymbol*>& typeArgs,
             const std::optional<ITypeSymbol*>& optSelfType
         ) const -> std::optional<ISymbol*>;
 
+        auto AddSymbol(std::unique_ptr<ISymbol> ownedSymbol) -> void;
         auto OnSymbolDeclared(ISymbol* const symbol) -> void;
 
         static auto ResolveSymbolInScopes(SymbolResolutionContext context) -> Expected<ISymbol*>;
@@ -523,7 +576,7 @@ namespace Ace
             const SymbolResolutionContext& context, const std::vector<ISymbol*>& matchingSymbols
         ) -> Expected<ISymbol*>;
 
-        static auto CollectInherentImplFor(const std::string& name, ITypeSymbol* const type)
+        static auto CollectInherentImplFor(const InternedString& name, ITypeSymbol* const type)
             -> std::optional<InherentImplSymbol*>;
         auto CollectTraitImplFor(const SymbolNameSection& name, ITypeSymbol* const type) const
             -> Expected<std::optional<TraitImplSymbol*>>;
@@ -531,7 +584,7 @@ namespace Ace
         CollectTraitResolutionScopes(const SymbolNameSection& name, ITypeSymbol* const type) const
             -> Expected<std::vector<std::shared_ptr<const Scope>>>;
 
-        static auto CollectInherentScopes(const std::string& name, ITypeSymbol* const type)
+        static auto CollectInherentScopes(const InternedString& name, ITypeSymbol* const type)
             -> std::vector<std::shared_ptr<const Scope>>;
 
         static auto ResolveSpecialSymbol(const SymbolResolutionContext& context)
@@ -542,8 +595,18 @@ namespace Ace
         std::optional<std::string> m_OptName{};
         std::optional<std::string> m_OptAnonymousName{};
         std::optional<std::shared_ptr<Scope>> m_OptParent{};
-        std::vector<std::weak_ptr<Scope>> m_Children{};
-        std::unordered_map<std::string, std::vector<std::unique_ptr<ISymbol>>> m_SymbolMap;
+        // Children stay in creation order. Each child keeps its position in the list, so it unlinks
+        // itself in constant time, and named children are also found by name.
+        std::list<std::weak_ptr<Scope>> m_Children{};
+        std::list<std::weak_ptr<Scope>>::iterator m_ParentChildIt{};
+        std::unordered_map<std::string, std::weak_ptr<Scope>> m_NamedChildMap{};
+        std::unordered_map<InternedString, std::vector<std::unique_ptr<ISymbol>>> m_SymbolMap;
+        std::vector<ISymbol*> m_DeclaredSymbols{};
+        mutable std::mutex m_SymbolIndexMutex{};
+        mutable std::unordered_map<std::type_index, std::unique_ptr<ISymbolIndex>>
+            m_SymbolIndexMap{};
         GenericInstantiator m_GenericInstantiator;
+        std::shared_ptr<TraitImplIndex> m_TraitImplIndex{};
+        std::shared_ptr<InherentImplIndex> m_InherentImplIndex{};
     };
 }
@@ -18,5 +18,8 @@ namespace Ace
         virtual auto GetBuffer() const -> const std::string& = 0;
 
         virtual auto FormatLocation(const SrcLocation& location) const -> std::string = 0;
+        // Line that contains the character, without its newline.
+        virtual auto FindLine(const std::string_view::const_iterator characterIt) const
+            -> std::string_view = 0;
     };
 }
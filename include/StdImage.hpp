@@ -0,0 +1,38 @@
+#pragma once
+
+#include <span>
+#include <optional>
+#include <ostream>
+#include <string_view>
+#include <cstdint>
+
+#include "Token.hpp"
+#include "FileBuffer.hpp"
+
+namespace Ace::Std
+{
+    struct ImageFile
+    {
+        std::string_view Path{};
+        size_t BufferSize{};
+        const Token* Tokens{};
+        size_t TokenCount{};
+    };
+
+    // Pre-lexed token streams of the embedded std sources, generated at build time by
+    // `ace_std_image` and linked into `ace_core`.
+    struct Image
+    {
+        const ImageFile* Files{};
+        size_t FileCount{};
+    };
+
+    auto GetImage() -> const Image*;
+
+    // Returns std::nullopt for buffers that are not embedded std sources, or when the image was
+    // generated from a different version of the file, so callers fall back to lexing.
+    auto FindImageTokens(const FileBuffer* const fileBuffer)
+        -> std::optional<std::span<const Token>>;
+
+    auto WriteImageSource(std::ostream& stream) -> bool;
+}
@@ -3,6 +3,10 @@
 #include <memory>
 #include <vector>
 #include <string>
+#include <optional>
+#include <atomic>
+#include <mutex>
+#include <cstddef>
 
 #include "Noun.hpp"
 #include "Scope.hpp"
@@ -17,6 +21,13 @@ namespace Ace
     class Compilation;
     class ITypeSymbol;
 
+    struct SymbolCacheStats
+    {
+        size_t SymbolCount{};
+        size_t CachedStringCount{};
+        size_t ByteSize{};
+    };
+
     struct InstantiationContext
     {
         std::vector<ITypeSymbol*> TypeArgs{};
@@ -41,8 +52,11 @@ namespace Ace
 
         virtual auto GetUnaliased() const -> ISymbol* final;
 
-        virtual auto CreateLocalSignature() const -> std::string final;
-        virtual auto CreateSignature() const -> std::string final;
+        // Signatures only depend on a symbol's name, scopes and type args, which do not change
+        // after construction, so they are built once. The caches are filled lazily, at most once
+        // even when function bodies are bound on several threads.
+        virtual auto CreateLocalSignature() const -> const std::string& final;
+        virtual auto CreateSignature() const -> const std::string& final;
         virtual auto CreateFullyQualifiedName(const SrcLocation& srcLocation) const
             -> SymbolName final;
         virtual auto CreateLocalDisplayName() const -> std::string final;
@@ -51,6 +65,15 @@ namespace Ace
         virtual auto IsError() const -> bool final;
 
         virtual auto GetRoot() const -> ISymbol*;
+
+        virtual auto CollectCacheStats(SymbolCacheStats& stats) const -> void final;
+
+    private:
+        mutable std::atomic<ISymbol*> m_UnaliasedCache{};
+        mutable std::once_flag m_LocalSignatureOnceFlag{};
+        mutable std::optional<std::string> m_OptLocalSignatureCache{};
+        mutable std::once_flag m_SignatureOnceFlag{};
+        mutable std::optional<std::string> m_OptSignatureCache{};
     };
 
     auto CreateUnaliasedInstantiatedSymbol(
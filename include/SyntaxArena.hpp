@@ -0,0 +1,101 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <span>
+#include <new>
+#include <utility>
+#include <type_traits>
+#include <cstddef>
+
+namespace Ace
+{
+    // Bump allocator that the syntax nodes of a compilation are created in. Nodes refer to each
+    // other by plain pointers and to their child lists by spans into the arena. Nothing is freed
+    // one by one: when the arena is destroyed, it runs the destructors of the nodes that need one
+    // in reverse order and then releases all of its blocks at once. It is not thread-safe, so
+    // syntax nodes are only created from the parsing thread.
+    class SyntaxArena
+    {
+    public:
+        SyntaxArena() = default;
+        SyntaxArena(const SyntaxArena&) = delete;
+        SyntaxArena(SyntaxArena&&) = delete;
+        ~SyntaxArena();
+        auto operator=(const SyntaxArena&) -> SyntaxArena& = delete;
+        auto operator=(SyntaxArena&&) -> SyntaxArena& = delete;
+
+        template <typename T, typename... TArgs> auto Create(TArgs&&... args) -> const T*
+        {
+            auto* const node = new (Allocate(sizeof(T), alignof(T)))
+                T(CreateArg(std::forward<TArgs>(args))...);
+            AddDestructor(node);
+            return node;
+        }
+
+        // Copies `values` into the arena, so the span outlives the vector it was built in.
+        template <typename T> auto CreateSpan(const std::vector<T>& values) -> std::span<const T>
+        {
+            if (values.empty())
+            {
+                return {};
+            }
+
+            auto* const copies = static_cast<T*>(Allocate(sizeof(T) * values.size(), alignof(T)));
+            for (size_t i = 0; i < values.size(); i++)
+            {
+                AddDestructor(new (copies + i) T(values.at(i)));
+            }
+
+            return { copies, values.size() };
+        }
+
+        auto Allocate(const size_t size, const size_t alignment) -> void*;
+        auto GetByteSize() const -> size_t;
+
+    private:
+        static constexpr size_t BlockSize = 64 * 1024;
+
+        struct Destructor
+        {
+            void* Object{};
+            void (*Destroy)(void*){};
+        };
+
+        // Child lists that the parser collects in vectors are copied into the arena when they are
+        // passed to a node, so no node can keep a span into a vector that is about to be freed.
+        template <typename TArg> auto CreateArg(TArg&& arg) -> TArg&&
+        {
+            return std::forward<TArg>(arg);
+        }
+        template <typename T> auto CreateArg(std::vector<T>& values) -> std::span<const T>
+        {
+            return CreateSpan(values);
+        }
+        template <typename T> auto CreateArg(const std::vector<T>& values) -> std::span<const T>
+        {
+            return CreateSpan(values);
+        }
+        template <typename T> auto CreateArg(std::vector<T>&& values) -> std::span<const T>
+        {
+            return CreateSpan(values);
+        }
+
+        template <typename T> auto AddDestructor(T* const object) -> void
+        {
+            if constexpr (!std::is_trivially_destructible_v<T>)
+            {
+                m_Destructors.push_back(Destructor{
+                    object,
+                    [](void* const object) { static_cast<T*>(object)->~T(); },
+                });
+            }
+        }
+
+        std::vector<std::unique_ptr<std::byte[]>> m_Blocks{};
+        std::byte* m_Position{};
+        std::byte* m_End{};
+        size_t m_ByteSize{};
+        std::vector<Destructor> m_Destructors{};
+    };
+}
@@ -15,7 +15,7 @@ namespace Ace
     public:
         AttributeSyntax(
             const SrcLocation& srcLocation,
-            const std::shared_ptr<const StructConstructionExprSyntax>& structConstructionExpr
+            const StructConstructionExprSyntax* const structConstructionExpr
         );
         virtual ~AttributeSyntax() = default;
 
@@ -25,6 +25,6 @@ namespace Ace
 
     private:
         SrcLocation m_SrcLocation{};
-        std::shared_ptr<const StructConstructionExprSyntax> m_StructConstructionExpr{};
+        const StructConstructionExprSyntax* m_StructConstructionExpr{};
     };
 }
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <vector>
+#include <span>
 
 #include "Syntaxes/Syntax.hpp"
 #include "SrcLocation.hpp"
@@ -18,7 +19,7 @@ namespace Ace
             const SrcLocation& srcLocation,
             const std::shared_ptr<Scope>& scope,
             const SymbolName& typeName,
-            const std::vector<SymbolName>& traitNames
+            const std::span<const SymbolName> traitNames
         );
         virtual ~ConstraintSyntax() = default;
 
@@ -34,6 +35,6 @@ namespace Ace
         SrcLocation m_SrcLocation{};
         std::shared_ptr<Scope> m_Scope{};
         SymbolName m_TypeName{};
-        std::vector<SymbolName> m_TraitNames{};
+        std::span<const SymbolName> m_TraitNames{};
     };
 }
@@ -16,7 +16,7 @@ namespace Ace
     {
     public:
         AddressOfExprSyntax(
-            const SrcLocation& srcLocation, const std::shared_ptr<const IExprSyntax>& expr
+            const SrcLocation& srcLocation, const IExprSyntax* const expr
         );
         virtual ~AddressOfExprSyntax() = default;
 
@@ -28,6 +28,6 @@ namespace Ace
 
     private:
         SrcLocation m_SrcLocation{};
-        std::shared_ptr<const IExprSyntax> m_Expr{};
+        const IExprSyntax* m_Expr{};
     };
 }
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <vector>
+#include <span>
 
 #include "Syntaxes/Exprs/ExprSyntax.hpp"
 #include "Semas/Exprs/ExprSema.hpp"
@@ -16,8 +17,8 @@ namespace Ace
     public:
         CallExprSyntax(
             const SrcLocation& srcLocation,
-            const std::shared_ptr<const IExprSyntax>& expr,
-            const std::vector<std::shared_ptr<const IExprSyntax>>& args
+            const IExprSyntax* const expr,
+            const std::span<const IExprSyntax* const> args
         );
         virtual ~CallExprSyntax() = default;
 
@@ -29,7 +30,7 @@ namespace Ace
 
     private:
         SrcLocation m_SrcLocation{};
-        std::shared_ptr<const IExprSyntax> m_Expr{};
-        std::vector<std::shared_ptr<const IExprSyntax>> m_Args{};
+        const IExprSyntax* m_Expr{};
+        std::span<const IExprSyntax* const> m_Args{};
     };
 }
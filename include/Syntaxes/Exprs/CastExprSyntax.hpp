@@ -18,7 +18,7 @@ namespace Ace
         CastExprSyntax(
             const SrcLocation& srcLocation,
             const TypeName& typeName,
-            const std::shared_ptr<const IExprSyntax>& expr
+            const IExprSyntax* const expr
         );
         virtual ~CastExprSyntax() = default;
 
@@ -31,6 +31,6 @@ namespace Ace
     private:
         SrcLocation m_SrcLocation{};
         TypeName m_TypeName{};
-        std::shared_ptr<const IExprSyntax> m_Expr{};
+        const IExprSyntax* m_Expr{};
     };
 }
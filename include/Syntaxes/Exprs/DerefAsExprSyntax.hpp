@@ -19,7 +19,7 @@ namespace Ace
         DerefAsExprSyntax(
             const SrcLocation& srcLocation,
             const TypeName& typeName,
-            const std::shared_ptr<const IExprSyntax>& expr
+            const IExprSyntax* const expr
         );
         virtual ~DerefAsExprSyntax() = default;
 
@@ -32,6 +32,6 @@ namespace Ace
     private:
         SrcLocation m_SrcLocation{};
         TypeName m_TypeName{};
-        std::shared_ptr<const IExprSyntax> m_Expr{};
+        const IExprSyntax* m_Expr{};
     };
 }
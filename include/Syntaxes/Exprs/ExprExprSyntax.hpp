@@ -15,7 +15,7 @@ namespace Ace
     {
     public:
         ExprExprSyntax(
-            const SrcLocation& srcLocation, const std::shared_ptr<const IExprSyntax>& expr
+            const SrcLocation& srcLocation, const IExprSyntax* const expr
         );
         virtual ~ExprExprSyntax() = default;
 
@@ -27,6 +27,6 @@ namespace Ace
 
     private:
         SrcLocation m_SrcLocation{};
-        std::shared_ptr<const IExprSyntax> m_Expr{};
+        const IExprSyntax* m_Expr{};
     };
 }
@@ -18,7 +18,7 @@ namespace Ace
     public:
         MemberAccessExprSyntax(
             const SrcLocation& srcLocation,
-            const std::shared_ptr<const IExprSyntax>& expr,
+            const IExprSyntax* const expr,
             const SymbolNameSection& name
         );
         virtual ~MemberAccessExprSyntax() = default;
@@ -34,7 +34,7 @@ namespace Ace
 
     private:
         SrcLocation m_SrcLocation{};
-        std::shared_ptr<const IExprSyntax> m_Expr{};
+        const IExprSyntax* m_Expr{};
         SymbolNameSection m_Name{};
     };
 }
@@ -16,8 +16,8 @@ namespace Ace
     public:
         OrExprSyntax(
             const SrcLocation& srcLocation,
-            const std::shared_ptr<const IExprSyntax>& lhsExpr,
-            const std::shared_ptr<const IExprSyntax>& rhsExpr
+            const IExprSyntax* const lhsExpr,
+            const IExprSyntax* const rhsExpr
         );
         virtual ~OrExprSyntax() = default;
 
@@ -29,7 +29,7 @@ namespace Ace
 
     private:
         SrcLocation m_SrcLocation{};
-        std::shared_ptr<const IExprSyntax> m_LHSExpr{};
-        std::shared_ptr<const IExprSyntax> m_RHSExpr{};
+        const IExprSyntax* m_LHSExpr{};
+        const IExprSyntax* m_RHSExpr{};
     };
 }
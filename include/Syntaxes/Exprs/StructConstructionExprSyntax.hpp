@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <vector>
+#include <span>
 #include <optional>
 
 #include "Ident.hpp"
@@ -17,7 +18,7 @@ namespace Ace
     struct StructConstructionExprArg
     {
         Ident Name{};
-        std::optional<std::shared_ptr<const IExprSyntax>> OptValue{};
+        std::optional<const IExprSyntax*> OptValue{};
     };
 
     class StructConstructionExprSyntax : public virtual IExprSyntax,
@@ -28,7 +29,7 @@ namespace Ace
             const SrcLocation& srcLocation,
             const std::shared_ptr<Scope>& scope,
             const SymbolName& typeName,
-            std::vector<StructConstructionExprArg>&& args
+            const std::span<const StructConstructionExprArg> args
         );
         virtual ~StructConstructionExprSyntax() = default;
 
@@ -43,6 +44,6 @@ namespace Ace
         SrcLocation m_SrcLocation{};
         std::shared_ptr<Scope> m_Scope{};
         SymbolName m_TypeName{};
-        std::vector<StructConstructionExprArg> m_Args{};
+        std::span<const StructConstructionExprArg> m_Args{};
     };
 }
@@ -18,8 +18,8 @@ namespace Ace
     public:
         UserBinaryExprSyntax(
             const SrcLocation& srcLocation,
-            const std::shared_ptr<const IExprSyntax>& lhsExpr,
-            const std::shared_ptr<const IExprSyntax>& rhsExpr,
+            const IExprSyntax* const lhsExpr,
+            const IExprSyntax* const rhsExpr,
             const SrcLocation& opSrcLocation,
             const Op op
         );
@@ -33,8 +33,8 @@ namespace Ace
 
     private:
         SrcLocation m_SrcLocation{};
-        std::shared_ptr<const IExprSyntax> m_LHSExpr{};
-        std::shared_ptr<const IExprSyntax> m_RHSExpr{};
+        const IExprSyntax* m_LHSExpr{};
+        const IExprSyntax* m_RHSExpr{};
         SrcLocation m_OpSrcLocation{};
         Op m_Op{};
     };
@@ -18,7 +18,7 @@ namespace Ace
     public:
         UserUnaryExprSyntax(
             const SrcLocation& srcLocation,
-            const std::shared_ptr<const IExprSyntax>& expr,
+            const IExprSyntax* const expr,
             const SrcLocation& opSrcLocation,
             const Op op
         );
@@ -32,7 +32,7 @@ namespace Ace
 
     private:
         SrcLocation m_SrcLocation{};
-        std::shared_ptr<const IExprSyntax> m_Expr{};
+        const IExprSyntax* m_Expr{};
         SrcLocation m_OpSrcLocation{};
         Op m_Op{};
     };
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <vector>
+#include <span>
 #include <optional>
 
 #include "Syntaxes/Syntax.hpp"
@@ -31,13 +32,13 @@ namespace Ace
             const AccessModifier accessModifier,
             const Ident& name,
             const TypeName& typeName,
-            const std::vector<std::shared_ptr<const AttributeSyntax>>& attributes,
-            const std::optional<std::shared_ptr<const ImplSelfSyntax>>& optSelf,
-            const std::optional<std::shared_ptr<const SelfParamVarSyntax>>& optSelfParam,
-            const std::vector<std::shared_ptr<const NormalParamVarSyntax>>& params,
-            const std::optional<std::shared_ptr<const BlockStmtSyntax>>& optBlock,
-            const std::vector<std::shared_ptr<const TypeParamSyntax>>& typeParams,
-            const std::vector<std::shared_ptr<const ConstraintSyntax>>& constraints
+            const std::span<const AttributeSyntax* const> attributes,
+            const std::optional<const ImplSelfSyntax*>& optSelf,
+            const std::optional<const SelfParamVarSyntax*>& optSelfParam,
+            const std::span<const NormalParamVarSyntax* const> params,
+            const std::optional<const BlockStmtSyntax*>& optBlock,
+            const std::span<const TypeParamSyntax* const> typeParams,
+            const std::span<const ConstraintSyntax* const> constraints
         );
         virtual ~FunctionSyntax() = default;
 
@@ -50,7 +51,7 @@ namespace Ace
         auto GetDeclOrder() const -> DeclOrder final;
         auto CreateSymbol() const -> Diagnosed<std::unique_ptr<ISymbol>> final;
 
-        auto GetBlock() const -> const std::optional<std::shared_ptr<const BlockStmtSyntax>>&;
+        auto GetBlock() const -> const std::optional<const BlockStmtSyntax*>&;
 
     protected:
         SrcLocation m_SrcLocation{};
@@ -58,12 +59,12 @@ namespace Ace
         AccessModifier m_AccessModifier{};
         Ident m_Name{};
         TypeName m_TypeName{};
-        std::vector<std::shared_ptr<const AttributeSyntax>> m_Attributes{};
-        std::optional<std::shared_ptr<const ImplSelfSyntax>> m_OptSelf{};
-        std::optional<std::shared_ptr<const SelfParamVarSyntax>> m_OptSelfParam{};
-        std::vector<std::shared_ptr<const NormalParamVarSyntax>> m_Params{};
-        std::optional<std::shared_ptr<const BlockStmtSyntax>> m_OptBlock{};
-        std::vector<std::shared_ptr<const TypeParamSyntax>> m_TypeParams{};
-        std::vector<std::shared_ptr<const ConstraintSyntax>> m_Constraints{};
+        std::span<const AttributeSyntax* const> m_Attributes{};
+        std::optional<const ImplSelfSyntax*> m_OptSelf{};
+        std::optional<const SelfParamVarSyntax*> m_OptSelfParam{};
+        std::span<const NormalParamVarSyntax* const> m_Params{};
+        std::optional<const BlockStmtSyntax*> m_OptBlock{};
+        std::span<const TypeParamSyntax* const> m_TypeParams{};
+        std::span<const ConstraintSyntax* const> m_Constraints{};
     };
 }
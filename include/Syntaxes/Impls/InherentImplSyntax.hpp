@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <vector>
+#include <span>
 
 #include "Syntaxes/TypeParamSyntax.hpp"
 #include "Syntaxes/ConstraintSyntax.hpp"
@@ -20,10 +21,10 @@ namespace Ace
         InherentImplSyntax(
             const SrcLocation& srcLocation,
             const std::shared_ptr<Scope>& bodyScope,
-            const std::vector<std::shared_ptr<const TypeParamSyntax>>& typeParams,
+            const std::span<const TypeParamSyntax* const> typeParams,
             const SymbolName& typeName,
-            const std::vector<std::shared_ptr<const ConstraintSyntax>>& constraints,
-            const std::vector<std::shared_ptr<const FunctionSyntax>>& functions
+            const std::span<const ConstraintSyntax* const> constraints,
+            const std::span<const FunctionSyntax* const> functions
         );
         virtual ~InherentImplSyntax() = default;
 
@@ -38,9 +39,9 @@ namespace Ace
     private:
         SrcLocation m_SrcLocation{};
         std::shared_ptr<Scope> m_BodyScope{};
-        std::vector<std::shared_ptr<const TypeParamSyntax>> m_TypeParams{};
+        std::span<const TypeParamSyntax* const> m_TypeParams{};
         SymbolName m_TypeName{};
-        std::vector<std::shared_ptr<const ConstraintSyntax>> m_Constraints{};
-        std::vector<std::shared_ptr<const FunctionSyntax>> m_Functions{};
+        std::span<const ConstraintSyntax* const> m_Constraints{};
+        std::span<const FunctionSyntax* const> m_Functions{};
     };
 }
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <vector>
+#include <span>
 
 #include "Syntaxes/TypeParamSyntax.hpp"
 #include "Syntaxes/ConstraintSyntax.hpp"
@@ -20,12 +21,12 @@ namespace Ace
         TraitImplSyntax(
             const SrcLocation& srcLocation,
             const std::shared_ptr<Scope>& bodyScope,
-            const std::vector<std::shared_ptr<const TypeParamSyntax>>& typeParams,
+            const std::span<const TypeParamSyntax* const> typeParams,
             const SymbolName& traitName,
             const SymbolName& typeName,
-            const std::vector<std::shared_ptr<const ConstraintSyntax>>& constraints,
-            const std::shared_ptr<const ImplSelfSyntax>& self,
-            const std::vector<std::shared_ptr<const FunctionSyntax>>& functions
+            const std::span<const ConstraintSyntax* const> constraints,
+            const ImplSelfSyntax* const self,
+            const std::span<const FunctionSyntax* const> functions
         );
         virtual ~TraitImplSyntax() = default;
 
@@ -40,11 +41,11 @@ namespace Ace
     private:
         SrcLocation m_SrcLocation{};
         std::shared_ptr<Scope> m_BodyScope{};
-        std::vector<std::shared_ptr<const TypeParamSyntax>> m_TypeParams{};
+        std::span<const TypeParamSyntax* const> m_TypeParams{};
         SymbolName m_TraitName{};
         SymbolName m_TypeName{};
-        std::vector<std::shared_ptr<const ConstraintSyntax>> m_Constraints{};
-        std::shared_ptr<const ImplSelfSyntax> m_Self{};
-        std::vector<std::shared_ptr<const FunctionSyntax>> m_Functions{};
+        std::span<const ConstraintSyntax* const> m_Constraints{};
+        const ImplSelfSyntax* m_Self{};
+        std::span<const FunctionSyntax* const> m_Functions{};
     };
 }
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <vector>
+#include <span>
 
 #include "Syntaxes/Syntax.hpp"
 #include "Syntaxes/Impls/InherentImplSyntax.hpp"
@@ -24,15 +25,15 @@ namespace Ace
             const SrcLocation& srcLocation,
             const std::shared_ptr<Scope>& scope,
             const std::shared_ptr<Scope>& bodyScope,
-            const std::vector<Ident>& name,
+            const std::span<const Ident> name,
             const AccessModifier accessModifier,
-            const std::vector<std::shared_ptr<const ModSyntax>>& mods,
-            const std::vector<std::shared_ptr<const ISyntax>>& types,
-            const std::vector<std::shared_ptr<const InherentImplSyntax>>& inherentImpls,
-            const std::vector<std::shared_ptr<const TraitImplSyntax>>& traitImpls,
-            const std::vector<std::shared_ptr<const FunctionSyntax>>& functions,
-            const std::vector<std::shared_ptr<const GlobalVarSyntax>>& globalVars,
-            const std::vector<std::shared_ptr<const UseSyntax>>& uses
+            const std::span<const ModSyntax* const> mods,
+            const std::span<const ISyntax* const> types,
+            const std::span<const InherentImplSyntax* const> inherentImpls,
+            const std::span<const TraitImplSyntax* const> traitImpls,
+            const std::span<const FunctionSyntax* const> functions,
+            const std::span<const GlobalVarSyntax* const> globalVars,
+            const std::span<const UseSyntax* const> uses
         );
         virtual ~ModSyntax() = default;
 
@@ -51,14 +52,14 @@ namespace Ace
         SrcLocation m_SrcLocation{};
         std::shared_ptr<Scope> m_Scope{};
         std::shared_ptr<Scope> m_BodyScope{};
-        std::vector<Ident> m_Name{};
+        std::span<const Ident> m_Name{};
         AccessModifier m_AccessModifier{};
-        std::vector<std::shared_ptr<const ModSyntax>> m_Mods{};
-        std::vector<std::shared_ptr<const ISyntax>> m_Types{};
-        std::vector<std::shared_ptr<const InherentImplSyntax>> m_InherentImpls{};
-        std::vector<std::shared_ptr<const TraitImplSyntax>> m_TraitImpls{};
-        std::vector<std::shared_ptr<const FunctionSyntax>> m_Functions{};
-        std::vector<std::shared_ptr<const GlobalVarSyntax>> m_GlobalVars{};
-        std::vector<std::shared_ptr<const UseSyntax>> m_Uses{};
+        std::span<const ModSyntax* const> m_Mods{};
+        std::span<const ISyntax* const> m_Types{};
+        std::span<const InherentImplSyntax* const> m_InherentImpls{};
+        std::span<const TraitImplSyntax* const> m_TraitImpls{};
+        std::span<const FunctionSyntax* const> m_Functions{};
+        std::span<const GlobalVarSyntax* const> m_GlobalVars{};
+        std::span<const UseSyntax* const> m_Uses{};
     };
 }
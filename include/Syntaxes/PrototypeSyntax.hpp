@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <vector>
+#include <span>
 #include <optional>
 
 #include "Syntaxes/Syntax.hpp"
@@ -28,12 +29,12 @@ namespace Ace
             const SymbolName& parentTraitName,
             const Ident& name,
             const TypeName& typeName,
-            const std::vector<std::shared_ptr<const AttributeSyntax>>& attributes,
+            const std::span<const AttributeSyntax* const> attributes,
             const size_t index,
-            const std::optional<std::shared_ptr<const SelfParamVarSyntax>>& optSelfParam,
-            const std::vector<std::shared_ptr<const NormalParamVarSyntax>>& params,
-            const std::vector<std::shared_ptr<const TypeParamSyntax>>& typeParams,
-            const std::vector<std::shared_ptr<const ConstraintSyntax>>& constraints
+            const std::optional<const SelfParamVarSyntax*>& optSelfParam,
+            const std::span<const NormalParamVarSyntax* const> params,
+            const std::span<const TypeParamSyntax* const> typeParams,
+            const std::span<const ConstraintSyntax* const> constraints
         );
         virtual ~PrototypeSyntax() = default;
 
@@ -51,11 +52,11 @@ namespace Ace
         SymbolName m_ParentTraitName{};
         Ident m_Name{};
         TypeName m_TypeName{};
-        std::vector<std::shared_ptr<const AttributeSyntax>> m_Attributes{};
+        std::span<const AttributeSyntax* const> m_Attributes{};
         size_t m_Index{};
-        std::optional<std::shared_ptr<const SelfParamVarSyntax>> m_OptSelfParam{};
-        std::vector<std::shared_ptr<const NormalParamVarSyntax>> m_Params{};
-        std::vector<std::shared_ptr<const TypeParamSyntax>> m_TypeParams{};
-        std::vector<std::shared_ptr<const ConstraintSyntax>> m_Constraints{};
+        std::optional<const SelfParamVarSyntax*> m_OptSelfParam{};
+        std::span<const NormalParamVarSyntax* const> m_Params{};
+        std::span<const TypeParamSyntax* const> m_TypeParams{};
+        std::span<const ConstraintSyntax* const> m_Constraints{};
     };
 }
@@ -18,7 +18,7 @@ namespace Ace
         AssertStmtSyntax(
             const SrcLocation& srcLocation,
             const std::shared_ptr<Scope>& scope,
-            const std::shared_ptr<const IExprSyntax>& condition
+            const IExprSyntax* const condition
         );
         virtual ~AssertStmtSyntax() = default;
 
@@ -31,6 +31,6 @@ namespace Ace
     private:
         SrcLocation m_SrcLocation{};
         std::shared_ptr<Scope> m_Scope{};
-        std::shared_ptr<const IExprSyntax> m_Condition{};
+        const IExprSyntax* m_Condition{};
     };
 }
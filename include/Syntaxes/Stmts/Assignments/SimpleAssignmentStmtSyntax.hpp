@@ -19,8 +19,8 @@ namespace Ace
         SimpleAssignmentStmtSyntax(
             const SrcLocation& srcLocation,
             const std::shared_ptr<Scope>& scope,
-            const std::shared_ptr<const IExprSyntax>& lhsExpr,
-            const std::shared_ptr<const IExprSyntax>& rhsExpr
+            const IExprSyntax* const lhsExpr,
+            const IExprSyntax* const rhsExpr
         );
         virtual ~SimpleAssignmentStmtSyntax() = default;
 
@@ -33,7 +33,7 @@ namespace Ace
     private:
         SrcLocation m_SrcLocation{};
         std::shared_ptr<Scope> m_Scope{};
-        std::shared_ptr<const IExprSyntax> m_LHSExpr{};
-        std::shared_ptr<const IExprSyntax> m_RHSExpr{};
+        const IExprSyntax* m_LHSExpr{};
+        const IExprSyntax* m_RHSExpr{};
     };
 }
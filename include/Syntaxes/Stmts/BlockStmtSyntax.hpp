@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <vector>
+#include <span>
 
 #include "Syntaxes/Stmts/StmtSyntax.hpp"
 #include "Semas/Stmts/BlockStmtSema.hpp"
@@ -17,7 +18,7 @@ namespace Ace
         BlockStmtSyntax(
             const SrcLocation& srcLocation,
             const std::shared_ptr<Scope>& bodyScope,
-            const std::vector<std::shared_ptr<const IStmtSyntax>>& stmts
+            const std::span<const IStmtSyntax* const> stmts
         );
         virtual ~BlockStmtSyntax() = default;
 
@@ -30,6 +31,6 @@ namespace Ace
     private:
         SrcLocation m_SrcLocation{};
         std::shared_ptr<Scope> m_BodyScope{};
-        std::vector<std::shared_ptr<const IStmtSyntax>> m_Stmts{};
+        std::span<const IStmtSyntax* const> m_Stmts{};
     };
 }
@@ -19,8 +19,8 @@ namespace Ace
         CopyStmtSyntax(
             const SrcLocation& srcLocation,
             const TypeName& typeName,
-            const std::shared_ptr<const IExprSyntax>& srcExpr,
-            const std::shared_ptr<const IExprSyntax>& dstExpr
+            const IExprSyntax* const srcExpr,
+            const IExprSyntax* const dstExpr
         );
         virtual ~CopyStmtSyntax() = default;
 
@@ -33,7 +33,7 @@ namespace Ace
     private:
         SrcLocation m_SrcLocation{};
         TypeName m_TypeName{};
-        std::shared_ptr<const IExprSyntax> m_SrcExpr{};
-        std::shared_ptr<const IExprSyntax> m_DstExpr{};
+        const IExprSyntax* m_SrcExpr{};
+        const IExprSyntax* m_DstExpr{};
     };
 }
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <vector>
+#include <span>
 #include <optional>
 
 #include "Syntaxes/Stmts/StmtSyntax.hpp"
@@ -20,8 +21,8 @@ namespace Ace
         IfStmtSyntax(
             const SrcLocation& srcLocation,
             const std::shared_ptr<Scope>& scope,
-            const std::vector<std::shared_ptr<const IExprSyntax>>& conditions,
-            const std::vector<std::shared_ptr<const BlockStmtSyntax>>& blocks
+            const std::span<const IExprSyntax* const> conditions,
+            const std::span<const BlockStmtSyntax* const> blocks
         );
         virtual ~IfStmtSyntax() = default;
 
@@ -34,7 +35,7 @@ namespace Ace
     private:
         SrcLocation m_SrcLocation{};
         std::shared_ptr<Scope> m_Scope{};
-        std::vector<std::shared_ptr<const IExprSyntax>> m_Conditions{};
-        std::vector<std::shared_ptr<const BlockStmtSyntax>> m_Blocks{};
+        std::span<const IExprSyntax* const> m_Conditions{};
+        std::span<const BlockStmtSyntax* const> m_Blocks{};
     };
 }
@@ -19,7 +19,7 @@ namespace Ace
         RetStmtSyntax(
             const SrcLocation& srcLocation,
             const std::shared_ptr<Scope>& scope,
-            const std::optional<std::shared_ptr<const IExprSyntax>>& optExpr
+            const std::optional<const IExprSyntax*>& optExpr
         );
         virtual ~RetStmtSyntax() = default;
 
@@ -32,6 +32,6 @@ namespace Ace
     private:
         SrcLocation m_SrcLocation{};
         std::shared_ptr<Scope> m_Scope{};
-        std::optional<std::shared_ptr<const IExprSyntax>> m_OptExpr{};
+        std::optional<const IExprSyntax*> m_OptExpr{};
     };
 }
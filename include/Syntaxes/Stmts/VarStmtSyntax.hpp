@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <vector>
+#include <span>
 #include <optional>
 
 #include "Syntaxes/Stmts/StmtSyntax.hpp"
@@ -26,8 +27,8 @@ namespace Ace
             const std::shared_ptr<Scope>& scope,
             const Ident& name,
             const TypeName& typeName,
-            const std::vector<std::shared_ptr<const AttributeSyntax>>& attributes,
-            const std::optional<std::shared_ptr<const IExprSyntax>>& optAssignedExpr
+            const std::span<const AttributeSyntax* const> attributes,
+            const std::optional<const IExprSyntax*>& optAssignedExpr
         );
         virtual ~VarStmtSyntax() = default;
 
@@ -46,7 +47,7 @@ namespace Ace
         std::shared_ptr<Scope> m_Scope{};
         Ident m_Name{};
         TypeName m_TypeName{};
-        std::vector<std::shared_ptr<const AttributeSyntax>> m_Attributes{};
-        std::optional<std::shared_ptr<const IExprSyntax>> m_OptAssignedExpr{};
+        std::span<const AttributeSyntax* const> m_Attributes{};
+        std::optional<const IExprSyntax*> m_OptAssignedExpr{};
     };
 }
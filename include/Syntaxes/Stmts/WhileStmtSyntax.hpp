@@ -18,8 +18,8 @@ namespace Ace
         WhileStmtSyntax(
             const SrcLocation& srcLocation,
             const std::shared_ptr<Scope>& scope,
-            const std::shared_ptr<const IExprSyntax>& condition,
-            const std::shared_ptr<const BlockStmtSyntax>& block
+            const IExprSyntax* const condition,
+            const BlockStmtSyntax* const block
         );
         virtual ~WhileStmtSyntax() = default;
 
@@ -32,7 +32,7 @@ namespace Ace
     private:
         SrcLocation m_SrcLocation{};
         std::shared_ptr<Scope> m_Scope{};
-        std::shared_ptr<const IExprSyntax> m_Condition{};
-        std::shared_ptr<const BlockStmtSyntax> m_Block{};
+        const IExprSyntax* m_Condition{};
+        const BlockStmtSyntax* m_Block{};
     };
 }
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <vector>
+#include <span>
 
 #include "Syntaxes/Syntax.hpp"
 #include "Syntaxes/AttributeSyntax.hpp"
@@ -24,9 +25,9 @@ namespace Ace
             const std::shared_ptr<Scope>& bodyScope,
             const AccessModifier accessModifier,
             const Ident& name,
-            const std::vector<std::shared_ptr<const AttributeSyntax>>& attributes,
-            const std::vector<std::shared_ptr<const FieldVarSyntax>>& fields,
-            const std::vector<std::shared_ptr<const TypeParamSyntax>>& typeParams
+            const std::span<const AttributeSyntax* const> attributes,
+            const std::span<const FieldVarSyntax* const> fields,
+            const std::span<const TypeParamSyntax* const> typeParams
         );
         virtual ~StructSyntax() = default;
 
@@ -43,8 +44,8 @@ namespace Ace
         std::shared_ptr<Scope> m_BodyScope{};
         AccessModifier m_AccessModifier{};
         Ident m_Name{};
-        std::vector<std::shared_ptr<const AttributeSyntax>> m_Attributes{};
-        std::vector<std::shared_ptr<const FieldVarSyntax>> m_Fields{};
-        std::vector<std::shared_ptr<const TypeParamSyntax>> m_TypeParams{};
+        std::span<const AttributeSyntax* const> m_Attributes{};
+        std::span<const FieldVarSyntax* const> m_Fields{};
+        std::span<const TypeParamSyntax* const> m_TypeParams{};
     };
 }
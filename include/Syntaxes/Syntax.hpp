@@ -2,6 +2,8 @@
 
 #include <memory>
 #include <vector>
+#include <span>
+#include <optional>
 #include <algorithm>
 #include <iterator>
 
@@ -23,32 +25,30 @@ namespace Ace
         SyntaxChildCollector() = default;
         ~SyntaxChildCollector() = default;
 
-        template <typename T>
-        auto Collect(const std::shared_ptr<const T>& syntax) -> SyntaxChildCollector&
+        template <typename T> auto Collect(const T* const syntax) -> SyntaxChildCollector&
         {
-            m_Children.push_back(syntax.get());
+            m_Children.push_back(syntax);
             return CollectChildren(syntax);
         }
 
         template <typename T>
-        auto Collect(const std::optional<std::shared_ptr<const T>>& optSema)
-            -> SyntaxChildCollector&
+        auto Collect(const std::optional<const T*>& optSyntax) -> SyntaxChildCollector&
         {
-            if (optSema.has_value())
+            if (optSyntax.has_value())
             {
-                Collect(optSema.value());
+                Collect(optSyntax.value());
             }
 
             return *this;
         }
 
         template <typename T>
-        auto Collect(const std::vector<std::shared_ptr<const T>>& syntaxes) -> SyntaxChildCollector&
+        auto Collect(const std::span<const T* const> syntaxes) -> SyntaxChildCollector&
         {
             std::for_each(
                 begin(syntaxes),
                 end(syntaxes),
-                [&](const std::shared_ptr<const T>& syntax)
+                [&](const T* const syntax)
                 {
                     Collect(syntax);
                 }
@@ -58,7 +58,7 @@ namespace Ace
         }
 
         template <typename T>
-        auto CollectChildren(const std::shared_ptr<const T>& syntax) -> SyntaxChildCollector&
+        auto CollectChildren(const T* const syntax) -> SyntaxChildCollector&
         {
             const auto children = syntax->CollectChildren();
             m_Children.insert(end(m_Children), begin(children), end(children));
@@ -104,6 +104,6 @@ namespace Ace
 
     auto ResolveTypeParamSymbols(
         const std::shared_ptr<Scope>& scope,
-        const std::vector<std::shared_ptr<const TypeParamSyntax>>& typeParams
+        const std::span<const TypeParamSyntax* const> typeParams
     ) -> Diagnosed<std::vector<ITypeSymbol*>>;
 }
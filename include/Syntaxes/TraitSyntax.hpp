@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <vector>
+#include <span>
 
 #include "Syntaxes/Syntax.hpp"
 #include "Syntaxes/AttributeSyntax.hpp"
@@ -28,12 +29,12 @@ namespace Ace
             const std::shared_ptr<Scope>& prototypeScope,
             const AccessModifier accessModifier,
             const Ident& name,
-            const std::vector<std::shared_ptr<const AttributeSyntax>>& attributes,
-            const std::shared_ptr<const TraitSelfSyntax>& self,
-            const std::vector<std::shared_ptr<const PrototypeSyntax>>& prototypes,
-            const std::vector<std::shared_ptr<const TypeParamSyntax>>& typeParams,
-            const std::vector<std::shared_ptr<const TypeReimportSyntax>>& typeParamReimports,
-            const std::vector<std::shared_ptr<const SupertraitSyntax>>& supertraits
+            const std::span<const AttributeSyntax* const> attributes,
+            const TraitSelfSyntax* const self,
+            const std::span<const PrototypeSyntax* const> prototypes,
+            const std::span<const TypeParamSyntax* const> typeParams,
+            const std::span<const TypeReimportSyntax* const> typeParamReimports,
+            const std::span<const SupertraitSyntax* const> supertraits
         );
         virtual ~TraitSyntax() = default;
 
@@ -51,11 +52,11 @@ namespace Ace
         std::shared_ptr<Scope> m_PrototypeScope{};
         AccessModifier m_AccessModifier{};
         Ident m_Name{};
-        std::vector<std::shared_ptr<const AttributeSyntax>> m_Attributes{};
-        std::shared_ptr<const TraitSelfSyntax> m_Self{};
-        std::vector<std::shared_ptr<const PrototypeSyntax>> m_Prototypes{};
-        std::vector<std::shared_ptr<const TypeParamSyntax>> m_TypeParams{};
-        std::vector<std::shared_ptr<const TypeReimportSyntax>> m_TypeParamReimports{};
-        std::vector<std::shared_ptr<const SupertraitSyntax>> m_Supertraits{};
+        std::span<const AttributeSyntax* const> m_Attributes{};
+        const TraitSelfSyntax* m_Self{};
+        std::span<const PrototypeSyntax* const> m_Prototypes{};
+        std::span<const TypeParamSyntax* const> m_TypeParams{};
+        std::span<const TypeReimportSyntax* const> m_TypeParamReimports{};
+        std::span<const SupertraitSyntax* const> m_Supertraits{};
     };
 }
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <vector>
+#include <span>
 
 #include "Syntaxes/Syntax.hpp"
 #include "Syntaxes/AttributeSyntax.hpp"
@@ -25,7 +26,7 @@ namespace Ace
             const SymbolName& parentStructName,
             const Ident& name,
             const TypeName& typeName,
-            const std::vector<std::shared_ptr<const AttributeSyntax>>& attributes,
+            const std::span<const AttributeSyntax* const> attributes,
             const size_t index
         );
         virtual ~FieldVarSyntax() = default;
@@ -45,7 +46,7 @@ namespace Ace
         SymbolName m_ParentStructName{};
         Ident m_Name{};
         TypeName m_TypeName{};
-        std::vector<std::shared_ptr<const AttributeSyntax>> m_Attributes{};
+        std::span<const AttributeSyntax* const> m_Attributes{};
         size_t m_Index{};
     };
 }
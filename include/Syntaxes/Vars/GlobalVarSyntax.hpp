@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <vector>
+#include <span>
 
 #include "Syntaxes/Syntax.hpp"
 #include "Syntaxes/AttributeSyntax.hpp"
@@ -23,7 +24,7 @@ namespace Ace
             const std::shared_ptr<Scope>& scope,
             const Ident& name,
             const TypeName& typeName,
-            const std::vector<std::shared_ptr<const AttributeSyntax>>& attributes,
+            const std::span<const AttributeSyntax* const> attributes,
             const AccessModifier accessModifier
         );
         virtual ~GlobalVarSyntax() = default;
@@ -41,7 +42,7 @@ namespace Ace
         std::shared_ptr<Scope> m_Scope{};
         Ident m_Name{};
         TypeName m_TypeName{};
-        std::vector<std::shared_ptr<const AttributeSyntax>> m_Attributes{};
+        std::span<const AttributeSyntax* const> m_Attributes{};
         AccessModifier m_AccessModifier{};
     };
 }
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <optional>
+#include <filesystem>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <functional>
+
+#include "Diagnostic.hpp"
+
+namespace Ace
+{
+    enum class TimeTraceEventKind
+    {
+        Phase,
+        Function,
+    };
+
+    struct TimeTraceEvent
+    {
+        TimeTraceEventKind Kind{};
+        std::string Name{};
+        std::string Detail{};
+        std::chrono::steady_clock::time_point BeginTime{};
+        std::chrono::steady_clock::duration Duration{};
+        size_t ThreadIndex{};
+        size_t Depth{};
+    };
+
+    class TimeTracer
+    {
+    public:
+        TimeTracer() = default;
+        TimeTracer(
+            const bool isSummaryEnabled,
+            const std::optional<std::filesystem::path>& optTraceFilePath
+        );
+        ~TimeTracer() = default;
+
+        auto IsEnabled() const -> bool;
+        auto IsSummaryEnabled() const -> bool;
+        auto IsTracingFunctions() const -> bool;
+
+        auto Record(TimeTraceEvent event) -> void;
+
+        auto PrintSummary(const size_t indentLevel) const -> void;
+        auto WriteTraceFile() const -> Expected<void>;
+
+    private:
+        auto GetThreadIndex() -> size_t;
+
+        bool m_IsSummaryEnabled{};
+        std::optional<std::filesystem::path> m_OptTraceFilePath{};
+        std::chrono::steady_clock::time_point m_BeginTime = std::chrono::steady_clock::now();
+
+        mutable std::mutex m_Mutex{};
+        std::vector<TimeTraceEvent> m_Events{};
+        std::vector<std::thread::id> m_ThreadIDs{};
+    };
+
+    // Records the span of its own lifetime. A null tracer records nothing, like a disabled one.
+    class TimeScope
+    {
+    public:
+        TimeScope(TimeTracer* const tracer, std::string name);
+        // Function spans are only recorded for the trace file. `createDetail` is not called
+        // otherwise, so per-function names cost nothing in a normal build.
+        TimeScope(
+            TimeTracer* const tracer,
+            std::string name,
+            const std::function<std::string()>& createDetail
+        );
+        TimeScope(const TimeScope&) = delete;
+        ~TimeScope();
+
+        auto operator=(const TimeScope&) -> TimeScope& = delete;
+
+    private:
+        TimeTracer* m_Tracer{};
+        TimeTraceEvent m_Event{};
+    };
+}
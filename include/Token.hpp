@@ -3,46 +3,54 @@
 #include <memory>
 #include <string>
 #include <string_view>
+#include <cstdint>
 
 #include "SrcLocation.hpp"
 #include "TokenKind.hpp"
 
 namespace Ace
 {
+    class ISrcBuffer;
+
+    // A lexed token as it is stored. Its characters and string are recovered from the buffer it was
+    // lexed from, so a token owns no memory.
     struct Token
     {
-        Token()
-            : String{},
-              SrcLocation{},
-              Kind{}
-        {
-        }
-
-        Token(const SrcLocation& srcLocation, const TokenKind kind)
-            : SrcLocation{ srcLocation },
-              Kind{ kind },
-              String{}
-
-        {
-        }
-
-        Token(const SrcLocation& srcLocation, const TokenKind kind, const std::string& string)
-            : SrcLocation{ srcLocation },
-              Kind{ kind },
-              String{ string }
-        {
-        }
+        static auto Create(
+            const SrcLocation& srcLocation,
+            const TokenKind kind,
+            const size_t stringLength = 0
+        ) -> Token;
+
+        auto CreateSrcLocation(const ISrcBuffer* const buffer) const -> SrcLocation;
+        // Identifier name, numeric literal digits or string literal contents, empty otherwise.
+        auto GetString(const ISrcBuffer* const buffer) const -> std::string_view;
+
+        TokenKind Kind{};
+        uint32_t CharacterBeginIndex{};
+        uint32_t CharacterLength{};
+        uint32_t StringLength{};
+    };
 
+    // A token with its location and string resolved, as the parser consumes it.
+    struct TokenView
+    {
         SrcLocation SrcLocation{};
         TokenKind Kind{};
-        std::string String{};
+        std::string_view String{};
     };
 
     auto operator==(const Token& token, const TokenKind kind) -> bool;
-    auto operator==(const Token& token, const std::string_view string) -> bool;
+    auto operator==(const TokenView& token, const TokenKind kind) -> bool;
+    auto operator==(const TokenView& token, const std::string_view string) -> bool;
 
     template <typename T> auto operator!=(const Token& token, T&& value) -> bool
     {
         return !(token == value);
     }
+
+    template <typename T> auto operator!=(const TokenView& token, T&& value) -> bool
+    {
+        return !(token == value);
+    }
 }
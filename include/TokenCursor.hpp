@@ -0,0 +1,79 @@
+#pragma once
+
+#include <vector>
+#include <span>
+#include <optional>
+#include <cstddef>
+
+#include "Token.hpp"
+#include "Lexer.hpp"
+#include "Diagnostic.hpp"
+#include "FileBuffer.hpp"
+#include "TokenQueue.hpp"
+
+namespace Ace
+{
+    // Walks the tokens of one file through a ring buffer that is refilled as the cursor
+    // advances, so the tokens of a whole file are never held at once. The buffer only grows past
+    // its initial capacity when a peek looks further ahead than it holds, and never past
+    // `MaxCapacity`. Tokens are either lexed on demand or read in place from a pre-lexed range that
+    // ends with `EndOfFile`, or taken from a `TokenQueue` that another thread lexes into.
+    class TokenCursor
+    {
+    public:
+        static constexpr size_t InitialCapacity = 256;
+        static constexpr size_t MaxCapacity = 4 * 1024;
+        static_assert((InitialCapacity & (InitialCapacity - 1)) == 0);
+        static_assert((MaxCapacity & (MaxCapacity - 1)) == 0);
+        static_assert(MaxCapacity >= InitialCapacity);
+
+        TokenCursor(const FileBuffer* const fileBuffer);
+        TokenCursor(const FileBuffer* const fileBuffer, const std::span<const Token> tokens);
+        TokenCursor(TokenQueue* const queue);
+        ~TokenCursor() = default;
+
+        auto GetFileBuffer() const -> const FileBuffer*;
+
+        auto IsEnd() const -> bool;
+        // `distance` must be less than `MaxCapacity`.
+        auto Peek(const size_t distance = 0) const -> const Token&;
+        // Kind of the token `distance` ahead, for speculative scans that may look further ahead
+        // than the buffer can hold. Tokens past a full buffer are lexed again from its end and not
+        // kept, so such a scan costs no memory, and a scan that looks one token further at a time
+        // lexes each token once.
+        auto PeekKind(const size_t distance) const -> TokenKind;
+        auto Eat() -> Token;
+
+        // Lexes what is left of the file, so lexing diagnostics cover all of it, and returns them.
+        auto TakeDiagnostics() -> DiagnosticBag;
+
+        // Number of tokens the ring buffer holds. Peeking further ahead grows it, up to
+        // `MaxCapacity`.
+        auto GetCapacity() const -> size_t;
+
+    private:
+        auto Grow(const size_t minCapacity) const -> void;
+        auto Refill() const -> void;
+        auto ReadNext() const -> Token;
+        auto ScanTo(const size_t tokenIndex) const -> TokenKind;
+
+        const FileBuffer* m_FileBuffer{};
+        std::span<const Token> m_Tokens{};
+        TokenQueue* m_Queue{};
+        mutable std::vector<Token> m_QueueChunk{};
+        // Peeking refills the buffer, which does not move the cursor.
+        mutable std::optional<TokenStream> m_OptStream{};
+        mutable size_t m_TokenIndex{};
+        mutable std::vector<Token> m_Buffer = std::vector<Token>(InitialCapacity);
+        mutable size_t m_BeginIndex{};
+        mutable size_t m_Count{};
+        mutable bool m_IsEndRead{};
+        size_t m_EatenCount{};
+        // Lexes past a full buffer for `PeekKind`. Its last token is the one at `m_ScanIndex`,
+        // counted from the beginning of the file.
+        mutable std::optional<TokenStream> m_OptScanStream{};
+        mutable size_t m_ScanIndex{};
+        mutable Token m_ScanToken{};
+        mutable DiagnosticBag m_Diagnostics = DiagnosticBag::Create();
+    };
+}
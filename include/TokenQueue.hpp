@@ -0,0 +1,51 @@
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <cstddef>
+
+#include "Token.hpp"
+#include "Diagnostic.hpp"
+#include "FileBuffer.hpp"
+
+namespace Ace
+{
+    // Hands the tokens of one file from a lexing thread to the parsing thread in chunks. The
+    // lexing thread waits while `MaxChunkCount` chunks are unread, so the tokens held for a file
+    // stay bounded however far ahead of the parser it is lexed.
+    class TokenQueue
+    {
+    public:
+        static constexpr size_t ChunkSize = 1024;
+        static constexpr size_t MaxChunkCount = 4;
+
+        TokenQueue(const FileBuffer* const fileBuffer);
+        TokenQueue(const TokenQueue&) = delete;
+        ~TokenQueue() = default;
+
+        auto operator=(const TokenQueue&) -> TokenQueue& = delete;
+
+        auto GetFileBuffer() const -> const FileBuffer*;
+
+        // Lexes the whole file into the queue. Called once, from the lexing thread.
+        auto Fill() -> void;
+
+        // Waits for the next chunk. The last chunk ends with `EndOfFile`.
+        auto TakeChunk() -> std::vector<Token>;
+        // Waits until the whole file is lexed and returns its lexing diagnostics.
+        auto TakeDiagnostics() -> DiagnosticBag;
+
+    private:
+        auto AddChunk(std::vector<Token> chunk) -> void;
+
+        const FileBuffer* m_FileBuffer{};
+        std::mutex m_Mutex{};
+        std::condition_variable m_ChunkAddedCondition{};
+        std::condition_variable m_ChunkTakenCondition{};
+        std::deque<std::vector<Token>> m_Chunks{};
+        bool m_IsFilled{};
+        DiagnosticBag m_Diagnostics = DiagnosticBag::Create();
+    };
+}
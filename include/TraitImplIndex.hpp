@@ -0,0 +1,35 @@
+#pragma once
+
+#include <vector>
+#include <map>
+#include <utility>
+
+namespace Ace
+{
+    class ISymbol;
+    class ITypeSymbol;
+    class TraitTypeSymbol;
+    class TraitImplSymbol;
+
+    // Compilation-wide index of trait impls by trait root and type root. Impls for a type
+    // parameter can apply to any type, so they are kept per trait root instead.
+    class TraitImplIndex
+    {
+    public:
+        auto Add(TraitImplSymbol* const impl) -> void;
+        auto Remove(TraitImplSymbol* const impl) -> void;
+        auto Clear() -> void;
+
+        // Returns every impl that may be an impl of `trait` for `type`, which callers still
+        // confirm with `DoPlaceholdersOverlap`.
+        auto CollectCandidates(TraitTypeSymbol* const trait, ITypeSymbol* const type) const
+            -> std::vector<TraitImplSymbol*>;
+
+    private:
+        auto CollectBucket(TraitImplSymbol* const impl) -> std::vector<TraitImplSymbol*>&;
+
+        std::map<std::pair<ISymbol*, ISymbol*>, std::vector<TraitImplSymbol*>>
+            m_TraitAndTypeRootToImplsMap{};
+        std::map<ISymbol*, std::vector<TraitImplSymbol*>> m_TraitRootToPlaceholderImplsMap{};
+    };
+}
@@ -1,10 +1,12 @@
 #include "AnonymousIdent.hpp"
 
 #include <string>
+#include <optional>
 
 namespace Ace::AnonymousIdent
 {
     static size_t Counter = 0;
+    static thread_local PrefixScope* CurrentPrefixScope = nullptr;
 
     auto Concat() -> std::string
     {
@@ -13,6 +15,42 @@ namespace Ace::AnonymousIdent
 
     auto Create() -> std::string
     {
+        if (CurrentPrefixScope)
+        {
+            auto optLocal = CurrentPrefixScope->CreateLocal();
+            if (optLocal.has_value())
+            {
+                return std::move(optLocal.value());
+            }
+        }
+
         return "?" + std::to_string(Counter++);
     }
+
+    auto ResetCounter() -> void
+    {
+        Counter = 0;
+    }
+
+    PrefixScope::PrefixScope(std::optional<std::string> optPrefix)
+        : m_OptPrefix{ std::move(optPrefix) },
+          m_OuterScope{ CurrentPrefixScope }
+    {
+        CurrentPrefixScope = this;
+    }
+
+    PrefixScope::~PrefixScope()
+    {
+        CurrentPrefixScope = m_OuterScope;
+    }
+
+    auto PrefixScope::CreateLocal() -> std::optional<std::string>
+    {
+        if (!m_OptPrefix.has_value())
+        {
+            return std::nullopt;
+        }
+
+        return Concat(m_OptPrefix.value(), std::to_string(m_Counter++));
+    }
 }
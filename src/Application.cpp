@@ -7,16 +7,28 @@
 #include <fstream>
 #include <chrono>
 #include <map>
+#include <optional>
+#include <sstream>
+#include <iomanip>
+#include <span>
+#include <thread>
+#include <atomic>
 #include <llvm/Support/TargetSelect.h>
 
 #include "Log.hpp"
 #include "Compilation.hpp"
 #include "FileBuffer.hpp"
 #include "Std.hpp"
+#include "StdImage.hpp"
 #include "DynamicCastFilter.hpp"
 #include "Scope.hpp"
+#include "TokenCursor.hpp"
+#include "TokenQueue.hpp"
 #include "Parser.hpp"
+#include "SyntaxArena.hpp"
 #include "FunctionBlockBinding.hpp"
+#include "BindingSpeculation.hpp"
+#include "GenericInstantiator.hpp"
 #include "SymbolParentBinding.hpp"
 #include "Emitter.hpp"
 #include "Syntaxes/All.hpp"
@@ -24,6 +36,13 @@
 #include "Semas/All.hpp"
 #include "Diagnostic.hpp"
 #include "GlueGeneration.hpp"
+#include "Parallel.hpp"
+#include "TimeTrace.hpp"
+#include "BuildCache.hpp"
+#include "CompileServer.hpp"
+#include "DiagnosticLog.hpp"
+#include "AnonymousIdent.hpp"
+#include "InternedString.hpp"
 #include "Diagnoses/InvalidControlFlowDiagnosis.hpp"
 #include "Diagnoses/LayoutCycleDiagnosis.hpp"
 #include "Diagnoses/OrphanDiagnosis.hpp"
@@ -42,10 +61,10 @@ namespace Ace::Application
         return std::string(IndentLevel, ' ');
     }
 
-    auto CollectSyntaxes(const std::shared_ptr<const ISyntax>& ast) -> std::vector<const ISyntax*>
+    auto CollectSyntaxes(const ISyntax* const ast) -> std::vector<const ISyntax*>
     {
         auto syntaxes = ast->CollectChildren();
-        syntaxes.push_back(ast.get());
+        syntaxes.push_back(ast);
         return syntaxes;
     }
 
@@ -135,59 +154,379 @@ namespace Ace::Application
         return Diagnosed{ std::move(block), std::move(diagnostics) };
     }
 
-    static auto CreateAndBindFunctionBlock(FunctionBlockBinding binding) -> Diagnosed<void>
+    static auto CreateFunctionBlock(
+        const FunctionBlockBinding& binding, const std::string& identPrefix
+    ) -> Diagnosed<std::shared_ptr<const BlockStmtSema>>
     {
         auto diagnostics = DiagnosticBag::Create();
 
-        if (!binding.OptBlockSyntax.has_value())
+        // Labels and temporaries are numbered per function, so they do not depend on which
+        // thread binds the body or on how often it is bound.
+        const AnonymousIdent::PrefixScope prefixScope{ identPrefix };
+
+        const auto block = diagnostics.Collect(CreateVerifiedFunctionBlock(
+            diagnostics.Collect(binding.OptBlockSyntax.value()->CreateSema()),
+            binding.Symbol->GetType()
+        ));
+
+        return Diagnosed{ block, std::move(diagnostics) };
+    }
+
+    struct SpeculativeFunctionBlock
+    {
+        std::optional<std::shared_ptr<const BlockStmtSema>> OptBlock{};
+        DiagnosticBag Diagnostics = DiagnosticBag::Create();
+        std::optional<SpeculationAbort> OptAbort{};
+    };
+
+    static auto CreateSpeculativeFunctionBlock(
+        const FunctionBlockBinding& binding, const std::string& identPrefix
+    ) -> SpeculativeFunctionBlock
+    {
+        BindingSpeculation speculation{ binding.Symbol->GetBodyScope() };
+
+        try
         {
-            return Diagnosed<void>{ std::move(diagnostics) };
+            auto diagnostics = DiagnosticBag::Create();
+            auto block = diagnostics.Collect(CreateFunctionBlock(binding, identPrefix));
+
+            return SpeculativeFunctionBlock{
+                std::move(block),
+                std::move(diagnostics),
+                std::nullopt,
+            };
         }
+        catch (const SpeculationAbort& abort)
+        {
+            speculation.Rollback();
 
-        auto* const symbol = binding.Symbol;
-        if (symbol->GetBlockSema().has_value())
+            return SpeculativeFunctionBlock{ std::nullopt, DiagnosticBag::Create(), abort };
+        }
+    }
+
+    // Returns false when the instance cannot be created. Instantiation only reports errors, so
+    // the binding is then redone on this thread, which reports them where they belong.
+    static auto CreateRequestedInstance(const InstantiationRequest& request) -> bool
+    {
+        const auto& context = request.Context;
+
+        const auto optInstance =
+            GenericInstantiator::FindInstance(request.Root, context.TypeArgs, context.OptSelfType);
+        if (optInstance.has_value())
+        {
+            return true;
+        }
+
+        return DiagnosticBag::Create()
+            .Collect(GenericInstantiator::Instantiate(request.SrcLocation, request.Root, context))
+            .has_value();
+    }
+
+    // Speculative rounds after which the bodies that still abort are bound on this thread.
+    static constexpr size_t MaxSpeculativeBindingRoundCount = 4;
+
+    auto CreateAndBindFunctionBodies(const std::vector<FunctionBlockBinding>& bindings)
+        -> Diagnosed<void>
+    {
+        auto diagnostics = DiagnosticBag::Create();
+
+        if (bindings.empty())
         {
             return Diagnosed<void>{ std::move(diagnostics) };
         }
 
-        const auto& blockSyntax = binding.OptBlockSyntax.value();
+        auto* const compilation = bindings.front().Symbol->GetCompilation();
 
-        const auto block = diagnostics.Collect(CreateVerifiedFunctionBlock(
-            diagnostics.Collect(blockSyntax->CreateSema()), symbol->GetType()
-        ));
+        std::vector<DiagnosticBag> bindingDiagnostics{};
+        std::vector<std::optional<std::shared_ptr<const BlockStmtSema>>> blocks{};
+        std::vector<std::string> identPrefixes{};
+        std::vector<size_t> pendingIndices{};
+        for (size_t i = 0; i < bindings.size(); i++)
+        {
+            bindingDiagnostics.push_back(DiagnosticBag::Create());
+            blocks.push_back(std::nullopt);
+            identPrefixes.push_back({});
+
+            const auto& binding = bindings.at(i);
+            if (binding.OptBlockSyntax.has_value() && !binding.Symbol->GetBlockSema().has_value())
+            {
+                identPrefixes.at(i) = AnonymousIdent::Create();
+                pendingIndices.push_back(i);
+            }
+        }
+
+        const auto bindBlockOnThisThread = [&](const size_t index) -> void
+        {
+            const TimeScope timeScope{
+                compilation->GetTimeTracer(),
+                "Bind function",
+                [&]() { return bindings.at(index).Symbol->CreateSignature(); },
+            };
+
+            blocks.at(index) = bindingDiagnostics.at(index).Collect(
+                CreateFunctionBlock(bindings.at(index), identPrefixes.at(index))
+            );
+        };
+
+        // Bodies are bound speculatively on up to `-j` threads, see `BindingSpeculation`. The
+        // instances that aborted bindings asked for are then created here in binding order, and
+        // those bindings are retried in the next round. Every round starts from the state the
+        // previous one left, whatever the thread count, so names, diagnostics and emission order
+        // are the same for any `-j`.
+        for (size_t round = 0;
+             (round < MaxSpeculativeBindingRoundCount) && (pendingIndices.size() > 1);
+             round++)
+        {
+            std::vector<SpeculativeFunctionBlock> speculativeBlocks(pendingIndices.size());
+            ParallelFor(
+                compilation->GetJobCount(),
+                pendingIndices.size(),
+                [&](const size_t i)
+                {
+                    const auto& binding = bindings.at(pendingIndices.at(i));
+
+                    const TimeScope timeScope{
+                        compilation->GetTimeTracer(),
+                        "Bind function",
+                        [&]() { return binding.Symbol->CreateSignature(); },
+                    };
+
+                    speculativeBlocks.at(i) = CreateSpeculativeFunctionBlock(
+                        binding, identPrefixes.at(pendingIndices.at(i))
+                    );
+                }
+            );
 
-        symbol->BindBlockSema(block);
+            std::vector<size_t> abortedIndices{};
+            for (size_t i = 0; i < pendingIndices.size(); i++)
+            {
+                const auto index = pendingIndices.at(i);
+                auto& speculativeBlock = speculativeBlocks.at(i);
+
+                if (!speculativeBlock.OptAbort.has_value())
+                {
+                    blocks.at(index) = std::move(speculativeBlock.OptBlock);
+                    bindingDiagnostics.at(index) = std::move(speculativeBlock.Diagnostics);
+                    continue;
+                }
+
+                const auto& optRequest = speculativeBlock.OptAbort.value().OptInstantiationRequest;
+                if (optRequest.has_value() && CreateRequestedInstance(optRequest.value()))
+                {
+                    abortedIndices.push_back(index);
+                    continue;
+                }
+
+                bindBlockOnThisThread(index);
+            }
 
-        auto* const compilation = symbol->GetCompilation();
+            pendingIndices = std::move(abortedIndices);
+        }
 
-        const bool isVoid = symbol->GetType()->GetUnaliased() == compilation->GetVoidTypeSymbol();
+        std::for_each(begin(pendingIndices), end(pendingIndices), bindBlockOnThisThread);
 
-        if (!isVoid)
+        for (size_t i = 0; i < bindings.size(); i++)
         {
-            diagnostics.Collect(DiagnoseInvalidControlFlow(
-                symbol->GetName().SrcLocation,
-                ControlFlowGraph{ block->CreateControlFlowInstructions() }
-            ));
+            auto& optBlock = blocks.at(i);
+            if (!optBlock.has_value())
+            {
+                continue;
+            }
+
+            auto* const symbol = bindings.at(i).Symbol;
+            symbol->BindBlockSema(optBlock.value());
+
+            const bool isVoid =
+                symbol->GetType()->GetUnaliased() == compilation->GetVoidTypeSymbol();
+            if (isVoid)
+            {
+                optBlock = std::nullopt;
+            }
         }
 
+        ParallelFor(
+            compilation->GetJobCount(),
+            bindings.size(),
+            [&](const size_t i)
+            {
+                const auto& optBlock = blocks.at(i);
+                if (!optBlock.has_value())
+                {
+                    return;
+                }
+
+                // The signature was cached by the binding loop above, so this only reads it.
+                const TimeScope timeScope{
+                    compilation->GetTimeTracer(),
+                    "Validate control flow",
+                    [&]() { return bindings.at(i).Symbol->CreateSignature(); },
+                };
+
+                bindingDiagnostics.at(i).Collect(DiagnoseInvalidControlFlow(
+                    bindings.at(i).Symbol->GetName().SrcLocation,
+                    ControlFlowGraph{ optBlock.value()->CreateControlFlowInstructions() }
+                ));
+            }
+        );
+
+        std::for_each(
+            begin(bindingDiagnostics),
+            end(bindingDiagnostics),
+            [&](DiagnosticBag& blockDiagnostics)
+            {
+                diagnostics.Add(std::move(blockDiagnostics));
+            }
+        );
+
         return Diagnosed<void>{ std::move(diagnostics) };
     }
 
-    auto CreateAndBindFunctionBodies(const std::vector<FunctionBlockBinding>& bindings)
-        -> Diagnosed<void>
+    template <typename TFunction>
+    static auto TimePhase(
+        Compilation* const compilation,
+        std::string name,
+        TFunction&& function
+    ) -> decltype(function())
     {
-        auto diagnostics = DiagnosticBag::Create();
+        const TimeScope timeScope{ compilation->GetTimeTracer(), std::move(name) };
+        return function();
+    }
 
+    static auto PrintSymbolCacheSummary(Compilation* const compilation) -> void
+    {
+        if (!compilation->GetTimeTracer()->IsSummaryEnabled())
+        {
+            return;
+        }
+
+        const auto symbols = compilation->GetGlobalScope()->CollectAllSymbolsRecursive();
+
+        SymbolCacheStats stats{};
         std::for_each(
-            begin(bindings),
-            end(bindings),
-            [&](const FunctionBlockBinding& binding)
+            begin(symbols),
+            end(symbols),
+            [&](ISymbol* const symbol)
             {
-                diagnostics.Collect(CreateAndBindFunctionBlock(binding));
+                symbol->CollectCacheStats(stats);
             }
         );
 
-        return Diagnosed<void>{ std::move(diagnostics) };
+        const auto indent = CreateIndent();
+
+        Out << indent << termcolor::bright_green << "Memory";
+        Out << termcolor::reset << " summary\n";
+
+        std::ostringstream lineStream{};
+        lineStream << std::left << std::setw(48) << "  Symbol caches";
+        lineStream << std::right << std::fixed << std::setprecision(1);
+        lineStream << std::setw(12) << (static_cast<double>(stats.ByteSize) / 1024.0) << " KiB";
+        lineStream << "  (" << stats.CachedStringCount << " strings, " << stats.SymbolCount;
+        lineStream << " symbols)";
+
+        Out << indent << lineStream.str() << "\n";
+    }
+
+    struct SrcFile
+    {
+        std::string PackageName{};
+        const FileBuffer* Buffer{};
+    };
+
+    static auto ParseASTs(
+        Compilation* const compilation,
+        SyntaxArena* const syntaxArena,
+        const std::vector<SrcFile>& srcFiles
+    ) -> Diagnosed<std::vector<const ModSyntax*>>
+    {
+        auto diagnostics = DiagnosticBag::Create();
+
+        // Std files take their tokens from the build-time image. With more than one job, other
+        // files are lexed on up to `-j` minus one worker threads into bounded per-file queues, in
+        // file order, while this thread parses. Otherwise they are lexed while they are parsed.
+        // Parsing builds the shared scope tree and stays in file order on this thread, which keeps
+        // declaration order and diagnostics identical to a serial front-end.
+        std::vector<std::optional<std::span<const Token>>> optFileImageTokens{};
+        std::transform(
+            begin(srcFiles),
+            end(srcFiles),
+            back_inserter(optFileImageTokens),
+            [&](const SrcFile& srcFile)
+            {
+                return Std::FindImageTokens(srcFile.Buffer);
+            }
+        );
+
+        std::vector<std::unique_ptr<TokenQueue>> tokenQueues(srcFiles.size());
+        std::vector<std::thread> lexingThreads{};
+        std::atomic<size_t> nextLexedFileIndex = 0;
+        if (compilation->GetJobCount() > 1)
+        {
+            for (size_t i = 0; i < srcFiles.size(); i++)
+            {
+                if (!optFileImageTokens.at(i).has_value())
+                {
+                    tokenQueues.at(i) = std::make_unique<TokenQueue>(srcFiles.at(i).Buffer);
+                }
+            }
+
+            // Each worker takes the next file in order, so the file being parsed always has a
+            // worker, and a worker only waits for the parser to drain its own file's queue.
+            const auto lexFiles = [&]() -> void
+            {
+                for (auto i = nextLexedFileIndex++; i < srcFiles.size();
+                     i = nextLexedFileIndex++)
+                {
+                    if (tokenQueues.at(i))
+                    {
+                        tokenQueues.at(i)->Fill();
+                    }
+                }
+            };
+
+            for (size_t i = 1; i < compilation->GetJobCount(); i++)
+            {
+                lexingThreads.emplace_back(lexFiles);
+            }
+        }
+
+        std::vector<const ModSyntax*> asts{};
+        for (size_t i = 0; i < srcFiles.size(); i++)
+        {
+            const auto& srcFile = srcFiles.at(i);
+
+            auto tokenCursor = [&]() -> TokenCursor
+            {
+                if (optFileImageTokens.at(i).has_value())
+                {
+                    return TokenCursor{ srcFile.Buffer, optFileImageTokens.at(i).value() };
+                }
+
+                if (tokenQueues.at(i))
+                {
+                    return TokenCursor{ tokenQueues.at(i).get() };
+                }
+
+                return TokenCursor{ srcFile.Buffer };
+            }();
+
+            // Parsing reads every token of the file, so its queue is drained afterwards.
+            const auto optAST = diagnostics.Collect(
+                ParseAST(syntaxArena, srcFile.PackageName, srcFile.Buffer, std::move(tokenCursor))
+            );
+            if (!optAST.has_value())
+            {
+                continue;
+            }
+
+            asts.push_back(optAST.value());
+        }
+
+        for (auto& lexingThread : lexingThreads)
+        {
+            lexingThread.join();
+        }
+
+        return Diagnosed{ std::move(asts), std::move(diagnostics) };
     }
 
     static auto CompileCompilation(Compilation* const compilation) -> Expected<void>
@@ -196,76 +535,137 @@ namespace Ace::Application
 
         const auto globalScope = compilation->GetGlobalScope();
 
-        std::vector<std::shared_ptr<const ModSyntax>> asts{};
+        // Syntax trees are only used while compiling, so their nodes are all freed together when
+        // this returns.
+        SyntaxArena syntaxArena{};
 
         const auto stdFileBuffers = Std::CreateFileBuffers(compilation);
-        std::for_each(
+
+        std::vector<SrcFile> srcFiles{};
+        std::transform(
             begin(stdFileBuffers),
             end(stdFileBuffers),
+            back_inserter(srcFiles),
             [&](const std::shared_ptr<const FileBuffer>& fileBuffer)
             {
-                const auto optAST = diagnostics.Collect(ParseAST(Std::GetName(), fileBuffer.get()));
-                if (!optAST.has_value())
-                {
-                    return;
-                }
-
-                asts.push_back(optAST.value());
+                return SrcFile{ Std::GetName(), fileBuffer.get() };
             }
         );
-
-        std::for_each(
+        std::transform(
             begin(compilation->GetPackage().SrcFileBuffers),
             end(compilation->GetPackage().SrcFileBuffers),
+            back_inserter(srcFiles),
             [&](const FileBuffer* const fileBuffer)
             {
-                const auto optAST =
-                    diagnostics.Collect(ParseAST(compilation->GetPackage().Name, fileBuffer));
-                if (!optAST.has_value())
-                {
-                    return;
-                }
-
-                asts.push_back(optAST.value());
+                return SrcFile{ compilation->GetPackage().Name, fileBuffer };
             }
         );
 
+        const auto asts = diagnostics.Collect(TimePhase(
+            compilation,
+            "Lex and parse",
+            [&]() { return ParseASTs(compilation, &syntaxArena, srcFiles); }
+        ));
+
         std::vector<const ISyntax*> syntaxes{};
         std::for_each(
             begin(asts),
             end(asts),
-            [&](const std::shared_ptr<const ModSyntax>& ast)
+            [&](const ModSyntax* const ast)
             {
                 const auto children = CollectSyntaxes(ast);
                 syntaxes.insert(end(syntaxes), begin(children), end(children));
             }
         );
 
-        const auto functionBlockBindings = diagnostics.Collect(CreateAndDeclareSymbols(syntaxes));
-        BindSymbolParents(globalScope);
-        diagnostics.Collect(DiagnosePublicInterfaceLeaks(compilation));
-        diagnostics.Collect(
-            globalScope->GetGenericInstantiator().InstantiateBodies(functionBlockBindings)
+        const auto functionBlockBindings = diagnostics.Collect(TimePhase(
+            compilation,
+            "Declare symbols",
+            [&]() { return CreateAndDeclareSymbols(syntaxes); }
+        ));
+        TimePhase(
+            compilation,
+            "Bind symbol parents",
+            [&]() { BindSymbolParents(globalScope); }
         );
+        diagnostics.Collect(TimePhase(
+            compilation,
+            "Diagnose public interface leaks",
+            [&]() { return DiagnosePublicInterfaceLeaks(compilation); }
+        ));
+        diagnostics.Collect(TimePhase(
+            compilation,
+            "Instantiate generic bodies",
+            [&]()
+            {
+                return globalScope->GetGenericInstantiator().InstantiateBodies(
+                    functionBlockBindings
+                );
+            }
+        ));
 
-        diagnostics.Collect(compilation->GetNatives().Verify());
+        diagnostics.Collect(TimePhase(
+            compilation,
+            "Verify natives",
+            [&]() { return compilation->GetNatives().Verify(); }
+        ));
         if (diagnostics.HasErrors())
         {
             return std::move(diagnostics);
         }
 
-        diagnostics.Collect(CreateAndBindFunctionBodies(functionBlockBindings));
+        diagnostics.Collect(TimePhase(
+            compilation,
+            "Bind function bodies",
+            [&]() { return CreateAndBindFunctionBodies(functionBlockBindings); }
+        ));
 
-        globalScope->GetGenericInstantiator().InstantiateReferencedMonos();
-        GlueGeneration::GenerateAndBindGlue(compilation);
-        globalScope->GetGenericInstantiator().InstantiateReferencedMonos();
+        TimePhase(
+            compilation,
+            "Instantiate monos",
+            [&]() { globalScope->GetGenericInstantiator().InstantiateReferencedMonos(); }
+        );
+        TimePhase(
+            compilation,
+            "Generate glue",
+            [&]() { GlueGeneration::GenerateAndBindGlue(compilation); }
+        );
+        TimePhase(
+            compilation,
+            "Instantiate monos",
+            [&]() { globalScope->GetGenericInstantiator().InstantiateReferencedMonos(); }
+        );
 
-        diagnostics.Collect(DiagnoseLayoutCycles(compilation));
-        diagnostics.Collect(DiagnoseOrphans(compilation));
-        diagnostics.Collect(DiagnoseInvalidTraitImpls(compilation));
-        diagnostics.Collect(DiagnoseOverlappingInherentImpls(compilation));
-        diagnostics.Collect(DiagnoseConcreteConstraints(compilation));
-        diagnostics.Collect(DiagnoseUnimplementedSupertraits(compilation));
+        diagnostics.Collect(TimePhase(
+            compilation,
+            "Diagnose layout cycles",
+            [&]() { return DiagnoseLayoutCycles(compilation); }
+        ));
+        diagnostics.Collect(TimePhase(
+            compilation,
+            "Diagnose orphans",
+            [&]() { return DiagnoseOrphans(compilation); }
+        ));
+        diagnostics.Collect(TimePhase(
+            compilation,
+            "Diagnose invalid trait impls",
+            [&]() { return DiagnoseInvalidTraitImpls(compilation); }
+        ));
+        diagnostics.Collect(TimePhase(
+            compilation,
+            "Diagnose overlapping inherent impls",
+            [&]() { return DiagnoseOverlappingInherentImpls(compilation); }
+        ));
+        diagnostics.Collect(TimePhase(
+            compilation,
+            "Diagnose concrete constraints",
+            [&]() { return DiagnoseConcreteConstraints(compilation); }
+        ));
+        diagnostics.Collect(TimePhase(
+            compilation,
+            "Diagnose unimplemented supertraits",
+            [&]() { return DiagnoseUnimplementedSupertraits(compilation); }
+        ));
 
         if (diagnostics.HasErrors())
         {
@@ -273,7 +673,11 @@ namespace Ace::Application
         }
 
         Emitter emitter{ compilation };
-        const auto didEmit = diagnostics.Collect(emitter.Emit());
+        const auto didEmit = diagnostics.Collect(TimePhase(
+            compilation,
+            "Emit",
+            [&]() { return emitter.Emit(); }
+        ));
         if (!didEmit)
         {
             return std::move(diagnostics);
@@ -302,8 +706,29 @@ namespace Ace::Application
         Out << optCompilation.value()->GetPackage().Name << "\n";
         IndentLevel++;
 
-        const auto didCompile =
-            diagnostics.Collect(CompileCompilation(optCompilation.value().get()));
+        auto* const compilation = optCompilation.value().get();
+
+        const auto optInputHash = compilation->IsUsingBuildCache()
+                                      ? std::optional{ BuildCache::CreateInputHash(compilation) }
+                                      : std::nullopt;
+        if (optInputHash.has_value() && BuildCache::IsUpToDate(compilation, optInputHash.value()))
+        {
+            Out << CreateIndent() << termcolor::bright_green << "Finished";
+            Out << termcolor::reset << " compilation (up to date)\n";
+            IndentLevel++;
+
+            return Void{ std::move(diagnostics) };
+        }
+
+        const auto didCompile = diagnostics.Collect(CompileCompilation(compilation));
+
+        compilation->GetTimeTracer()->PrintSummary(IndentLevel);
+        PrintSymbolCacheSummary(compilation);
+
+        auto timeTraceDiagnostics = DiagnosticBag::CreateGlobal();
+        timeTraceDiagnostics.Collect(compilation->GetTimeTracer()->WriteTraceFile());
+        diagnostics.Add(std::move(timeTraceDiagnostics));
+
         if (!didCompile || diagnostics.HasErrors())
         {
             Out << CreateIndent() << termcolor::bright_red << "Failed";
@@ -313,6 +738,12 @@ namespace Ace::Application
             return std::move(diagnostics);
         }
 
+        // Warnings are reported again on every compilation, so only clean compilations are cached.
+        if (optInputHash.has_value() && diagnostics.IsEmpty())
+        {
+            BuildCache::StoreInputHash(compilation, optInputHash.value());
+        }
+
         Out << CreateIndent() << termcolor::bright_green << "Finished";
         Out << termcolor::reset << " compilation\n";
         IndentLevel++;
@@ -320,16 +751,99 @@ namespace Ace::Application
         return Void{ std::move(diagnostics) };
     }
 
+    struct ServerArgs
+    {
+        std::string_view SocketPath{};
+        std::vector<std::string_view> CompileArgs{};
+    };
+
+    // `--daemon` and `--connect` select the process mode, so they must come before the compiler
+    // options, either as `--<name>=<socket>` or as `--<name> <socket>`.
+    static auto ParseServerArgs(
+        const std::vector<std::string_view>& args,
+        const std::string_view optionName
+    ) -> std::optional<ServerArgs>
+    {
+        if (args.empty() || !args.front().starts_with("--"))
+        {
+            return std::nullopt;
+        }
+
+        const auto arg = args.front().substr(2);
+        if (!arg.starts_with(optionName))
+        {
+            return std::nullopt;
+        }
+
+        const auto value = arg.substr(optionName.size());
+        if (value.starts_with('='))
+        {
+            return ServerArgs{ value.substr(1), { begin(args) + 1, end(args) } };
+        }
+
+        if (value.empty() && (args.size() > 1))
+        {
+            return ServerArgs{ args.at(1), { begin(args) + 2, end(args) } };
+        }
+
+        return std::nullopt;
+    }
+
+    static auto CompileToExitCode(const std::vector<std::string_view>& args) -> int
+    {
+        if (!Compile(args))
+        {
+            return 1;
+        }
+
+        return 0;
+    }
+
+    // Compilations on the server must print exactly what a fresh process would, so process-wide
+    // state touched by a compilation starts over for each request. That includes the interned
+    // strings: the previous compilation and every handle into it are gone by now, and IDs decide
+    // hash map order, so they must be assigned as in a fresh process.
+    static auto CompileOnServer(const std::vector<std::string_view>& args) -> int
+    {
+        IndentLevel = 3;
+        ResetDiagnosticLog();
+        AnonymousIdent::ResetCounter();
+        ResetInternedStrings();
+
+        return CompileToExitCode(args);
+    }
+
     auto Main(const std::vector<std::string_view>& args) -> int
     {
+        const auto optConnectArgs = ParseServerArgs(args, "connect");
+        if (optConnectArgs.has_value())
+        {
+            auto diagnostics = DiagnosticBag::CreateGlobal();
+            const auto optExitCode = diagnostics.Collect(CompileServer::Connect(
+                optConnectArgs.value().SocketPath, optConnectArgs.value().CompileArgs
+            ));
+
+            return optExitCode.value_or(1);
+        }
+
         llvm::InitializeNativeTarget();
         llvm::InitializeNativeTargetAsmPrinter();
 
-        if (!Compile(args))
+        const auto optDaemonArgs = ParseServerArgs(args, "daemon");
+        if (optDaemonArgs.has_value())
         {
+            Out << CreateIndent() << termcolor::bright_green << "Listening";
+            Out << termcolor::reset << " on " << optDaemonArgs.value().SocketPath << "\n";
+            Out << std::flush;
+
+            auto diagnostics = DiagnosticBag::CreateGlobal();
+            diagnostics.Collect(CompileServer::Serve(
+                optDaemonArgs.value().SocketPath, &CompileOnServer
+            ));
+
             return 1;
         }
 
-        return 0;
+        return CompileToExitCode(args);
     }
 }
@@ -0,0 +1,100 @@
+#include "BindingSpeculation.hpp"
+
+#include <memory>
+#include <algorithm>
+#include <vector>
+#include <optional>
+
+#include "Assert.hpp"
+#include "SrcLocation.hpp"
+#include "Scope.hpp"
+#include "Symbols/Symbol.hpp"
+
+namespace Ace
+{
+    static thread_local BindingSpeculation* CurrentSpeculation = nullptr;
+
+    BindingSpeculation::BindingSpeculation(const std::shared_ptr<Scope>& bodyScope)
+        : m_BodyScope{ bodyScope }
+    {
+        ACE_ASSERT(!CurrentSpeculation);
+        CurrentSpeculation = this;
+    }
+
+    BindingSpeculation::~BindingSpeculation()
+    {
+        CurrentSpeculation = nullptr;
+    }
+
+    auto BindingSpeculation::OnInstantiate(
+        const SrcLocation& srcLocation,
+        IGenericSymbol* const root,
+        const InstantiationContext& context
+    ) -> void
+    {
+        if (!CurrentSpeculation)
+        {
+            return;
+        }
+
+        throw SpeculationAbort{ InstantiationRequest{ srcLocation, root, context } };
+    }
+
+    auto BindingSpeculation::OnDeclareSymbol(ISymbol* const symbol) -> void
+    {
+        if (!CurrentSpeculation)
+        {
+            return;
+        }
+
+        if (!CurrentSpeculation->IsOwnScope(symbol->GetScope().get()))
+        {
+            throw SpeculationAbort{};
+        }
+
+        CurrentSpeculation->m_DeclaredSymbols.push_back(symbol);
+    }
+
+    auto BindingSpeculation::OnCreateChild(const Scope* const scope) -> void
+    {
+        if (!CurrentSpeculation)
+        {
+            return;
+        }
+
+        if (!CurrentSpeculation->IsOwnScope(scope))
+        {
+            throw SpeculationAbort{};
+        }
+    }
+
+    auto BindingSpeculation::Rollback() -> void
+    {
+        std::for_each(
+            rbegin(m_DeclaredSymbols),
+            rend(m_DeclaredSymbols),
+            [](ISymbol* const symbol)
+            {
+                Scope::RemoveSymbol(symbol);
+            }
+        );
+
+        m_DeclaredSymbols.clear();
+    }
+
+    auto BindingSpeculation::IsOwnScope(const Scope* const scope) const -> bool
+    {
+        // Callers of the function read its parameters from the body scope itself, so only the
+        // scopes below it belong to the binding.
+        for (auto optParent = scope->GetParent(); optParent.has_value();
+             optParent = optParent.value()->GetParent())
+        {
+            if (optParent.value() == m_BodyScope)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+}
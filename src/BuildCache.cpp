@@ -0,0 +1,231 @@
+#include "BuildCache.hpp"
+
+#include <vector>
+#include <string>
+#include <string_view>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <cstdint>
+#include <llvm/Support/xxhash.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/ADT/StringRef.h>
+
+#include "Compilation.hpp"
+#include "FileBuffer.hpp"
+#include "CLIArgBuffer.hpp"
+
+namespace Ace::BuildCache
+{
+    auto Hasher::Add(const std::string_view string) -> void
+    {
+        AddValue(string.size());
+        AddValue(llvm::xxHash64(llvm::StringRef{ string.data(), string.size() }));
+    }
+
+    auto Hasher::AddValue(const uint64_t value) -> void
+    {
+        m_Hashes.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    auto Hasher::Finish() const -> uint64_t
+    {
+        return llvm::xxHash64(llvm::StringRef{ m_Hashes });
+    }
+
+    static auto AddFileStatus(Hasher& hasher, const std::string& path) -> void
+    {
+        hasher.Add(path);
+
+        llvm::sys::fs::file_status status{};
+        if (llvm::sys::fs::status(path, status))
+        {
+            hasher.AddValue(0);
+            return;
+        }
+
+        hasher.AddValue(status.getSize());
+        hasher.AddValue(llvm::sys::toTimeT(status.getLastModificationTime()));
+    }
+
+    static auto CreateCacheDirectoryPath(const Compilation* const compilation)
+        -> std::filesystem::path
+    {
+        return compilation->GetOutputPath() / ".ace-cache";
+    }
+
+    static auto ReadHash(const std::filesystem::path& path) -> std::optional<uint64_t>
+    {
+        std::ifstream stream{ path };
+        if (!stream)
+        {
+            return std::nullopt;
+        }
+
+        uint64_t hash{};
+        if (!(stream >> std::hex >> hash))
+        {
+            return std::nullopt;
+        }
+
+        return hash;
+    }
+
+    static auto WriteHash(const std::filesystem::path& path, const uint64_t hash) -> void
+    {
+        std::error_code errorCode{};
+        std::filesystem::create_directories(path.parent_path(), errorCode);
+
+        std::ofstream stream{ path };
+        stream << std::hex << hash << "\n";
+    }
+
+    static auto GetCachedArtifactKinds() -> const std::vector<ArtifactKind>&
+    {
+        static const std::vector<ArtifactKind> artifactKinds{
+            ArtifactKind::Exe,
+            ArtifactKind::Obj,
+            ArtifactKind::Bc,
+            ArtifactKind::Ll,
+            ArtifactKind::OptLl,
+            ArtifactKind::Sema,
+        };
+
+        return artifactKinds;
+    }
+
+    auto CreateInputHash(const Compilation* const compilation) -> uint64_t
+    {
+        Hasher hasher{};
+
+        // The compiler's own size and modification time stand in for its version, so rebuilding
+        // the compiler invalidates every cache without hashing the binary.
+        AddFileStatus(hasher, llvm::sys::fs::getMainExecutable(nullptr, nullptr));
+
+        hasher.Add(compilation->GetCLIArgBuffer()->GetBuffer());
+        hasher.Add(compilation->GetPackageFileBuffer()->GetBuffer());
+
+        const auto& package = compilation->GetPackage();
+        std::for_each(
+            begin(package.SrcFileBuffers),
+            end(package.SrcFileBuffers),
+            [&](const FileBuffer* const fileBuffer)
+            {
+                hasher.Add(fileBuffer->GetPath().string());
+                hasher.Add(fileBuffer->GetBuffer());
+            }
+        );
+        std::for_each(
+            begin(package.DepFilePaths),
+            end(package.DepFilePaths),
+            [&](const std::filesystem::path& depFilePath)
+            {
+                AddFileStatus(hasher, depFilePath.string());
+            }
+        );
+
+        return hasher.Finish();
+    }
+
+    auto IsUpToDate(const Compilation* const compilation, const uint64_t inputHash) -> bool
+    {
+        const auto inputHashPath =
+            CreateCacheDirectoryPath(compilation) / (compilation->GetPackage().Name + ".inputs");
+
+        const auto optStoredInputHash = ReadHash(inputHashPath);
+        if (!optStoredInputHash.has_value() || (optStoredInputHash.value() != inputHash))
+        {
+            return false;
+        }
+
+        const auto& artifactKinds = GetCachedArtifactKinds();
+        return std::all_of(
+            begin(artifactKinds),
+            end(artifactKinds),
+            [&](const ArtifactKind artifactKind)
+            {
+                return !compilation->IsEmitting(artifactKind) ||
+                       std::filesystem::exists(compilation->CreateArtifactPath(artifactKind));
+            }
+        );
+    }
+
+    auto StoreInputHash(const Compilation* const compilation, const uint64_t inputHash) -> void
+    {
+        const auto inputHashPath =
+            CreateCacheDirectoryPath(compilation) / (compilation->GetPackage().Name + ".inputs");
+
+        WriteHash(inputHashPath, inputHash);
+    }
+
+    auto TryRestoreObjectFile(
+        const Compilation* const compilation,
+        const std::string& unitName,
+        const uint64_t moduleHash,
+        const std::filesystem::path& objectFilePath
+    ) -> bool
+    {
+        const auto cacheDirectoryPath = CreateCacheDirectoryPath(compilation);
+
+        const auto optStoredModuleHash = ReadHash(cacheDirectoryPath / (unitName + ".hash"));
+        if (!optStoredModuleHash.has_value() || (optStoredModuleHash.value() != moduleHash))
+        {
+            return false;
+        }
+
+        std::error_code errorCode{};
+        std::filesystem::copy_file(
+            cacheDirectoryPath / (unitName + ".o"),
+            objectFilePath,
+            std::filesystem::copy_options::overwrite_existing,
+            errorCode
+        );
+
+        return !errorCode;
+    }
+
+    auto StoreObjectFile(
+        const Compilation* const compilation,
+        const std::string& unitName,
+        const uint64_t moduleHash,
+        const std::filesystem::path& objectFilePath
+    ) -> void
+    {
+        const auto cacheDirectoryPath = CreateCacheDirectoryPath(compilation);
+
+        const auto hashPath = cacheDirectoryPath / (unitName + ".hash");
+        const auto cachedObjectFilePath = cacheDirectoryPath / (unitName + ".o");
+        const auto tempObjectFilePath = cacheDirectoryPath / (unitName + ".o.tmp");
+
+        // The old hash is removed before the object is replaced and the new hash is only written
+        // once the new object is in place, so an interrupted store leaves the unit uncached
+        // instead of pairing a hash with an object of another module.
+        std::error_code errorCode{};
+        std::filesystem::create_directories(cacheDirectoryPath, errorCode);
+        std::filesystem::remove(hashPath, errorCode);
+        if (errorCode)
+        {
+            return;
+        }
+
+        std::filesystem::copy_file(
+            objectFilePath,
+            tempObjectFilePath,
+            std::filesystem::copy_options::overwrite_existing,
+            errorCode
+        );
+        if (errorCode)
+        {
+            return;
+        }
+
+        std::filesystem::rename(tempObjectFilePath, cachedObjectFilePath, errorCode);
+        if (errorCode)
+        {
+            std::filesystem::remove(tempObjectFilePath, errorCode);
+            return;
+        }
+
+        WriteHash(hashPath, moduleHash);
+    }
+}
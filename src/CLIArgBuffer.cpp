@@ -4,6 +4,8 @@
 #include <string>
 #include <string_view>
 #include <utility>
+#include <algorithm>
+#include <iterator>
 
 namespace Ace
 {
@@ -56,6 +58,21 @@ namespace Ace
         return {};
     }
 
+    auto CLIArgBuffer::FindLine(const std::string_view::const_iterator characterIt) const
+        -> std::string_view
+    {
+        const std::string_view bufferView = m_Buffer;
+
+        const auto lineBeginIt = std::find(
+            std::make_reverse_iterator(characterIt),
+            std::make_reverse_iterator(begin(bufferView)),
+            '\n'
+        );
+        const auto lineEndIt = std::find(characterIt, end(bufferView), '\n');
+
+        return std::string_view{ lineBeginIt.base(), lineEndIt };
+    }
+
     auto CLIArgBuffer::GetArgs() const -> const std::vector<std::string_view>&
     {
         return m_Args;
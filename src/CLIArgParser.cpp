@@ -308,7 +308,7 @@ namespace Ace
             end(parser.GetOptionDefinitions()),
             [&](const CLIOptionDefinition* const optionDefinition)
             {
-                if (optionDefinition->OptDefaultValue.has_value())
+                if (!optionDefinition->OptDefaultValue.has_value())
                 {
                     return;
                 }
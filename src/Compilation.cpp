@@ -2,13 +2,17 @@
 
 #include <memory>
 #include <vector>
+#include <set>
 #include <string>
 #include <optional>
 #include <unordered_map>
 #include <filesystem>
+#include <charconv>
 
+#include "Assert.hpp"
 #include "Diagnostic.hpp"
 #include "Diagnostics/CompilationDiagnostics.hpp"
+#include "Diagnostics/CLIArgDiagnostics.hpp"
 #include "SrcBuffer.hpp"
 #include "FileBuffer.hpp"
 #include "CLIArgBuffer.hpp"
@@ -19,6 +23,7 @@
 #include "Scope.hpp"
 #include "Symbols/Types/VoidTypeSymbol.hpp"
 #include "ErrorSymbols.hpp"
+#include "TimeTrace.hpp"
 
 namespace Ace
 {
@@ -29,13 +34,188 @@ namespace Ace
         "build/",
     };
 
+    static const CLIOptionDefinition JobCountOptionDefinition{
+        std::string_view{ "j" },
+        std::string_view{ "jobs" },
+        CLIOptionKind::WithValue,
+        "1",
+    };
+
+    static const CLIOptionDefinition OptimizationLevelOptionDefinition{
+        std::string_view{ "O" },
+        std::string_view{ "optimize" },
+        CLIOptionKind::WithValue,
+        "3",
+    };
+
+    static const CLIOptionDefinition CodegenUnitCountOptionDefinition{
+        std::nullopt,
+        std::string_view{ "codegen-units" },
+        CLIOptionKind::WithValue,
+        "1",
+    };
+
+    static const CLIOptionDefinition EmitOptionDefinition{
+        std::nullopt,
+        std::string_view{ "emit" },
+        CLIOptionKind::WithValue,
+        "exe",
+    };
+
+    static const CLIOptionDefinition NoCacheOptionDefinition{
+        std::nullopt,
+        std::string_view{ "no-cache" },
+        CLIOptionKind::WithoutValue,
+        std::nullopt,
+    };
+
+    static const CLIOptionDefinition TimeOptionDefinition{
+        std::nullopt,
+        std::string_view{ "time" },
+        CLIOptionKind::WithoutValue,
+        std::nullopt,
+    };
+
+    static const CLIOptionDefinition TimeTraceOptionDefinition{
+        std::nullopt,
+        std::string_view{ "time-trace" },
+        CLIOptionKind::WithValue,
+        std::nullopt,
+    };
+
     static auto GetOptionDefinitions() -> std::vector<const CLIOptionDefinition*>
     {
         return {
             &OutputPathOptionDefinition,
+            &JobCountOptionDefinition,
+            &OptimizationLevelOptionDefinition,
+            &CodegenUnitCountOptionDefinition,
+            &EmitOptionDefinition,
+            &NoCacheOptionDefinition,
+            &TimeOptionDefinition,
+            &TimeTraceOptionDefinition,
         };
     }
 
+    static auto ParsePositiveCount(
+        const CLIArgBuffer* const argBuffer,
+        const std::string_view value,
+        const std::string& expected
+    ) -> Expected<size_t>
+    {
+        auto diagnostics = DiagnosticBag::Create();
+
+        size_t count{};
+        const auto result = std::from_chars(value.data(), value.data() + value.size(), count);
+
+        const bool isValid = (result.ec == std::errc{}) &&
+                             (result.ptr == (value.data() + value.size())) && (count != 0);
+        if (!isValid)
+        {
+            const SrcLocation srcLocation{
+                argBuffer,
+                begin(value),
+                end(value),
+            };
+
+            diagnostics.Add(CreateInvalidCLIOptionValueError(srcLocation, expected));
+            return std::move(diagnostics);
+        }
+
+        return Expected{ count, std::move(diagnostics) };
+    }
+
+    static auto ParseOptimizationLevel(
+        const CLIArgBuffer* const argBuffer,
+        const std::string_view value
+    ) -> Expected<OptimizationLevel>
+    {
+        auto diagnostics = DiagnosticBag::Create();
+
+        static const std::unordered_map<std::string_view, OptimizationLevel> levelMap{
+            { "0", OptimizationLevel::O0 },
+            { "1", OptimizationLevel::O1 },
+            { "2", OptimizationLevel::O2 },
+            { "3", OptimizationLevel::O3 },
+            { "s", OptimizationLevel::Os },
+        };
+
+        const auto matchingLevelIt = levelMap.find(value);
+        if (matchingLevelIt == end(levelMap))
+        {
+            const SrcLocation srcLocation{
+                argBuffer,
+                begin(value),
+                end(value),
+            };
+
+            diagnostics.Add(
+                CreateInvalidCLIOptionValueError(srcLocation, "`0`, `1`, `2`, `3` or `s`")
+            );
+            return std::move(diagnostics);
+        }
+
+        return Expected{ matchingLevelIt->second, std::move(diagnostics) };
+    }
+
+    static auto ParseArtifactKinds(
+        const CLIArgBuffer* const argBuffer,
+        const std::string_view value
+    ) -> Expected<std::set<ArtifactKind>>
+    {
+        auto diagnostics = DiagnosticBag::Create();
+
+        static const std::unordered_map<std::string_view, ArtifactKind> kindMap{
+            { "exe", ArtifactKind::Exe },
+            { "obj", ArtifactKind::Obj },
+            { "bc", ArtifactKind::Bc },
+            { "ll", ArtifactKind::Ll },
+            { "opt-ll", ArtifactKind::OptLl },
+            { "sema", ArtifactKind::Sema },
+        };
+
+        std::set<ArtifactKind> artifactKinds{};
+
+        auto nameBeginIt = begin(value);
+        while (true)
+        {
+            const auto nameEndIt = std::find(nameBeginIt, end(value), ',');
+            const std::string_view name{ nameBeginIt, nameEndIt };
+
+            const auto matchingKindIt = kindMap.find(name);
+            if (matchingKindIt == end(kindMap))
+            {
+                const SrcLocation srcLocation{
+                    argBuffer,
+                    nameBeginIt,
+                    nameEndIt,
+                };
+
+                diagnostics.Add(CreateInvalidCLIOptionValueError(
+                    srcLocation, "`exe`, `obj`, `bc`, `ll`, `opt-ll` or `sema`"
+                ));
+            }
+            else
+            {
+                artifactKinds.insert(matchingKindIt->second);
+            }
+
+            if (nameEndIt == end(value))
+            {
+                break;
+            }
+
+            nameBeginIt = nameEndIt + 1;
+        }
+
+        if (diagnostics.HasErrors())
+        {
+            return std::move(diagnostics);
+        }
+
+        return Expected{ std::move(artifactKinds), std::move(diagnostics) };
+    }
+
     auto Compilation::Parse(
         std::vector<std::shared_ptr<const ISrcBuffer>>* const srcBuffers,
         const std::vector<std::string_view>& args
@@ -83,6 +263,71 @@ namespace Ace
             );
         }
 
+        const auto optJobCount = diagnostics.Collect(ParsePositiveCount(
+            self->m_CLIArgBuffer,
+            optionMap.at(&JobCountOptionDefinition).OptValue.value(),
+            "a positive job count"
+        ));
+        if (!optJobCount.has_value())
+        {
+            return std::move(diagnostics);
+        }
+
+        self->m_JobCount = optJobCount.value();
+
+        const auto optOptimizationLevel = diagnostics.Collect(ParseOptimizationLevel(
+            self->m_CLIArgBuffer,
+            optionMap.at(&OptimizationLevelOptionDefinition).OptValue.value()
+        ));
+        if (!optOptimizationLevel.has_value())
+        {
+            return std::move(diagnostics);
+        }
+
+        self->m_OptimizationLevel = optOptimizationLevel.value();
+
+        const auto codegenUnitCountValue =
+            optionMap.at(&CodegenUnitCountOptionDefinition).OptValue.value();
+        if (codegenUnitCountValue == "file")
+        {
+            self->m_IsSplittingCodegenUnitsByFile = true;
+        }
+        else
+        {
+            const auto optCodegenUnitCount = diagnostics.Collect(ParsePositiveCount(
+                self->m_CLIArgBuffer,
+                codegenUnitCountValue,
+                "a positive codegen unit count or `file`"
+            ));
+            if (!optCodegenUnitCount.has_value())
+            {
+                return std::move(diagnostics);
+            }
+
+            self->m_CodegenUnitCount = optCodegenUnitCount.value();
+        }
+
+        auto optArtifactKinds = diagnostics.Collect(ParseArtifactKinds(
+            self->m_CLIArgBuffer, optionMap.at(&EmitOptionDefinition).OptValue.value()
+        ));
+        if (!optArtifactKinds.has_value())
+        {
+            return std::move(diagnostics);
+        }
+
+        self->m_ArtifactKinds = std::move(optArtifactKinds.value());
+        self->m_IsUsingBuildCache = !optionMap.contains(&NoCacheOptionDefinition);
+
+        const auto timeTraceOptionIt = optionMap.find(&TimeTraceOptionDefinition);
+        const auto optTraceFilePath = (timeTraceOptionIt != end(optionMap)) ?
+            std::optional<std::filesystem::path>{ timeTraceOptionIt->second.OptValue.value() } :
+            std::optional<std::filesystem::path>{};
+
+        self->m_TimeTracer = std::make_unique<TimeTracer>(
+            optionMap.contains(&TimeOptionDefinition),
+            optTraceFilePath
+        );
+
         const auto packagePath = positionalArgs.front();
 
         auto optPackageFileBuffer = diagnostics.Collect(FileBuffer::Read(self.get(), packagePath));
@@ -94,8 +339,12 @@ namespace Ace
         self->m_PackageFileBuffer = optPackageFileBuffer.value().get();
         srcBuffers->push_back(std::move(optPackageFileBuffer.value()));
 
-        auto optPackage =
-            diagnostics.Collect(Package::Parse(srcBuffers, self->m_PackageFileBuffer));
+        std::optional<Package> optPackage{};
+        {
+            const TimeScope timeScope{ self->GetTimeTracer(), "Read package" };
+            optPackage =
+                diagnostics.Collect(Package::Parse(srcBuffers, self->m_PackageFileBuffer));
+        }
         if (!optPackage.has_value())
         {
             return std::move(diagnostics);
@@ -154,6 +403,94 @@ namespace Ace
         return m_OutputPath;
     }
 
+    auto Compilation::GetJobCount() const -> size_t
+    {
+        return m_JobCount;
+    }
+
+    auto Compilation::GetOptimizationLevel() const -> OptimizationLevel
+    {
+        return m_OptimizationLevel;
+    }
+
+    auto Compilation::GetCodegenUnitCount() const -> size_t
+    {
+        return m_CodegenUnitCount;
+    }
+
+    auto Compilation::IsSplittingCodegenUnitsByFile() const -> bool
+    {
+        return m_IsSplittingCodegenUnitsByFile;
+    }
+
+    auto Compilation::IsEmitting(const ArtifactKind artifactKind) const -> bool
+    {
+        return m_ArtifactKinds.contains(artifactKind);
+    }
+
+    static auto GetArtifactExtension(const ArtifactKind artifactKind) -> std::string_view
+    {
+        switch (artifactKind)
+        {
+            case ArtifactKind::Exe:
+            {
+                return "";
+            }
+
+            case ArtifactKind::Obj:
+            {
+                return "obj";
+            }
+
+            case ArtifactKind::Bc:
+            {
+                return "bc";
+            }
+
+            case ArtifactKind::Ll:
+            {
+                return "ll";
+            }
+
+            case ArtifactKind::OptLl:
+            {
+                return "opt.ll";
+            }
+
+            case ArtifactKind::Sema:
+            {
+                return "sema";
+            }
+        }
+
+        ACE_UNREACHABLE();
+    }
+
+    auto Compilation::CreateArtifactPath(const ArtifactKind artifactKind) const
+        -> std::filesystem::path
+    {
+        std::string fileName{ m_Package.Name };
+
+        const auto extension = GetArtifactExtension(artifactKind);
+        if (!extension.empty())
+        {
+            fileName += ".";
+            fileName += extension;
+        }
+
+        return m_OutputPath / fileName;
+    }
+
+    auto Compilation::IsUsingBuildCache() const -> bool
+    {
+        return m_IsUsingBuildCache;
+    }
+
+    auto Compilation::GetTimeTracer() const -> TimeTracer*
+    {
+        return m_TimeTracer.get();
+    }
+
     auto Compilation::GetGlobalScope() const -> const std::shared_ptr<Scope>&
     {
         return m_GlobalScope.Unwrap();
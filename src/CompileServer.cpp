@@ -0,0 +1,621 @@
+#include "CompileServer.hpp"
+
+#include <vector>
+#include <string>
+#include <string_view>
+#include <optional>
+#include <filesystem>
+#include <iostream>
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <cerrno>
+#include <csignal>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+
+#include "Diagnostic.hpp"
+#include "Diagnostics/CompileServerDiagnostics.hpp"
+
+namespace Ace::CompileServer
+{
+    // A request is a message carrying the client's stdout and stderr descriptors, followed by two
+    // lists of length-prefixed strings, each preceded by its string count: the client's working
+    // directory and args, then the client's environment. The response is the exit code as a 32-bit
+    // integer.
+    static constexpr size_t PassedFileDescriptorCount = 2;
+
+    // Any local client can connect, so the strings of a request are bounded. Requests over either
+    // limit are dropped before anything is allocated for them.
+    static constexpr uint32_t MaxRequestStringCount = 64 * 1024;
+    static constexpr size_t MaxRequestByteSize = 64 * 1024 * 1024;
+
+    // Clients are served one at a time and send their whole request right after connecting, so a
+    // client that stops sending is dropped instead of stalling every later request.
+    static constexpr time_t ClientReceiveTimeoutSeconds = 5;
+
+    class FileDescriptor
+    {
+    public:
+        FileDescriptor() = default;
+        explicit FileDescriptor(const int value)
+            : m_Value{ value }
+        {
+        }
+        FileDescriptor(const FileDescriptor&) = delete;
+        ~FileDescriptor()
+        {
+            if (m_Value != -1)
+            {
+                close(m_Value);
+            }
+        }
+
+        auto operator=(const FileDescriptor&) -> FileDescriptor& = delete;
+
+        auto Get() const -> int
+        {
+            return m_Value;
+        }
+
+    private:
+        int m_Value = -1;
+    };
+
+    static auto CreateErrorMessage() -> std::string
+    {
+        return std::strerror(errno);
+    }
+
+    static auto CreateSocketAddress(const std::filesystem::path& socketPath)
+        -> std::optional<sockaddr_un>
+    {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+
+        const auto& socketPathString = socketPath.native();
+        if (socketPathString.size() >= sizeof(address.sun_path))
+        {
+            return std::nullopt;
+        }
+
+        std::memcpy(address.sun_path, socketPathString.c_str(), socketPathString.size() + 1);
+        return address;
+    }
+
+    // Removes a socket file left behind by a server that is gone, which would make `bind` fail.
+    // Returns why the path cannot be used when it is taken by anything else: a file that is not a
+    // socket, or the socket of a server that still accepts connections.
+    static auto RemoveStaleSocket(
+        const std::filesystem::path& socketPath,
+        const sockaddr_un& address
+    ) -> std::optional<std::string>
+    {
+        struct stat status{};
+        if (lstat(socketPath.c_str(), &status) == -1)
+        {
+            if (errno == ENOENT)
+            {
+                return std::nullopt;
+            }
+
+            return CreateErrorMessage();
+        }
+
+        if (!S_ISSOCK(status.st_mode))
+        {
+            return "path exists and is not a socket";
+        }
+
+        const FileDescriptor probeSocket{ socket(AF_UNIX, SOCK_STREAM, 0) };
+        if (probeSocket.Get() == -1)
+        {
+            return CreateErrorMessage();
+        }
+
+        const auto connectResult = connect(
+            probeSocket.Get(),
+            reinterpret_cast<const sockaddr*>(&address),
+            sizeof(address)
+        );
+        if (connectResult != -1)
+        {
+            return "another compile server is listening on it";
+        }
+
+        if (errno != ECONNREFUSED)
+        {
+            return CreateErrorMessage();
+        }
+
+        if (unlink(socketPath.c_str()) == -1)
+        {
+            return CreateErrorMessage();
+        }
+
+        return std::nullopt;
+    }
+
+    static auto SendAll(const int socket, const void* const data, const size_t size) -> bool
+    {
+        const auto* const bytes = static_cast<const char*>(data);
+
+        size_t sentSize = 0;
+        while (sentSize < size)
+        {
+            const auto result = send(socket, bytes + sentSize, size - sentSize, 0);
+            if (result <= 0)
+            {
+                if ((result == -1) && (errno == EINTR))
+                {
+                    continue;
+                }
+
+                return false;
+            }
+
+            sentSize += static_cast<size_t>(result);
+        }
+
+        return true;
+    }
+
+    static auto ReceiveAll(const int socket, void* const data, const size_t size) -> bool
+    {
+        auto* const bytes = static_cast<char*>(data);
+
+        size_t receivedSize = 0;
+        while (receivedSize < size)
+        {
+            const auto result = recv(socket, bytes + receivedSize, size - receivedSize, 0);
+            if (result <= 0)
+            {
+                if ((result == -1) && (errno == EINTR))
+                {
+                    continue;
+                }
+
+                return false;
+            }
+
+            receivedSize += static_cast<size_t>(result);
+        }
+
+        return true;
+    }
+
+    static auto SendStrings(const int socket, const std::vector<std::string_view>& strings) -> bool
+    {
+        const auto count = static_cast<uint32_t>(strings.size());
+        if (!SendAll(socket, &count, sizeof(count)))
+        {
+            return false;
+        }
+
+        return std::all_of(
+            begin(strings),
+            end(strings),
+            [&](const std::string_view string)
+            {
+                const auto size = static_cast<uint32_t>(string.size());
+                return SendAll(socket, &size, sizeof(size)) &&
+                       SendAll(socket, string.data(), string.size());
+            }
+        );
+    }
+
+    static auto ReceiveStrings(const int socket) -> std::optional<std::vector<std::string>>
+    {
+        uint32_t count{};
+        if (!ReceiveAll(socket, &count, sizeof(count)) || (count > MaxRequestStringCount))
+        {
+            return std::nullopt;
+        }
+
+        size_t byteSize = 0;
+        std::vector<std::string> strings{};
+        for (uint32_t i = 0; i < count; i++)
+        {
+            uint32_t size{};
+            if (!ReceiveAll(socket, &size, sizeof(size)))
+            {
+                return std::nullopt;
+            }
+
+            byteSize += size;
+            if (byteSize > MaxRequestByteSize)
+            {
+                return std::nullopt;
+            }
+
+            std::string string(size, '\0');
+            if (!ReceiveAll(socket, string.data(), size))
+            {
+                return std::nullopt;
+            }
+
+            strings.push_back(std::move(string));
+        }
+
+        return strings;
+    }
+
+    static auto SendFileDescriptors(
+        const int socket,
+        const std::array<int, PassedFileDescriptorCount>& fileDescriptors
+    ) -> bool
+    {
+        char payload{};
+        iovec payloadVector{ &payload, sizeof(payload) };
+
+        alignas(cmsghdr) char control[CMSG_SPACE(sizeof(fileDescriptors))]{};
+
+        msghdr message{};
+        message.msg_iov = &payloadVector;
+        message.msg_iovlen = 1;
+        message.msg_control = control;
+        message.msg_controllen = sizeof(control);
+
+        auto* const controlMessage = CMSG_FIRSTHDR(&message);
+        controlMessage->cmsg_level = SOL_SOCKET;
+        controlMessage->cmsg_type = SCM_RIGHTS;
+        controlMessage->cmsg_len = CMSG_LEN(sizeof(fileDescriptors));
+        std::memcpy(CMSG_DATA(controlMessage), fileDescriptors.data(), sizeof(fileDescriptors));
+
+        return sendmsg(socket, &message, 0) == sizeof(payload);
+    }
+
+    // The kernel installs passed descriptors as soon as the message is received, so a rejected
+    // message has to close them or the server leaks them.
+    static auto CloseReceivedFileDescriptors(msghdr& message) -> void
+    {
+        auto* controlMessage = CMSG_FIRSTHDR(&message);
+        for (; controlMessage; controlMessage = CMSG_NXTHDR(&message, controlMessage))
+        {
+            const bool isFileDescriptorMessage = (controlMessage->cmsg_level == SOL_SOCKET) &&
+                                                 (controlMessage->cmsg_type == SCM_RIGHTS);
+            if (!isFileDescriptorMessage)
+            {
+                continue;
+            }
+
+            const auto count = (controlMessage->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+            for (size_t i = 0; i < count; i++)
+            {
+                int fileDescriptor{};
+                std::memcpy(
+                    &fileDescriptor,
+                    CMSG_DATA(controlMessage) + (i * sizeof(int)),
+                    sizeof(fileDescriptor)
+                );
+                close(fileDescriptor);
+            }
+        }
+    }
+
+    static auto ReceiveFileDescriptors(const int socket)
+        -> std::optional<std::array<int, PassedFileDescriptorCount>>
+    {
+        char payload{};
+        iovec payloadVector{ &payload, sizeof(payload) };
+
+        std::array<int, PassedFileDescriptorCount> fileDescriptors{};
+        alignas(cmsghdr) char control[CMSG_SPACE(sizeof(fileDescriptors))]{};
+
+        msghdr message{};
+        message.msg_iov = &payloadVector;
+        message.msg_iovlen = 1;
+        message.msg_control = control;
+        message.msg_controllen = sizeof(control);
+
+        const auto receivedSize = recvmsg(socket, &message, 0);
+        if (receivedSize == -1)
+        {
+            return std::nullopt;
+        }
+
+        const auto* const controlMessage = CMSG_FIRSTHDR(&message);
+        const bool isFileDescriptorMessage = (receivedSize == sizeof(payload)) &&
+                                             controlMessage &&
+                                             (controlMessage->cmsg_level == SOL_SOCKET) &&
+                                             (controlMessage->cmsg_type == SCM_RIGHTS) &&
+                                             (controlMessage->cmsg_len ==
+                                              CMSG_LEN(sizeof(fileDescriptors)));
+        if (!isFileDescriptorMessage)
+        {
+            CloseReceivedFileDescriptors(message);
+            return std::nullopt;
+        }
+
+        std::memcpy(fileDescriptors.data(), CMSG_DATA(controlMessage), sizeof(fileDescriptors));
+        return fileDescriptors;
+    }
+
+    static auto SetEnvironment(const std::vector<std::string>& environment) -> void
+    {
+        clearenv();
+
+        std::for_each(
+            begin(environment),
+            end(environment),
+            [&](const std::string& variable)
+            {
+                const auto separatorIndex = variable.find('=');
+                if ((separatorIndex == std::string::npos) || (separatorIndex == 0))
+                {
+                    return;
+                }
+
+                setenv(
+                    variable.substr(0, separatorIndex).c_str(),
+                    variable.substr(separatorIndex + 1).c_str(),
+                    1
+                );
+            }
+        );
+    }
+
+    // Replaces the process environment with the client's for the duration of one request, so child
+    // processes such as the linker find the same tools as in the client's process.
+    class ClientEnvironmentScope
+    {
+    public:
+        explicit ClientEnvironmentScope(const std::vector<std::string>& environment)
+        {
+            for (char** variable = environ; *variable; variable++)
+            {
+                m_SavedEnvironment.emplace_back(*variable);
+            }
+
+            SetEnvironment(environment);
+        }
+        ClientEnvironmentScope(const ClientEnvironmentScope&) = delete;
+        ~ClientEnvironmentScope()
+        {
+            SetEnvironment(m_SavedEnvironment);
+        }
+
+        auto operator=(const ClientEnvironmentScope&) -> ClientEnvironmentScope& = delete;
+
+    private:
+        std::vector<std::string> m_SavedEnvironment{};
+    };
+
+    static auto FlushOutput() -> void
+    {
+        std::cout.flush();
+        std::cerr.flush();
+        std::fflush(stdout);
+        std::fflush(stderr);
+    }
+
+    // Points stdout and stderr at the client's descriptors for the duration of one request, so
+    // terminal detection, colors and child process output behave as in the client's process.
+    static auto CompileWithClientOutput(
+        const std::array<int, PassedFileDescriptorCount>& clientFileDescriptors,
+        const std::vector<std::string_view>& args,
+        const CompileFunction& compile
+    ) -> int
+    {
+        FlushOutput();
+
+        const FileDescriptor savedStdout{ dup(STDOUT_FILENO) };
+        const FileDescriptor savedStderr{ dup(STDERR_FILENO) };
+        dup2(clientFileDescriptors.at(0), STDOUT_FILENO);
+        dup2(clientFileDescriptors.at(1), STDERR_FILENO);
+
+        const auto exitCode = compile(args);
+
+        FlushOutput();
+
+        dup2(savedStdout.Get(), STDOUT_FILENO);
+        dup2(savedStderr.Get(), STDERR_FILENO);
+
+        return exitCode;
+    }
+
+    static auto IsClientOfServerUser(const int clientSocket) -> bool
+    {
+        ucred credentials{};
+        socklen_t credentialsSize = sizeof(credentials);
+        const auto result = getsockopt(
+            clientSocket,
+            SOL_SOCKET,
+            SO_PEERCRED,
+            &credentials,
+            &credentialsSize
+        );
+        if (result == -1)
+        {
+            return false;
+        }
+
+        return credentials.uid == geteuid();
+    }
+
+    static auto SetReceiveTimeout(const int socket) -> bool
+    {
+        const timeval timeout{ ClientReceiveTimeoutSeconds, 0 };
+        return setsockopt(socket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)) != -1;
+    }
+
+    static auto ServeClient(const int clientSocket, const CompileFunction& compile) -> void
+    {
+        if (!IsClientOfServerUser(clientSocket) || !SetReceiveTimeout(clientSocket))
+        {
+            return;
+        }
+
+        const auto optClientFileDescriptors = ReceiveFileDescriptors(clientSocket);
+        if (!optClientFileDescriptors.has_value())
+        {
+            return;
+        }
+
+        const FileDescriptor clientStdout{ optClientFileDescriptors.value().at(0) };
+        const FileDescriptor clientStderr{ optClientFileDescriptors.value().at(1) };
+
+        const auto optStrings = ReceiveStrings(clientSocket);
+        if (!optStrings.has_value() || optStrings.value().empty())
+        {
+            return;
+        }
+
+        const auto optEnvironment = ReceiveStrings(clientSocket);
+        if (!optEnvironment.has_value())
+        {
+            return;
+        }
+
+        const auto& strings = optStrings.value();
+
+        std::error_code errorCode{};
+        std::filesystem::current_path(strings.front(), errorCode);
+        if (errorCode)
+        {
+            return;
+        }
+
+        const std::vector<std::string_view> args{ begin(strings) + 1, end(strings) };
+
+        const ClientEnvironmentScope environmentScope{ optEnvironment.value() };
+        const auto exitCode = static_cast<int32_t>(
+            CompileWithClientOutput(optClientFileDescriptors.value(), args, compile)
+        );
+        SendAll(clientSocket, &exitCode, sizeof(exitCode));
+    }
+
+    auto Serve(const std::filesystem::path& socketPath, const CompileFunction& compile)
+        -> Expected<void>
+    {
+        auto diagnostics = DiagnosticBag::Create();
+
+        const auto optAddress = CreateSocketAddress(socketPath);
+        if (!optAddress.has_value())
+        {
+            diagnostics.Add(CreateCompileServerListenError(socketPath, "path is too long"));
+            return std::move(diagnostics);
+        }
+
+        const FileDescriptor serverSocket{ socket(AF_UNIX, SOCK_STREAM, 0) };
+        if (serverSocket.Get() == -1)
+        {
+            diagnostics.Add(CreateCompileServerListenError(socketPath, CreateErrorMessage()));
+            return std::move(diagnostics);
+        }
+
+        const auto& address = optAddress.value();
+
+        const auto optStaleSocketError = RemoveStaleSocket(socketPath, address);
+        if (optStaleSocketError.has_value())
+        {
+            diagnostics.Add(
+                CreateCompileServerListenError(socketPath, optStaleSocketError.value())
+            );
+            return std::move(diagnostics);
+        }
+
+        // A request runs the compiler and the tools it spawns with the client's environment and
+        // writes wherever the client asks, so the socket is created for the server's user only.
+        const auto previousFileModeMask = umask(S_IRWXG | S_IRWXO);
+        const bool isBound = bind(
+                                 serverSocket.Get(),
+                                 reinterpret_cast<const sockaddr*>(&address),
+                                 sizeof(address)
+                             ) != -1;
+        umask(previousFileModeMask);
+
+        const bool isListening = isBound && (listen(serverSocket.Get(), SOMAXCONN) != -1);
+        if (!isListening)
+        {
+            diagnostics.Add(CreateCompileServerListenError(socketPath, CreateErrorMessage()));
+            return std::move(diagnostics);
+        }
+
+        // Clients that exit before reading their exit code must not take the server down.
+        std::signal(SIGPIPE, SIG_IGN);
+
+        while (true)
+        {
+            const FileDescriptor clientSocket{ accept(serverSocket.Get(), nullptr, nullptr) };
+            if (clientSocket.Get() == -1)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+
+                diagnostics.Add(CreateCompileServerListenError(socketPath, CreateErrorMessage()));
+                return std::move(diagnostics);
+            }
+
+            ServeClient(clientSocket.Get(), compile);
+        }
+    }
+
+    auto Connect(
+        const std::filesystem::path& socketPath,
+        const std::vector<std::string_view>& args
+    ) -> Expected<int>
+    {
+        auto diagnostics = DiagnosticBag::Create();
+
+        const auto optAddress = CreateSocketAddress(socketPath);
+        if (!optAddress.has_value())
+        {
+            diagnostics.Add(CreateCompileServerConnectError(socketPath, "path is too long"));
+            return std::move(diagnostics);
+        }
+
+        const FileDescriptor clientSocket{ socket(AF_UNIX, SOCK_STREAM, 0) };
+        if (clientSocket.Get() == -1)
+        {
+            diagnostics.Add(CreateCompileServerConnectError(socketPath, CreateErrorMessage()));
+            return std::move(diagnostics);
+        }
+
+        const auto& address = optAddress.value();
+        const auto connectResult = connect(
+            clientSocket.Get(),
+            reinterpret_cast<const sockaddr*>(&address),
+            sizeof(address)
+        );
+        if (connectResult == -1)
+        {
+            diagnostics.Add(CreateCompileServerConnectError(socketPath, CreateErrorMessage()));
+            return std::move(diagnostics);
+        }
+
+        FlushOutput();
+
+        const auto workingDirectory = std::filesystem::current_path().string();
+
+        std::vector<std::string_view> strings{};
+        strings.push_back(workingDirectory);
+        strings.insert(end(strings), begin(args), end(args));
+
+        std::vector<std::string_view> environment{};
+        for (char** variable = environ; *variable; variable++)
+        {
+            environment.push_back(*variable);
+        }
+
+        int32_t exitCode{};
+        const bool didCompile =
+            SendFileDescriptors(clientSocket.Get(), { STDOUT_FILENO, STDERR_FILENO }) &&
+            SendStrings(clientSocket.Get(), strings) &&
+            SendStrings(clientSocket.Get(), environment) &&
+            ReceiveAll(clientSocket.Get(), &exitCode, sizeof(exitCode));
+        if (!didCompile)
+        {
+            diagnostics.Add(CreateCompileServerDisconnectedError(socketPath));
+            return std::move(diagnostics);
+        }
+
+        return Expected{ static_cast<int>(exitCode), std::move(diagnostics) };
+    }
+}
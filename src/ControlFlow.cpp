@@ -0,0 +1,121 @@
+#include "ControlFlow.hpp"
+
+#include <vector>
+#include <unordered_map>
+
+#include "Assert.hpp"
+
+namespace Ace
+{
+    static auto IsTerminator(const ControlFlowInstruction& instruction) -> bool
+    {
+        switch (instruction.Kind)
+        {
+            case ControlFlowKind::Label:
+            {
+                return false;
+            }
+
+            case ControlFlowKind::Jump:
+            case ControlFlowKind::ConditionalJump:
+            case ControlFlowKind::Ret:
+            case ControlFlowKind::Exit:
+            {
+                return true;
+            }
+        }
+
+        ACE_UNREACHABLE();
+    }
+
+    ControlFlowGraph::ControlFlowGraph(std::vector<ControlFlowInstruction> instructions)
+        : m_Instructions{ std::move(instructions) }
+    {
+        CreateBlocks();
+        LinkBlocks();
+    }
+
+    auto ControlFlowGraph::GetInstructions() const -> const std::vector<ControlFlowInstruction>&
+    {
+        return m_Instructions;
+    }
+
+    auto ControlFlowGraph::GetBlocks() const -> const std::vector<ControlFlowBlock>&
+    {
+        return m_Blocks;
+    }
+
+    auto ControlFlowGraph::GetEndBlockIndex() const -> size_t
+    {
+        return m_Blocks.size();
+    }
+
+    auto ControlFlowGraph::CreateBlocks() -> void
+    {
+        // A block starts at the first instruction, at every label and after every terminator.
+        for (size_t i = 0; i < m_Instructions.size(); i++)
+        {
+            const auto& instruction = m_Instructions.at(i);
+
+            const bool isLabel = instruction.Kind == ControlFlowKind::Label;
+            const bool isAfterTerminator = (i != 0) && IsTerminator(m_Instructions.at(i - 1));
+            const bool isLeader = (i == 0) || isLabel || isAfterTerminator;
+            if (isLeader)
+            {
+                m_Blocks.push_back(ControlFlowBlock{ i, i, {} });
+            }
+
+            m_Blocks.back().EndInstructionIndex = i + 1;
+
+            if (isLabel)
+            {
+                m_LabelToBlockIndexMap[instruction.LabelSymbol] = m_Blocks.size() - 1;
+            }
+        }
+    }
+
+    auto ControlFlowGraph::LinkBlocks() -> void
+    {
+        for (size_t i = 0; i < m_Blocks.size(); i++)
+        {
+            auto& block = m_Blocks.at(i);
+            const auto& lastInstruction = m_Instructions.at(block.EndInstructionIndex - 1);
+
+            const auto findLabelBlockIndex = [&]() -> size_t
+            {
+                const auto labelBlockIndexIt =
+                    m_LabelToBlockIndexMap.find(lastInstruction.LabelSymbol);
+                ACE_ASSERT(labelBlockIndexIt != end(m_LabelToBlockIndexMap));
+                return labelBlockIndexIt->second;
+            };
+
+            switch (lastInstruction.Kind)
+            {
+                case ControlFlowKind::Label:
+                {
+                    block.SuccessorIndices.push_back(i + 1);
+                    break;
+                }
+
+                case ControlFlowKind::Jump:
+                {
+                    block.SuccessorIndices.push_back(findLabelBlockIndex());
+                    break;
+                }
+
+                case ControlFlowKind::ConditionalJump:
+                {
+                    block.SuccessorIndices.push_back(findLabelBlockIndex());
+                    block.SuccessorIndices.push_back(i + 1);
+                    break;
+                }
+
+                case ControlFlowKind::Ret:
+                case ControlFlowKind::Exit:
+                {
+                    break;
+                }
+            }
+        }
+    }
+}
@@ -3,104 +3,44 @@
 #include <vector>
 
 #include "ControlFlow.hpp"
-#include "Assert.hpp"
 #include "Diagnostic.hpp"
 #include "Diagnostics/DiagnosisDiagnostics.hpp"
-#include "Symbols/LabelSymbol.hpp"
 
 namespace Ace
 {
-    static auto IsEnd(
-        const std::vector<ControlFlowInstruction>::const_iterator instructionIt,
-        const std::vector<std::vector<ControlFlowInstruction>::const_iterator>& ends
-    ) -> bool
+    // Visits each block at most once, so the cost is linear in the number of blocks and edges.
+    static auto IsEndReachableWithoutRet(const ControlFlowGraph& graph) -> bool
     {
-        const auto matchingEndIt = std::find_if(
-            begin(ends),
-            end(ends),
-            [&](const std::vector<ControlFlowInstruction>::const_iterator end)
-            {
-                return instructionIt == end;
-            }
-        );
+        const auto& blocks = graph.GetBlocks();
+        const auto endBlockIndex = graph.GetEndBlockIndex();
 
-        return matchingEndIt != end(ends);
-    }
+        std::vector<bool> isVisited(blocks.size() + 1, false);
+        std::vector<size_t> worklist{ 0 };
+        isVisited.at(0) = true;
 
-    static auto FindLabelInstruction(const ControlFlowGraph& graph, LabelSymbol* const labelSymbol)
-        -> std::vector<ControlFlowInstruction>::const_iterator
-    {
-        return std::find_if(
-            begin(graph.Instructions),
-            end(graph.Instructions),
-            [&](const ControlFlowInstruction& instruction)
-            {
-                return (instruction.Kind == ControlFlowKind::Label) &&
-                       (instruction.LabelSymbol == labelSymbol);
-            }
-        );
-    }
-
-    static auto IsEndReachableWithoutRet(
-        const ControlFlowGraph& graph,
-        const std::vector<ControlFlowInstruction>::const_iterator begin,
-        const std::vector<std::vector<ControlFlowInstruction>::const_iterator>& ends
-    ) -> bool
-    {
-        for (auto instructionIt = begin; instructionIt != end(graph.Instructions); ++instructionIt)
+        while (!worklist.empty())
         {
-            if (IsEnd(instructionIt, ends))
+            const auto blockIndex = worklist.back();
+            worklist.pop_back();
+
+            if (blockIndex == endBlockIndex)
             {
-                return false;
+                return true;
             }
 
-            const auto& instruction = *instructionIt;
-
-            switch (instruction.Kind)
+            for (const auto successorIndex : blocks.at(blockIndex).SuccessorIndices)
             {
-                case ControlFlowKind::Label:
+                if (isVisited.at(successorIndex))
                 {
                     continue;
                 }
 
-                case ControlFlowKind::Jump:
-                {
-                    const auto labelInstructionIt =
-                        FindLabelInstruction(graph, instruction.LabelSymbol);
-                    ACE_ASSERT(labelInstructionIt != end(graph.Instructions));
-
-                    auto newEnds = ends;
-                    newEnds.push_back(instructionIt);
-
-                    return IsEndReachableWithoutRet(graph, labelInstructionIt, newEnds);
-                }
-
-                case ControlFlowKind::ConditionalJump:
-                {
-                    const auto labelInstructionIt =
-                        FindLabelInstruction(graph, instruction.LabelSymbol);
-                    ACE_ASSERT(labelInstructionIt != end(graph.Instructions));
-
-                    auto whenTrueEnds = ends;
-                    whenTrueEnds.push_back(instructionIt);
-
-                    const bool whenTrue =
-                        IsEndReachableWithoutRet(graph, labelInstructionIt, whenTrueEnds);
-
-                    const bool whenFalse = IsEndReachableWithoutRet(graph, instructionIt + 1, ends);
-
-                    return whenTrue || whenFalse;
-                }
-
-                case ControlFlowKind::Ret:
-                case ControlFlowKind::Exit:
-                {
-                    return false;
-                }
+                isVisited.at(successorIndex) = true;
+                worklist.push_back(successorIndex);
             }
         }
 
-        return true;
+        return false;
     }
 
     auto DiagnoseInvalidControlFlow(const SrcLocation& srcLocation, const ControlFlowGraph& graph)
@@ -108,7 +48,7 @@ namespace Ace
     {
         auto diagnostics = DiagnosticBag::Create();
 
-        if (IsEndReachableWithoutRet(graph, begin(graph.Instructions), {}))
+        if (IsEndReachableWithoutRet(graph))
         {
             diagnostics.Add(CreateNotAllControlPathsRetError(srcLocation));
         }
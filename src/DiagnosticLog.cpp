@@ -103,23 +103,6 @@ namespace Ace
         };
     }
 
-    static auto CalculateSnippetStringLine(const SrcLocation& srcLocation) -> std::string_view
-    {
-        const std::string_view bufferView = srcLocation.Buffer->GetBuffer();
-
-        const auto bufferBeginIt = begin(bufferView);
-        const auto bufferEndIt = end(bufferView);
-
-        const auto lineBeginIt = std::find(
-            std::make_reverse_iterator(srcLocation.CharacterBeginIterator),
-            std::make_reverse_iterator(bufferBeginIt),
-            '\n'
-        );
-        const auto lineEndIt = std::find(srcLocation.CharacterBeginIterator, bufferEndIt, '\n');
-
-        return std::string_view{ lineBeginIt.base(), lineEndIt };
-    }
-
     auto CreateCappedIterator(const std::string_view line, std::string_view::const_iterator it)
         -> std::string_view::const_iterator
     {
@@ -141,7 +124,7 @@ namespace Ace
     static auto CalculateSnippetDisplayInfo(const SrcLocation& srcLocation)
         -> DiagnosticSnippetDisplayInfo
     {
-        const auto line = CalculateSnippetStringLine(srcLocation);
+        const auto line = srcLocation.Buffer->FindLine(srcLocation.CharacterBeginIterator);
 
         auto highlight = std::string_view{
             CreateCappedIterator(line, srcLocation.CharacterBeginIterator),
@@ -252,6 +235,11 @@ namespace Ace
 
     static bool HasLogged = false;
 
+    auto ResetDiagnosticLog() -> void
+    {
+        HasLogged = false;
+    }
+
     auto LogDiagnosticGroup(const DiagnosticGroup& diagnosticGroup) -> void
     {
         if (!HasLogged)
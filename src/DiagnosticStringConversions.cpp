@@ -261,9 +261,7 @@ namespace Ace
 
             default:
             {
-                const auto keywordTokenKindIt = TokenKindToKeywordMap.find(tokenKind);
-                ACE_ASSERT(keywordTokenKindIt != end(TokenKindToKeywordMap));
-                return "`" + std::string{ keywordTokenKindIt->second } + "`";
+                return "`" + std::string{ GetKeyword(tokenKind) } + "`";
             }
         }
     }
@@ -422,11 +420,11 @@ namespace Ace
         }
     }
 
-    auto CreateOpString(const Token& opToken) -> std::string
+    auto CreateOpString(const TokenView& opToken) -> std::string
     {
         if (opToken.Kind == TokenKind::Ident)
         {
-            return "`" + opToken.String + "`";
+            return "`" + std::string{ opToken.String } + "`";
         }
 
         return CreateTokenKindString(opToken.Kind);
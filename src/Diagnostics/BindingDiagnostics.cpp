@@ -448,7 +448,7 @@ namespace Ace
         DiagnosticGroup group{};
 
         const std::string message =
-            "`" + std::string{ TokenKindToKeywordMap.at(TokenKind::UpperSelfKeyword) } +
+            "`" + std::string{ GetKeyword(TokenKind::UpperSelfKeyword) } +
             "` reference in incorrect context";
 
         group.Diagnostics.emplace_back(DiagnosticSeverity::Error, srcLocation, message);
@@ -1,6 +1,8 @@
 #include "Diagnostics/CLIArgDiagnostics.hpp"
 
 #include <memory>
+#include <string>
+#include <string_view>
 
 #include "Diagnostic.hpp"
 #include "SrcLocation.hpp"
@@ -50,4 +52,18 @@ namespace Ace
 
         return group;
     }
+
+    auto CreateInvalidCLIOptionValueError(
+        const SrcLocation& srcLocation, const std::string_view expectedValue
+    ) -> DiagnosticGroup
+    {
+        DiagnosticGroup group{};
+
+        const std::string message = std::string{} + "invalid option argument, expected " +
+                                    std::string{ expectedValue };
+
+        group.Diagnostics.emplace_back(DiagnosticSeverity::Error, srcLocation, message);
+
+        return group;
+    }
 }
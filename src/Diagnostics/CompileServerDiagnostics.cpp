@@ -0,0 +1,53 @@
+#include "Diagnostics/CompileServerDiagnostics.hpp"
+
+#include <string>
+#include <filesystem>
+
+#include "Diagnostic.hpp"
+
+namespace Ace
+{
+    auto CreateCompileServerListenError(
+        const std::filesystem::path& socketPath, const std::string& message
+    ) -> DiagnosticGroup
+    {
+        DiagnosticGroup group{};
+
+        group.Diagnostics.emplace_back(
+            DiagnosticSeverity::Error,
+            std::nullopt,
+            "unable to listen on compile server socket: " + socketPath.string() + ": " + message
+        );
+
+        return group;
+    }
+
+    auto CreateCompileServerConnectError(
+        const std::filesystem::path& socketPath, const std::string& message
+    ) -> DiagnosticGroup
+    {
+        DiagnosticGroup group{};
+
+        group.Diagnostics.emplace_back(
+            DiagnosticSeverity::Error,
+            std::nullopt,
+            "unable to connect to compile server: " + socketPath.string() + ": " + message
+        );
+
+        return group;
+    }
+
+    auto CreateCompileServerDisconnectedError(const std::filesystem::path& socketPath)
+        -> DiagnosticGroup
+    {
+        DiagnosticGroup group{};
+
+        group.Diagnostics.emplace_back(
+            DiagnosticSeverity::Error,
+            std::nullopt,
+            "compile server closed the connection: " + socketPath.string()
+        );
+
+        return group;
+    }
+}
@@ -1,5 +1,8 @@
 #include "Diagnostics/EmittingDiagnostics.hpp"
 
+#include <string>
+#include <filesystem>
+
 #include "Symbols/All.hpp"
 #include "Diagnostic.hpp"
 
@@ -15,4 +18,46 @@ namespace Ace
 
         return group;
     }
+
+    auto CreateUnsupportedTargetError(const std::string& triple, const std::string& message)
+        -> DiagnosticGroup
+    {
+        DiagnosticGroup group{};
+
+        group.Diagnostics.emplace_back(
+            DiagnosticSeverity::Error,
+            std::nullopt,
+            "unsupported target `" + triple + "`: " + message
+        );
+
+        return group;
+    }
+
+    auto CreateUnsupportedObjectEmissionError(const std::string& triple) -> DiagnosticGroup
+    {
+        DiagnosticGroup group{};
+
+        group.Diagnostics.emplace_back(
+            DiagnosticSeverity::Error,
+            std::nullopt,
+            "target `" + triple + "` cannot emit object files"
+        );
+
+        return group;
+    }
+
+    auto CreateOutputFileOpenError(
+        const std::filesystem::path& path, const std::string& message
+    ) -> DiagnosticGroup
+    {
+        DiagnosticGroup group{};
+
+        group.Diagnostics.emplace_back(
+            DiagnosticSeverity::Error,
+            std::nullopt,
+            "unable to open output file: " + path.string() + ": " + message
+        );
+
+        return group;
+    }
 }
@@ -65,7 +65,7 @@ namespace Ace
 
             const auto characterIndex = static_cast<size_t>(std::stoi(columnString));
 
-            const auto& line = fileBuffer->GetLines().at(lineIndex);
+            const auto line = fileBuffer->GetLine(lineIndex);
             const SrcLocation srcLocation{
                 fileBuffer,
                 begin(line) + characterIndex,
@@ -11,7 +11,7 @@
 
 namespace Ace
 {
-    auto CreateUnexpectedTokenError(const Token& unexpectedToken) -> DiagnosticGroup
+    auto CreateUnexpectedTokenError(const TokenView& unexpectedToken) -> DiagnosticGroup
     {
         DiagnosticGroup group{};
 
@@ -24,8 +24,9 @@ namespace Ace
         return group;
     }
 
-    auto CreateUnexpectedTokenError(const Token& unexpectedToken, const TokenKind expectedTokenKind)
-        -> DiagnosticGroup
+    auto CreateUnexpectedTokenError(
+        const TokenView& unexpectedToken, const TokenKind expectedTokenKind
+    ) -> DiagnosticGroup
     {
         DiagnosticGroup group{};
 
@@ -40,7 +41,8 @@ namespace Ace
         return group;
     }
 
-    auto CreateUnexpectedTokenExpectedLiteralError(const Token& unexpectedToken) -> DiagnosticGroup
+    auto CreateUnexpectedTokenExpectedLiteralError(const TokenView& unexpectedToken)
+        -> DiagnosticGroup
     {
         DiagnosticGroup group{};
 
@@ -54,7 +56,7 @@ namespace Ace
         return group;
     }
 
-    auto CreateUnexpectedTokenExpectedNewError(const Token& unexpectedToken) -> DiagnosticGroup
+    auto CreateUnexpectedTokenExpectedNewError(const TokenView& unexpectedToken) -> DiagnosticGroup
     {
         DiagnosticGroup group{};
 
@@ -68,7 +70,7 @@ namespace Ace
         return group;
     }
 
-    auto CreateUnexpectedTokenExpectedCompoundAssignmentOpError(const Token& unexpectedToken)
+    auto CreateUnexpectedTokenExpectedCompoundAssignmentOpError(const TokenView& unexpectedToken)
         -> DiagnosticGroup
     {
         DiagnosticGroup group{};
@@ -114,7 +116,7 @@ namespace Ace
         return group;
     }
 
-    auto CreateExternInstanceFunctionError(const Token& externKeywordToken) -> DiagnosticGroup
+    auto CreateExternInstanceFunctionError(const TokenView& externKeywordToken) -> DiagnosticGroup
     {
         DiagnosticGroup group{};
 
@@ -125,7 +127,7 @@ namespace Ace
         return group;
     }
 
-    auto CreateUnknownModifierError(const Token& modifierToken) -> DiagnosticGroup
+    auto CreateUnknownModifierError(const TokenView& modifierToken) -> DiagnosticGroup
     {
         DiagnosticGroup group{};
 
@@ -136,7 +138,7 @@ namespace Ace
         return group;
     }
 
-    auto CreateForbiddenModifierError(const Token& modifierToken) -> DiagnosticGroup
+    auto CreateForbiddenModifierError(const TokenView& modifierToken) -> DiagnosticGroup
     {
         DiagnosticGroup group{};
 
@@ -147,7 +149,7 @@ namespace Ace
         return group;
     }
 
-    auto CreateEmptyModifiersError(const Token& colonColonToken) -> DiagnosticGroup
+    auto CreateEmptyModifiersError(const TokenView& colonColonToken) -> DiagnosticGroup
     {
         DiagnosticGroup group{};
 
@@ -179,13 +181,13 @@ namespace Ace
         return group;
     }
 
-    auto CreateMissingSelfModifierAfterStrongPtrError(const Token& strongPtrModifierToken)
+    auto CreateMissingSelfModifierAfterStrongPtrError(const TokenView& strongPtrModifierToken)
         -> DiagnosticGroup
     {
         DiagnosticGroup group{};
 
         const std::string message =
-            "missing `" + std::string{ TokenKindToKeywordMap.at(TokenKind::LowerSelfKeyword) } +
+            "missing `" + std::string{ GetKeyword(TokenKind::LowerSelfKeyword) } +
             "` modifier after " + CreateTokenKindString(TokenKind::Asterisk);
 
         group.Diagnostics.emplace_back(
@@ -3,9 +3,13 @@
 #include <memory>
 #include <vector>
 #include <map>
+#include <set>
+#include <unordered_map>
+#include <functional>
 #include <string_view>
 #include <chrono>
-#include <fstream>
+#include <optional>
+#include <system_error>
 
 #include <llvm/Support/InitLLVM.h>
 #include <llvm/Support/TargetSelect.h>
@@ -16,10 +20,21 @@
 #include <llvm/Support/FileSystem.h>
 #include <llvm/IR/LegacyPassManager.h>
 #include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/Transforms/Utils/SplitModule.h>
+#include <llvm/Transforms/Utils/Cloning.h>
+#include <llvm/Transforms/Utils/ValueMapper.h>
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/Support/xxhash.h>
+#include <llvm/ADT/SmallVector.h>
 #include <llvm/IR/Verifier.h>
 #include <llvm/Pass.h>
 #include <llvm/Passes/PassBuilder.h>
+#include <llvm/Transforms/IPO/AlwaysInliner.h>
+#include <llvm/Transforms/Utils/Mem2Reg.h>
 #include <llvm/Target/TargetMachine.h>
+#include <llvm/Target/TargetOptions.h>
 
 #include "Scope.hpp"
 #include "Symbols/All.hpp"
@@ -32,6 +47,10 @@
 #include "AnonymousIdent.hpp"
 #include "SpecialIdent.hpp"
 #include "Compilation.hpp"
+#include "FileBuffer.hpp"
+#include "TimeTrace.hpp"
+#include "BuildCache.hpp"
+#include "Parallel.hpp"
 #include "Diagnostic.hpp"
 #include "Diagnostics/EmittingDiagnostics.hpp"
 
@@ -78,38 +97,71 @@ namespace Ace
     {
     }
 
-    static auto SaveStringToFile(
-        Compilation* const compilation,
-        const std::string& string,
-        const std::filesystem::path& filePath
-    ) -> void
+    static auto OpenOutputFile(
+        const std::filesystem::path& filePath,
+        const llvm::sys::fs::OpenFlags flags
+    ) -> Expected<std::unique_ptr<llvm::raw_fd_ostream>>
     {
-        std::ofstream fileStream{ filePath };
-        ACE_ASSERT(fileStream);
-        fileStream << string;
+        auto diagnostics = DiagnosticBag::Create();
+
+        std::error_code errorCode{};
+        auto fileOStream =
+            std::make_unique<llvm::raw_fd_ostream>(filePath.string(), errorCode, flags);
+        if (errorCode)
+        {
+            diagnostics.Add(CreateOutputFileOpenError(filePath, errorCode.message()));
+            return std::move(diagnostics);
+        }
+
+        return Expected{ std::move(fileOStream), std::move(diagnostics) };
     }
 
-    static auto SaveModuleToFile(
-        Compilation* const compilation,
-        const llvm::Module& module,
-        const std::filesystem::path& filePath
-    ) -> void
+    static auto SaveModuleToFile(const llvm::Module& module, const std::filesystem::path& filePath)
+        -> Expected<void>
     {
-        std::string moduleString{};
+        auto diagnostics = DiagnosticBag::Create();
 
-        llvm::raw_string_ostream moduleOStream{ moduleString };
-        moduleOStream << module;
-        moduleOStream.flush();
+        const auto optFileOStream =
+            diagnostics.Collect(OpenOutputFile(filePath, llvm::sys::fs::OF_Text));
+        if (!optFileOStream.has_value())
+        {
+            return std::move(diagnostics);
+        }
 
-        SaveStringToFile(compilation, moduleString, filePath);
+        module.print(*optFileOStream.value(), nullptr);
 
-        moduleString.clear();
+        return Void{ std::move(diagnostics) };
+    }
+
+    static auto SaveBitcodeToFile(const llvm::Module& module, const std::filesystem::path& filePath)
+        -> Expected<void>
+    {
+        auto diagnostics = DiagnosticBag::Create();
+
+        const auto optFileOStream =
+            diagnostics.Collect(OpenOutputFile(filePath, llvm::sys::fs::OF_None));
+        if (!optFileOStream.has_value())
+        {
+            return std::move(diagnostics);
+        }
+
+        llvm::WriteBitcodeToFile(module, *optFileOStream.value());
+
+        return Void{ std::move(diagnostics) };
     }
 
     static auto
-    SaveSemasToFile(Compilation* const compilation, const std::filesystem::path& filePath) -> void
+    SaveSemasToFile(Compilation* const compilation, const std::filesystem::path& filePath)
+        -> Expected<void>
     {
-        std::string semasString{};
+        auto diagnostics = DiagnosticBag::Create();
+
+        const auto optFileOStream =
+            diagnostics.Collect(OpenOutputFile(filePath, llvm::sys::fs::OF_Text));
+        if (!optFileOStream.has_value())
+        {
+            return std::move(diagnostics);
+        }
 
         const auto functionSymbols =
             compilation->GetGlobalScope()->CollectSymbolsRecursive<FunctionSymbol>();
@@ -129,12 +181,11 @@ namespace Ace
                     functionSymbol->CreateSignature(), functionSymbol->GetBlockSema().value()
                 );
 
-                semasString += logger.CreateString();
-                semasString += "\n";
+                *optFileOStream.value() << logger.CreateString() << "\n";
             }
         );
 
-        SaveStringToFile(compilation, semasString, filePath);
+        return Void{ std::move(diagnostics) };
     }
 
     static auto IsConcreteSymbol(ISymbol* const symbol) -> bool
@@ -153,13 +204,606 @@ namespace Ace
         return !genericSymbol->IsPlaceholder();
     }
 
+    static auto CreateCodeGenOptLevel(const OptimizationLevel optimizationLevel)
+        -> llvm::CodeGenOpt::Level
+    {
+        switch (optimizationLevel)
+        {
+            case OptimizationLevel::O0:
+            {
+                return llvm::CodeGenOpt::None;
+            }
+
+            case OptimizationLevel::O1:
+            {
+                return llvm::CodeGenOpt::Less;
+            }
+
+            case OptimizationLevel::O2:
+            case OptimizationLevel::Os:
+            {
+                return llvm::CodeGenOpt::Default;
+            }
+
+            case OptimizationLevel::O3:
+            {
+                return llvm::CodeGenOpt::Aggressive;
+            }
+        }
+
+        ACE_UNREACHABLE();
+    }
+
+    static auto CreateModulePassManager(
+        llvm::PassBuilder& pb,
+        const OptimizationLevel optimizationLevel
+    ) -> llvm::ModulePassManager
+    {
+        switch (optimizationLevel)
+        {
+            case OptimizationLevel::O0:
+            {
+                // Inlining natives first leaves their allocas in the caller for mem2reg, which is
+                // most of what higher levels would remove from a debug build anyway.
+                llvm::ModulePassManager mpm{};
+                mpm.addPass(llvm::AlwaysInlinerPass{});
+                mpm.addPass(llvm::createModuleToFunctionPassAdaptor(llvm::PromotePass{}));
+                return mpm;
+            }
+
+            case OptimizationLevel::O1:
+            {
+                return pb.buildPerModuleDefaultPipeline(llvm::OptimizationLevel::O1);
+            }
+
+            case OptimizationLevel::O2:
+            {
+                return pb.buildPerModuleDefaultPipeline(llvm::OptimizationLevel::O2);
+            }
+
+            case OptimizationLevel::O3:
+            {
+                return pb.buildPerModuleDefaultPipeline(llvm::OptimizationLevel::O3);
+            }
+
+            case OptimizationLevel::Os:
+            {
+                return pb.buildPerModuleDefaultPipeline(llvm::OptimizationLevel::Os);
+            }
+        }
+
+        ACE_UNREACHABLE();
+    }
+
+    static auto CreateTargetMachine(
+        const std::string& triple,
+        const OptimizationLevel optimizationLevel
+    ) -> Expected<std::unique_ptr<llvm::TargetMachine>>
+    {
+        auto diagnostics = DiagnosticBag::Create();
+
+        std::string lookupErrorMessage{};
+        const auto* const target = llvm::TargetRegistry::lookupTarget(triple, lookupErrorMessage);
+        if (!target)
+        {
+            diagnostics.Add(CreateUnsupportedTargetError(triple, lookupErrorMessage));
+            return std::move(diagnostics);
+        }
+
+        std::unique_ptr<llvm::TargetMachine> targetMachine{ target->createTargetMachine(
+            triple,
+            "generic",
+            "",
+            llvm::TargetOptions{},
+            llvm::Reloc::PIC_,
+            std::nullopt,
+            CreateCodeGenOptLevel(optimizationLevel)
+        ) };
+        if (!targetMachine)
+        {
+            diagnostics.Add(CreateUnsupportedTargetError(triple, "no target machine"));
+            return std::move(diagnostics);
+        }
+
+        return Expected{ std::move(targetMachine), std::move(diagnostics) };
+    }
+
+    static auto OptimizeModule(llvm::Module& module, const OptimizationLevel optimizationLevel)
+        -> void
+    {
+        llvm::LoopAnalysisManager lam{};
+        llvm::FunctionAnalysisManager fam{};
+        llvm::CGSCCAnalysisManager cgam{};
+        llvm::ModuleAnalysisManager mam{};
+
+        llvm::PassBuilder pb{};
+
+        pb.registerModuleAnalyses(mam);
+        pb.registerCGSCCAnalyses(cgam);
+        pb.registerFunctionAnalyses(fam);
+        pb.registerLoopAnalyses(lam);
+        pb.crossRegisterProxies(lam, fam, cgam, mam);
+
+        auto mpm = CreateModulePassManager(pb, optimizationLevel);
+
+        mpm.run(module, mam);
+    }
+
+    static auto CreateBitcode(const llvm::Module& module) -> llvm::SmallVector<char, 0>
+    {
+        llvm::SmallVector<char, 0> bitcode{};
+        llvm::raw_svector_ostream bitcodeOStream{ bitcode };
+        llvm::WriteBitcodeToFile(module, bitcodeOStream);
+        return bitcode;
+    }
+
+    // Identifies an object file by the module it is compiled from and the settings it is
+    // optimized and compiled with.
+    static auto CreateObjectFileHash(
+        const llvm::StringRef bitcode,
+        const OptimizationLevel optimizationLevel,
+        const std::string& triple
+    ) -> uint64_t
+    {
+        BuildCache::Hasher hasher{};
+        hasher.AddValue(llvm::xxHash64(bitcode));
+        hasher.AddValue(static_cast<uint64_t>(optimizationLevel));
+        hasher.Add(triple);
+
+        return hasher.Finish();
+    }
+
+    static auto EmitObjectFile(
+        llvm::TargetMachine* const targetMachine,
+        llvm::Module& module,
+        const std::filesystem::path& filePath
+    ) -> Expected<void>
+    {
+        auto diagnostics = DiagnosticBag::Create();
+
+        const auto optFileOStream =
+            diagnostics.Collect(OpenOutputFile(filePath, llvm::sys::fs::OF_None));
+        if (!optFileOStream.has_value())
+        {
+            return std::move(diagnostics);
+        }
+
+        llvm::legacy::PassManager pm{};
+        const bool isObjectEmissionUnsupported = targetMachine->addPassesToEmitFile(
+            pm, *optFileOStream.value(), nullptr, llvm::CGFT_ObjectFile
+        );
+        if (isObjectEmissionUnsupported)
+        {
+            diagnostics.Add(CreateUnsupportedObjectEmissionError(module.getTargetTriple()));
+            return std::move(diagnostics);
+        }
+
+        pm.run(module);
+
+        return Void{ std::move(diagnostics) };
+    }
+
+    static auto EmitCodegenUnit(
+        Compilation* const compilation,
+        const std::string& unitName,
+        const llvm::StringRef bitcode,
+        const bool isOptimized,
+        const std::filesystem::path& objFilePath
+    ) -> Expected<void>
+    {
+        auto diagnostics = DiagnosticBag::Create();
+
+        const TimeScope timeScope{
+            compilation->GetTimeTracer(),
+            "Emit codegen unit",
+            [&]() { return unitName; },
+        };
+
+        const auto optimizationLevel = compilation->GetOptimizationLevel();
+
+        llvm::LLVMContext context{};
+        const auto module = llvm::cantFail(
+            llvm::parseBitcodeFile(llvm::MemoryBufferRef{ bitcode, unitName }, context)
+        );
+
+        std::optional<uint64_t> optObjFileHash{};
+        if (compilation->IsUsingBuildCache())
+        {
+            optObjFileHash =
+                CreateObjectFileHash(bitcode, optimizationLevel, module->getTargetTriple());
+
+            const bool isObjFileRestored = BuildCache::TryRestoreObjectFile(
+                compilation, unitName, optObjFileHash.value(), objFilePath
+            );
+            if (isObjFileRestored)
+            {
+                return Void{ std::move(diagnostics) };
+            }
+        }
+
+        // Target machines are not thread-safe, so every unit gets its own.
+        const auto optTargetMachine = diagnostics.Collect(
+            CreateTargetMachine(module->getTargetTriple(), optimizationLevel)
+        );
+        if (!optTargetMachine.has_value())
+        {
+            return std::move(diagnostics);
+        }
+
+        if (!isOptimized)
+        {
+            OptimizeModule(*module, optimizationLevel);
+        }
+
+        const auto didEmitObjectFile = diagnostics.Collect(
+            EmitObjectFile(optTargetMachine.value().get(), *module, objFilePath)
+        );
+        if (!didEmitObjectFile)
+        {
+            return std::move(diagnostics);
+        }
+
+        if (optObjFileHash.has_value())
+        {
+            BuildCache::StoreObjectFile(
+                compilation, unitName, optObjFileHash.value(), objFilePath
+            );
+        }
+
+        return Void{ std::move(diagnostics) };
+    }
+
+    static constexpr size_t CommonUnitIndex = 0;
+
+    // File units are cached under a name derived from the file's path, so a unit finds its cached
+    // object again when other files are added or removed.
+    static auto CreateFileUnitName(
+        const std::string& packageName,
+        const FileBuffer* const fileBuffer
+    ) -> std::string
+    {
+        const auto& path = fileBuffer->GetPath();
+
+        return packageName + "." + path.stem().string() + "." +
+               llvm::utohexstr(llvm::xxHash64(path.string()));
+    }
+
+    // Collects the units of the functions that use `value`, directly or through constants. Uses
+    // in the initializers of other globals count as uses from the common unit.
+    static auto CollectUserUnitIndices(
+        const llvm::Value* const value,
+        const std::unordered_map<const llvm::Function*, size_t>& functionToUnitIndexMap,
+        std::set<size_t>& unitIndices
+    ) -> void
+    {
+        std::for_each(
+            value->user_begin(),
+            value->user_end(),
+            [&](const llvm::User* const user)
+            {
+                if (const auto* const inst = llvm::dyn_cast<llvm::Instruction>(user))
+                {
+                    const auto unitIndexIt = functionToUnitIndexMap.find(inst->getFunction());
+                    unitIndices.insert(
+                        (unitIndexIt == end(functionToUnitIndexMap)) ? CommonUnitIndex
+                                                                     : unitIndexIt->second
+                    );
+                    return;
+                }
+
+                if (llvm::isa<llvm::Constant>(user) && !llvm::isa<llvm::GlobalValue>(user))
+                {
+                    CollectUserUnitIndices(user, functionToUnitIndexMap, unitIndices);
+                    return;
+                }
+
+                unitIndices.insert(CommonUnitIndex);
+            }
+        );
+    }
+
+    // Anonymous globals, such as strings, are numbered across the whole module. When units share
+    // one, it is named after its contents instead, so the units that refer to it keep their
+    // bitcode when unrelated code adds anonymous globals.
+    static auto CreateSharedGlobalName(const llvm::GlobalVariable& globalVar) -> std::string
+    {
+        std::string initializer{};
+        llvm::raw_string_ostream initializerOStream{ initializer };
+        globalVar.getInitializer()->print(initializerOStream);
+        initializerOStream.flush();
+
+        BuildCache::Hasher hasher{};
+        hasher.Add(initializer);
+        hasher.AddValue(globalVar.isConstant() ? 1 : 0);
+
+        return "?" + AnonymousIdent::Concat("shared", llvm::utohexstr(hasher.Finish()));
+    }
+
+    // Splits the module into a common unit and one unit per source file that functions were
+    // emitted from. Functions go to the unit of their file and global variables that only one
+    // unit uses go with it. Everything else, such as `main`, type infos and vtbls, goes to the
+    // common unit. Internal globals that units share become hidden external ones, and shared
+    // anonymous ones are renamed after their contents.
+    //
+    // A unit only keeps the declarations it uses and drops the names of its internal globals,
+    // which are numbered across the whole module. So its bitcode, and with it the key of its
+    // cached object file, only changes when its own functions or the signatures they use do.
+    static auto SplitModuleByFile(
+        llvm::Module& module,
+        const std::string& packageName,
+        const std::map<const FunctionSymbol*, llvm::Function*>& functionMap,
+        const std::function<void(std::string, std::unique_ptr<llvm::Module>)>& callback
+    ) -> void
+    {
+        std::unordered_map<const llvm::Function*, std::string> functionToUnitNameMap{};
+        std::set<std::string> fileUnitNames{};
+        std::for_each(
+            begin(functionMap),
+            end(functionMap),
+            [&](const std::pair<const FunctionSymbol* const, llvm::Function*>& symbolAndFunction)
+            {
+                const auto* const fileBuffer = dynamic_cast<const FileBuffer*>(
+                    symbolAndFunction.first->GetName().SrcLocation.Buffer
+                );
+                if (!fileBuffer)
+                {
+                    return;
+                }
+
+                auto unitName = CreateFileUnitName(packageName, fileBuffer);
+                fileUnitNames.insert(unitName);
+                functionToUnitNameMap[symbolAndFunction.second] = std::move(unitName);
+            }
+        );
+
+        std::vector<std::string> unitNames{ packageName + ".common" };
+        unitNames.insert(end(unitNames), begin(fileUnitNames), end(fileUnitNames));
+
+        std::map<std::string, size_t> unitNameToIndexMap{};
+        for (size_t i = 0; i < unitNames.size(); i++)
+        {
+            unitNameToIndexMap[unitNames.at(i)] = i;
+        }
+
+        std::unordered_map<const llvm::Function*, size_t> functionToUnitIndexMap{};
+        std::unordered_map<const llvm::GlobalValue*, size_t> globalToUnitIndexMap{};
+        std::for_each(
+            begin(functionToUnitNameMap),
+            end(functionToUnitNameMap),
+            [&](const std::pair<const llvm::Function* const, std::string>& functionAndUnitName)
+            {
+                const auto unitIndex = unitNameToIndexMap.at(functionAndUnitName.second);
+                functionToUnitIndexMap[functionAndUnitName.first] = unitIndex;
+                globalToUnitIndexMap[functionAndUnitName.first] = unitIndex;
+            }
+        );
+
+        std::set<const llvm::GlobalVariable*> unitLocalGlobalVars{};
+        std::for_each(
+            module.global_begin(),
+            module.global_end(),
+            [&](const llvm::GlobalVariable& globalVar)
+            {
+                std::set<size_t> userUnitIndices{};
+                CollectUserUnitIndices(&globalVar, functionToUnitIndexMap, userUnitIndices);
+                if (userUnitIndices.size() > 1)
+                {
+                    return;
+                }
+
+                unitLocalGlobalVars.insert(&globalVar);
+                if (userUnitIndices.size() == 1)
+                {
+                    globalToUnitIndexMap[&globalVar] = *begin(userUnitIndices);
+                }
+            }
+        );
+
+        const auto globalValues = module.global_values();
+        std::for_each(
+            globalValues.begin(),
+            globalValues.end(),
+            [&](llvm::GlobalValue& globalValue)
+            {
+                if (!globalValue.hasLocalLinkage())
+                {
+                    return;
+                }
+
+                const auto* const globalVar = llvm::dyn_cast<llvm::GlobalVariable>(&globalValue);
+                if (globalVar && unitLocalGlobalVars.contains(globalVar))
+                {
+                    return;
+                }
+
+                globalValue.setLinkage(llvm::GlobalValue::ExternalLinkage);
+                globalValue.setVisibility(llvm::GlobalValue::HiddenVisibility);
+
+                if (globalVar && globalVar->hasGlobalUnnamedAddr() && globalVar->hasInitializer())
+                {
+                    globalValue.setName(CreateSharedGlobalName(*globalVar));
+                }
+            }
+        );
+
+        for (size_t i = 0; i < unitNames.size(); i++)
+        {
+            llvm::ValueToValueMapTy valueMap{};
+            auto unitModule = llvm::CloneModule(
+                module,
+                valueMap,
+                [&](const llvm::GlobalValue* const globalValue)
+                {
+                    const auto unitIndexIt = globalToUnitIndexMap.find(globalValue);
+                    const auto unitIndex = (unitIndexIt == end(globalToUnitIndexMap))
+                                               ? CommonUnitIndex
+                                               : unitIndexIt->second;
+
+                    return unitIndex == i;
+                }
+            );
+
+            std::vector<llvm::GlobalValue*> unusedDeclarations{};
+            const auto unitGlobalValues = unitModule->global_values();
+            std::for_each(
+                unitGlobalValues.begin(),
+                unitGlobalValues.end(),
+                [&](llvm::GlobalValue& globalValue)
+                {
+                    if (globalValue.hasLocalLinkage())
+                    {
+                        globalValue.setName("");
+                        return;
+                    }
+
+                    globalValue.removeDeadConstantUsers();
+                    if (globalValue.isDeclaration() && globalValue.use_empty())
+                    {
+                        unusedDeclarations.push_back(&globalValue);
+                    }
+                }
+            );
+            std::for_each(
+                begin(unusedDeclarations),
+                end(unusedDeclarations),
+                [&](llvm::GlobalValue* const declaration)
+                {
+                    declaration->eraseFromParent();
+                }
+            );
+
+            callback(unitNames.at(i), std::move(unitModule));
+        }
+    }
+
+    // Partitions the module into `--codegen-units` units, or into one unit per source file, and
+    // compiles each to its own object file on up to `-j` threads. Units travel to their threads
+    // as bitcode, because modules sharing an `llvm::LLVMContext` cannot be processed
+    // concurrently. Calls between units cannot be inlined, which is the price for the
+    // parallelism and for reusing the cached objects of unchanged files.
+    static auto EmitCodegenUnits(
+        Compilation* const compilation,
+        llvm::Module& module,
+        const std::map<const FunctionSymbol*, llvm::Function*>& functionMap,
+        const bool isOptimized,
+        const std::filesystem::path& objFilePath
+    ) -> Expected<std::vector<std::filesystem::path>>
+    {
+        auto diagnostics = DiagnosticBag::Create();
+
+        const auto& packageName = compilation->GetPackage().Name;
+
+        std::vector<std::string> unitNames{};
+        std::vector<llvm::SmallVector<char, 0>> unitBitcodes{};
+        if (compilation->IsSplittingCodegenUnitsByFile())
+        {
+            SplitModuleByFile(
+                module,
+                packageName,
+                functionMap,
+                [&](std::string unitName, std::unique_ptr<llvm::Module> unitModule)
+                {
+                    unitNames.push_back(std::move(unitName));
+                    unitBitcodes.push_back(CreateBitcode(*unitModule));
+                }
+            );
+        }
+        else
+        {
+            llvm::SplitModule(
+                module,
+                static_cast<unsigned>(compilation->GetCodegenUnitCount()),
+                [&](std::unique_ptr<llvm::Module> unitModule)
+                {
+                    unitNames.push_back(packageName + "." + std::to_string(unitNames.size()));
+                    unitBitcodes.push_back(CreateBitcode(*unitModule));
+                }
+            );
+        }
+
+        std::vector<std::filesystem::path> unitObjFilePaths{};
+        for (size_t i = 0; i < unitBitcodes.size(); i++)
+        {
+            auto unitObjFilePath = objFilePath;
+            unitObjFilePath.replace_extension(std::to_string(i) + ".obj");
+            unitObjFilePaths.push_back(std::move(unitObjFilePath));
+        }
+
+        std::vector<DiagnosticBag> unitDiagnostics(
+            unitBitcodes.size(), DiagnosticBag::Create()
+        );
+        ParallelFor(
+            compilation->GetJobCount(),
+            unitBitcodes.size(),
+            [&](const size_t i)
+            {
+                const auto& bitcode = unitBitcodes.at(i);
+                unitDiagnostics.at(i).Collect(EmitCodegenUnit(
+                    compilation,
+                    unitNames.at(i),
+                    llvm::StringRef{ bitcode.data(), bitcode.size() },
+                    isOptimized,
+                    unitObjFilePaths.at(i)
+                ));
+            }
+        );
+
+        std::for_each(
+            begin(unitDiagnostics),
+            end(unitDiagnostics),
+            [&](DiagnosticBag& unitDiagnosticBag)
+            {
+                diagnostics.Add(std::move(unitDiagnosticBag));
+            }
+        );
+
+        if (diagnostics.HasErrors())
+        {
+            return std::move(diagnostics);
+        }
+
+        return Expected{ std::move(unitObjFilePaths), std::move(diagnostics) };
+    }
+
+    static auto CreateLinkerInputArgs(const std::vector<std::filesystem::path>& filePaths)
+        -> std::string
+    {
+        std::string args{};
+        std::for_each(
+            begin(filePaths),
+            end(filePaths),
+            [&](const std::filesystem::path& filePath)
+            {
+                args += " " + filePath.string();
+            }
+        );
+
+        return args;
+    }
+
     auto Emitter::Emit() -> Expected<void>
     {
         auto diagnostics = DiagnosticBag::Create();
 
+        // The module takes the target's data layout before any IR is emitted, so the optimizer and
+        // code generator agree on type sizes and alignment.
+        const auto optTargetMachine = diagnostics.Collect(CreateTargetMachine(
+            GetModule().getTargetTriple(), GetCompilation()->GetOptimizationLevel()
+        ));
+        if (!optTargetMachine.has_value())
+        {
+            return std::move(diagnostics);
+        }
+
+        auto* const targetMachine = optTargetMachine.value().get();
+        GetModule().setDataLayout(targetMachine->createDataLayout());
+
         const auto& globalScope = GetCompilation()->GetGlobalScope();
         const auto& packageName = GetCompilation()->GetPackage().Name;
 
+        std::optional<TimeScope> optEmitIRTimeScope{};
+        optEmitIRTimeScope.emplace(GetCompilation()->GetTimeTracer(), "Emit IR");
+
         m_C.Initialize(GetContext(), GetModule());
 
         const auto allSymbols = globalScope->CollectAllSymbolsRecursive();
@@ -242,6 +886,12 @@ namespace Ace
             end(functionHeaders),
             [&](const FunctionHeader& header)
             {
+                const TimeScope timeScope{
+                    GetCompilation()->GetTimeTracer(),
+                    "Emit function",
+                    [&]() { return header.Symbol->CreateSignature(); },
+                };
+
                 EmitFunctionBlock(header);
             }
         );
@@ -263,60 +913,183 @@ namespace Ace
             }
         );
 
-        const auto semaFilePath = CreateOutputFilePath(packageName, "sema");
-        const auto bcFilePath = CreateOutputFilePath(packageName, "bc");
-        const auto llFilePath = CreateOutputFilePath(packageName, "ll");
-        const auto optLlFilePath = CreateOutputFilePath(packageName, "opt.ll");
-        const auto objFilePath = CreateOutputFilePath(packageName, "obj");
-        const auto exeFilePath = CreateOutputFilePath(packageName, "");
+        optEmitIRTimeScope.reset();
 
-        // TODO: Enable this in debug only
-        SaveSemasToFile(GetCompilation(), semaFilePath);
+        auto* const compilation = GetCompilation();
+        auto* const timeTracer = compilation->GetTimeTracer();
 
-        std::string originalModuleString{};
-        llvm::raw_string_ostream originalModuleOStream{ originalModuleString };
-        originalModuleOStream << GetModule();
-        originalModuleOStream.flush();
-        originalModuleString.clear();
+        if (compilation->IsEmitting(ArtifactKind::Sema))
+        {
+            const TimeScope timeScope{ timeTracer, "Save semas" };
 
-        // TODO: Make this optional with a CLI option
-        SaveModuleToFile(GetCompilation(), GetModule(), llFilePath);
+            const auto semaFilePath = compilation->CreateArtifactPath(ArtifactKind::Sema);
+            diagnostics.Collect(SaveSemasToFile(compilation, semaFilePath));
+        }
 
-        llvm::LoopAnalysisManager lam{};
-        llvm::FunctionAnalysisManager fam{};
-        llvm::CGSCCAnalysisManager cgam{};
-        llvm::ModuleAnalysisManager mam{};
+        if (compilation->IsEmitting(ArtifactKind::Ll))
+        {
+            const TimeScope timeScope{ timeTracer, "Save IR" };
 
-        llvm::PassBuilder pb{};
+            const auto llFilePath = compilation->CreateArtifactPath(ArtifactKind::Ll);
+            diagnostics.Collect(SaveModuleToFile(GetModule(), llFilePath));
+        }
 
-        pb.registerModuleAnalyses(mam);
-        pb.registerCGSCCAnalyses(cgam);
-        pb.registerFunctionAnalyses(fam);
-        pb.registerLoopAnalyses(lam);
-        pb.crossRegisterProxies(lam, fam, cgam, mam);
+        const bool isEmittingObj = compilation->IsEmitting(ArtifactKind::Exe) ||
+                                   compilation->IsEmitting(ArtifactKind::Obj);
+        const bool isOptimizing = isEmittingObj ||
+                                  compilation->IsEmitting(ArtifactKind::Bc) ||
+                                  compilation->IsEmitting(ArtifactKind::OptLl);
+        if (!isOptimizing)
+        {
+            if (diagnostics.HasErrors())
+            {
+                return std::move(diagnostics);
+            }
+
+            return Void{ std::move(diagnostics) };
+        }
 
-        auto mpm = pb.buildPerModuleDefaultPipeline(llvm::OptimizationLevel::O3);
+        const auto objFilePath = compilation->CreateArtifactPath(ArtifactKind::Obj);
+
+        const bool isEmittingOptimizedModule = compilation->IsEmitting(ArtifactKind::Bc) ||
+                                               compilation->IsEmitting(ArtifactKind::OptLl);
+
+        // Codegen units optimize themselves, unless an optimized module artifact needs the whole
+        // module optimized first.
+        const bool isSplittingModule = isEmittingObj &&
+                                       ((compilation->GetCodegenUnitCount() > 1) ||
+                                        compilation->IsSplittingCodegenUnitsByFile());
+        const bool isOptimizingModule = !isSplittingModule || isEmittingOptimizedModule;
+
+        // A cached object file can only stand in for the optimizer when no optimized module
+        // artifact was requested as well.
+        const bool isCachingObj = isEmittingObj &&
+                                  !isSplittingModule &&
+                                  compilation->IsUsingBuildCache() &&
+                                  !isEmittingOptimizedModule;
+        std::optional<uint64_t> optModuleHash{};
+        if (isCachingObj)
+        {
+            const TimeScope timeScope{ timeTracer, "Hash module" };
+            const auto bitcode = CreateBitcode(GetModule());
+            optModuleHash = CreateObjectFileHash(
+                llvm::StringRef{ bitcode.data(), bitcode.size() },
+                compilation->GetOptimizationLevel(),
+                GetModule().getTargetTriple()
+            );
+        }
 
-        mpm.run(GetModule(), mam);
+        const bool isObjFileRestored =
+            optModuleHash.has_value() &&
+            BuildCache::TryRestoreObjectFile(
+                compilation, packageName, optModuleHash.value(), objFilePath
+            );
 
-        // TODO: Make this optional with a CLI option
-        SaveModuleToFile(GetCompilation(), GetModule(), optLlFilePath);
+        if (isOptimizingModule && !isObjFileRestored)
+        {
+            const TimeScope timeScope{ timeTracer, "Optimize module" };
+            OptimizeModule(GetModule(), compilation->GetOptimizationLevel());
+        }
 
-        std::error_code errorCode{};
-        llvm::raw_fd_ostream bitcodeFileOStream{
-            bcFilePath.string(),
-            errorCode,
-            llvm::sys::fs::OF_None,
-        };
-        ACE_ASSERT(!errorCode);
-        llvm::WriteBitcodeToFile(GetModule(), bitcodeFileOStream);
-        bitcodeFileOStream.close();
+        if (compilation->IsEmitting(ArtifactKind::OptLl))
+        {
+            const TimeScope timeScope{ timeTracer, "Save optimized IR" };
+
+            const auto optLlFilePath = compilation->CreateArtifactPath(ArtifactKind::OptLl);
+            diagnostics.Collect(SaveModuleToFile(GetModule(), optLlFilePath));
+        }
+
+        if (compilation->IsEmitting(ArtifactKind::Bc))
+        {
+            const TimeScope timeScope{ timeTracer, "Write bitcode" };
+
+            const auto bcFilePath = compilation->CreateArtifactPath(ArtifactKind::Bc);
+            diagnostics.Collect(SaveBitcodeToFile(GetModule(), bcFilePath));
+        }
+
+        if (!isEmittingObj)
+        {
+            if (diagnostics.HasErrors())
+            {
+                return std::move(diagnostics);
+            }
+
+            return Void{ std::move(diagnostics) };
+        }
+
+        std::vector<std::filesystem::path> objFilePaths{};
+        if (isSplittingModule)
+        {
+            const TimeScope timeScope{ timeTracer, "Emit codegen units" };
+
+            auto optUnitObjFilePaths = diagnostics.Collect(
+                EmitCodegenUnits(
+                    compilation, GetModule(), m_FunctionMap, isOptimizingModule, objFilePath
+                )
+            );
+            if (!optUnitObjFilePaths.has_value())
+            {
+                return std::move(diagnostics);
+            }
+
+            objFilePaths = std::move(optUnitObjFilePaths.value());
+        }
+        else
+        {
+            if (!isObjFileRestored)
+            {
+                const TimeScope timeScope{ timeTracer, "Emit object file" };
+
+                const auto didEmitObjectFile =
+                    diagnostics.Collect(EmitObjectFile(targetMachine, GetModule(), objFilePath));
+                if (!didEmitObjectFile)
+                {
+                    return std::move(diagnostics);
+                }
+
+                if (optModuleHash.has_value())
+                {
+                    BuildCache::StoreObjectFile(
+                        compilation, packageName, optModuleHash.value(), objFilePath
+                    );
+                }
+            }
+
+            objFilePaths.push_back(objFilePath);
+        }
+
+        const auto linkerInputArgs = CreateLinkerInputArgs(objFilePaths);
+
+        if (isSplittingModule && compilation->IsEmitting(ArtifactKind::Obj))
+        {
+            const TimeScope timeScope{ timeTracer, "Merge codegen units" };
+
+            system(("clang -r -o " + objFilePath.string() + linkerInputArgs).c_str());
+        }
+
+        if (compilation->IsEmitting(ArtifactKind::Exe))
+        {
+            const TimeScope timeScope{ timeTracer, "clang" };
+
+            const auto exeFilePath = compilation->CreateArtifactPath(ArtifactKind::Exe);
+            system(("clang -lc -lm -o " + exeFilePath.string() + linkerInputArgs).c_str());
+        }
 
-        system(("llc -O3 -opaque-pointers -relocation-model=pic -filetype=obj -o " +
-                objFilePath.string() + " " + bcFilePath.string())
-                   .c_str());
+        // Object files are only inputs to the linker unless `obj` was requested itself.
+        std::for_each(
+            begin(objFilePaths),
+            end(objFilePaths),
+            [&](const std::filesystem::path& filePath)
+            {
+                if ((filePath == objFilePath) && compilation->IsEmitting(ArtifactKind::Obj))
+                {
+                    return;
+                }
 
-        system(("clang -lc -lm -o " + exeFilePath.string() + " " + objFilePath.string()).c_str());
+                std::error_code errorCode{};
+                std::filesystem::remove(filePath, errorCode);
+            }
+        );
 
         if (diagnostics.HasErrors())
         {
@@ -340,7 +1113,7 @@ namespace Ace
                 CreateInstantiated<ISizedTypeSymbol>(paramSymbol->GetSizedType());
 
             auto* const allocaInst = GetBlock().Builder.CreateAlloca(
-                GetType(typeSymbol), nullptr, paramSymbol->GetName().String
+                GetType(typeSymbol), nullptr, paramSymbol->GetName().String.GetString()
             );
 
             EmitCopy(allocaInst, m_Function->arg_begin() + i, typeSymbol);
@@ -372,8 +1145,9 @@ namespace Ace
                 auto* const varSymbol = symbolIndexPair.LocalVarSymbol;
                 auto* const type = GetType(varSymbol->GetType());
                 ACE_ASSERT(!m_LocalVarMap.contains(varSymbol));
-                m_LocalVarMap[varSymbol] =
-                    GetBlock().Builder.CreateAlloca(type, nullptr, varSymbol->GetName().String);
+                m_LocalVarMap[varSymbol] = GetBlock().Builder.CreateAlloca(
+                    type, nullptr, varSymbol->GetName().String.GetString()
+                );
             }
         );
 
@@ -445,7 +1219,12 @@ namespace Ace
                     if (blockEndStmt)
                     {
                         const auto blockScope = blockEndStmt->GetBodyScope();
-                        auto blockVarSymbols = blockScope->CollectSymbols<LocalVarSymbol>();
+                        const auto declaredBlockVarSymbols =
+                            blockScope->CollectSymbols<LocalVarSymbol>();
+                        std::vector<LocalVarSymbol*> blockVarSymbols{
+                            begin(declaredBlockVarSymbols),
+                            end(declaredBlockVarSymbols),
+                        };
 
                         std::sort(
                             begin(blockVarSymbols),
@@ -627,8 +1406,15 @@ namespace Ace
         );
     }
 
+    // Strings are constant and `unnamed_addr`, so every use of the same characters shares one.
     auto Emitter::EmitString(const std::string_view string) -> llvm::Value*
     {
+        const auto stringIt = m_StringMap.find(string);
+        if (stringIt != end(m_StringMap))
+        {
+            return stringIt->second;
+        }
+
         auto* const charType = llvm::Type::getInt8Ty(GetContext());
 
         std::vector<llvm::Constant*> chars(string.size());
@@ -649,6 +1435,7 @@ namespace Ace
         );
         globalVar->setUnnamedAddr(llvm::GlobalValue::UnnamedAddr::Global);
 
+        m_StringMap.emplace(string, globalVar);
         return globalVar;
     }
 
@@ -815,6 +1602,24 @@ namespace Ace
         return globalVar;
     }
 
+    // Type infos and vtbls are named after their symbol instead of numbered, so codegen units that
+    // refer to them keep their bitcode when unrelated code adds anonymous names. A name that is
+    // already taken falls back to a numbered one.
+    static auto CreateSymbolGlobalName(
+        const llvm::Module& module,
+        const std::string& kind,
+        const std::string& signature
+    ) -> std::string
+    {
+        auto name = "?" + AnonymousIdent::Concat(kind, signature);
+        if (module.getNamedValue(name))
+        {
+            return AnonymousIdent::Create(kind, signature);
+        }
+
+        return name;
+    }
+
     auto Emitter::EmitTypeInfos(const std::vector<ITypeSymbol*>& symbols) -> void
     {
         std::vector<TypeInfoHeader> headers{};
@@ -866,7 +1671,9 @@ namespace Ace
         auto* const type = llvm::StructType::get(GetContext(), elements);
 
         auto* const globalVar = EmitGlobalVar(
-            AnonymousIdent::Create("type_info", symbol->CreateSignature()), type, true
+            CreateSymbolGlobalName(GetModule(), "type_info", symbol->CreateSignature()),
+            type,
+            true
         );
         m_TypeInfoMap[symbol] = globalVar;
 
@@ -1047,7 +1854,7 @@ namespace Ace
         }
 
         m_VtblMap[implSymbol->GetTrait()][implSymbol->GetType()] = EmitGlobalVar(
-            AnonymousIdent::Create("vtbl", implSymbol->CreateSignature()),
+            CreateSymbolGlobalName(GetModule(), "vtbl", implSymbol->CreateSignature()),
             type,
             true,
             llvm::ConstantArray::get(type, elements)
@@ -1268,18 +2075,4 @@ namespace Ace
 
         return GetFunction(concreteTypeSymbol->GetDropGlue().value());
     }
-
-    auto
-    Emitter::CreateOutputFilePath(const std::string_view name, const std::string_view extension)
-        -> std::filesystem::path
-    {
-        std::string fileName{ name };
-        if (!extension.empty())
-        {
-            fileName += ".";
-            fileName += extension;
-        }
-
-        return GetCompilation()->GetOutputPath() / fileName;
-    }
 }
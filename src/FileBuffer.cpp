@@ -5,7 +5,11 @@
 #include <string_view>
 #include <filesystem>
 #include <fstream>
+#include <system_error>
+#include <algorithm>
+#include <iterator>
 
+#include "Assert.hpp"
 #include "Diagnostic.hpp"
 #include "Diagnostics/FileSystemDiagnostics.hpp"
 
@@ -29,40 +33,32 @@ namespace Ace
             return std::move(diagnostics);
         }
 
+        std::error_code errorCode{};
+        const auto fileSize = std::filesystem::file_size(path, errorCode);
+        if (errorCode)
+        {
+            diagnostics.Add(CreateFileOpenError(path));
+            return std::move(diagnostics);
+        }
+
+        // The file is read with one call into a buffer sized up front, with room for the newline
+        // that terminates the last line.
         std::string buffer{};
-        std::vector<std::pair<size_t, size_t>> lineBeginEndIndexPairs{};
+        buffer.reserve(fileSize + 1);
+        buffer.resize(fileSize);
+        fileStream.read(buffer.data(), static_cast<std::streamsize>(fileSize));
+        buffer.resize(static_cast<size_t>(fileStream.gcount()));
 
-        std::string line{};
-        while (std::getline(fileStream, line))
+        if (!buffer.empty() && (buffer.back() != '\n'))
         {
-            const auto beginIndex = buffer.size();
-            buffer += line;
-            const auto endIndex = buffer.size();
-
-            lineBeginEndIndexPairs.emplace_back(beginIndex, endIndex);
             buffer += '\n';
         }
 
-        std::vector<std::string_view> lines{};
-        std::transform(
-            begin(lineBeginEndIndexPairs),
-            end(lineBeginEndIndexPairs),
-            back_inserter(lines),
-            [&](const std::pair<size_t, size_t>& lineBeginEndIndexPair)
-            {
-                return std::string_view{
-                    begin(buffer) + lineBeginEndIndexPair.first,
-                    begin(buffer) + lineBeginEndIndexPair.second,
-                };
-            }
-        );
-
         return {
             std::shared_ptr<const FileBuffer>(new FileBuffer{
                 compilation,
                 path,
                 std::move(buffer),
-                std::move(lines),
                 SourceOrigin::User,
             }),
             std::move(diagnostics),
@@ -76,34 +72,10 @@ namespace Ace
         const SourceOrigin origin
     ) -> std::shared_ptr<const FileBuffer>
     {
-        std::string buffer{ string };
-
-        std::vector<std::string_view> lines{};
-        size_t i = 0;
-
-        if (buffer.front() == '\n')
-        {
-            lines.emplace_back(begin(buffer), begin(buffer));
-            i++;
-        }
-
-        while (i < buffer.size())
-        {
-            size_t j = i + 1;
-            while ((j < buffer.size()) && (buffer.at(j) != '\n'))
-            {
-                ++j;
-            }
-
-            lines.emplace_back(begin(buffer) + i, begin(buffer) + j);
-            i = j + 1;
-        }
-
         return std::shared_ptr<const FileBuffer>(new FileBuffer{
             compilation,
             path,
-            std::move(buffer),
-            std::move(lines),
+            std::string{ string },
             origin,
         });
     }
@@ -123,9 +95,30 @@ namespace Ace
         return m_Path;
     }
 
-    auto FileBuffer::GetLines() const -> const std::vector<std::string_view>&
+    auto FileBuffer::GetLineCount() const -> size_t
     {
-        return m_Lines;
+        return m_LineBeginIndices.size();
+    }
+
+    auto FileBuffer::GetLine(const size_t lineIndex) const -> std::string_view
+    {
+        ACE_ASSERT(lineIndex < m_LineBeginIndices.size());
+
+        const auto beginIndex = m_LineBeginIndices.at(lineIndex);
+
+        const bool isLastLine = (lineIndex + 1) == m_LineBeginIndices.size();
+        const auto endIndex = [&]() -> size_t
+        {
+            if (!isLastLine)
+            {
+                return m_LineBeginIndices.at(lineIndex + 1) - 1;
+            }
+
+            const bool hasTrailingNewline = !m_Buffer.empty() && (m_Buffer.back() == '\n');
+            return hasTrailingNewline ? (m_Buffer.size() - 1) : m_Buffer.size();
+        }();
+
+        return std::string_view{ m_Buffer }.substr(beginIndex, endIndex - beginIndex);
     }
 
     auto FileBuffer::GetOrigin() const -> SourceOrigin
@@ -135,10 +128,12 @@ namespace Ace
 
     auto FileBuffer::CreateFirstLocation() const -> SrcLocation
     {
+        const auto line = GetLine(0);
+
         return {
             this,
-            begin(m_Lines.front()),
-            begin(m_Lines.front()) + 1,
+            begin(line),
+            begin(line) + 1,
         };
     }
 
@@ -152,37 +147,80 @@ namespace Ace
                std::to_string(characterIndex + 1);
     }
 
+    auto FileBuffer::FindLine(const std::string_view::const_iterator characterIt) const
+        -> std::string_view
+    {
+        return GetLine(FindLineIndex(characterIt));
+    }
+
     FileBuffer::FileBuffer(
         Compilation* const compilation,
         const std::filesystem::path& path,
         std::string&& buffer,
-        std::vector<std::string_view>&& lines,
         const SourceOrigin origin
     )
         : m_Compilation{ compilation },
           m_Path{ path },
           m_Buffer{ std::move(buffer) },
-          m_Lines{ std::move(lines) },
           m_Origin{ origin }
     {
+        m_LineBeginIndices.push_back(0);
+
+        const std::string_view bufferView = m_Buffer;
+        auto newlineIt = std::find(begin(bufferView), end(bufferView), '\n');
+        while (newlineIt != end(bufferView))
+        {
+            const auto lineBeginIndex =
+                static_cast<size_t>(std::distance(begin(bufferView), newlineIt)) + 1;
+            if (lineBeginIndex == bufferView.size())
+            {
+                break;
+            }
+
+            m_LineBeginIndices.push_back(lineBeginIndex);
+            newlineIt = std::find(newlineIt + 1, end(bufferView), '\n');
+        }
     }
 
     auto FileBuffer::FindLineIndex(const std::string_view::const_iterator characterIt) const
         -> size_t
     {
-        auto lineIt = begin(m_Lines);
-        while (characterIt >= end(*lineIt))
+        const auto characterIndex = static_cast<size_t>(
+            std::distance(begin(std::string_view{ m_Buffer }), characterIt)
+        );
+
+        const auto isInLine = [&](const size_t lineIndex) -> bool
         {
-            ++lineIt;
+            const bool isAfterBegin = characterIndex >= m_LineBeginIndices.at(lineIndex);
+            const bool isLastLine = (lineIndex + 1) == m_LineBeginIndices.size();
+            const bool isBeforeEnd =
+                isLastLine || (characterIndex < m_LineBeginIndices.at(lineIndex + 1));
+            return isAfterBegin && isBeforeEnd;
+        };
+
+        const auto lastLineIndex = m_LastLineIndex.load(std::memory_order_relaxed);
+        if (isInLine(lastLineIndex))
+        {
+            return lastLineIndex;
         }
 
-        return std::distance(begin(m_Lines), lineIt);
+        const auto nextLineBeginIndexIt = std::upper_bound(
+            begin(m_LineBeginIndices),
+            end(m_LineBeginIndices),
+            characterIndex
+        );
+        const auto lineIndex = static_cast<size_t>(
+            std::distance(begin(m_LineBeginIndices), nextLineBeginIndexIt) - 1
+        );
+
+        m_LastLineIndex.store(lineIndex, std::memory_order_relaxed);
+        return lineIndex;
     }
 
     auto FileBuffer::FindCharacterIndex(
         const size_t lineIndex, const std::string_view::const_iterator characterIt
     ) const -> size_t
     {
-        return std::distance(begin(m_Lines.at(lineIndex)), characterIt);
+        return std::distance(begin(GetLine(lineIndex)), characterIt);
     }
 }
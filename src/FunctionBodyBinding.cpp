@@ -10,7 +10,7 @@ namespace Ace
 {
     FunctionBlockBinding::FunctionBlockBinding(
         FunctionSymbol* const symbol,
-        const std::optional<std::shared_ptr<const BlockStmtSyntax>>& optBlockSyntax
+        const std::optional<const BlockStmtSyntax*>& optBlockSyntax
     )
         : Symbol{ symbol },
           OptBlockSyntax{ optBlockSyntax }
@@ -0,0 +1,69 @@
+#include "GenericInstanceKey.hpp"
+
+#include <vector>
+#include <optional>
+#include <functional>
+#include <algorithm>
+#include <iterator>
+
+#include "Symbols/Symbol.hpp"
+#include "Symbols/GenericSymbol.hpp"
+#include "Symbols/PrototypeSymbol.hpp"
+#include "Symbols/Types/TypeSymbol.hpp"
+
+namespace Ace
+{
+    static auto CombineHash(const size_t hash, const void* const pointer) -> size_t
+    {
+        const auto pointerHash = std::hash<const void*>{}(pointer);
+        return hash ^ (pointerHash + 0x9e3779b97f4a7c15 + (hash << 6) + (hash >> 2));
+    }
+
+    auto GenericInstanceKeyHash::operator()(const GenericInstanceKey& key) const -> size_t
+    {
+        auto hash = CombineHash(key.TypeArgs.size(), key.Root);
+
+        std::for_each(
+            begin(key.TypeArgs),
+            end(key.TypeArgs),
+            [&](const ISymbol* const typeArg)
+            {
+                hash = CombineHash(hash, typeArg);
+            }
+        );
+
+        return CombineHash(hash, key.SelfType);
+    }
+
+    auto CreateGenericInstanceKey(
+        const IGenericSymbol* const root,
+        const std::vector<ITypeSymbol*>& typeArgs,
+        const std::optional<ITypeSymbol*>& optSelfType
+    ) -> std::optional<GenericInstanceKey>
+    {
+        GenericInstanceKey key{};
+        key.Root = root;
+
+        std::transform(
+            begin(typeArgs),
+            end(typeArgs),
+            back_inserter(key.TypeArgs),
+            [](ITypeSymbol* const typeArg) -> const ISymbol*
+            {
+                return typeArg->GetUnaliased();
+            }
+        );
+
+        if (dynamic_cast<const PrototypeSymbol*>(root->GetUnaliased()))
+        {
+            if (!optSelfType.has_value())
+            {
+                return std::nullopt;
+            }
+
+            key.SelfType = optSelfType.value()->GetUnaliased();
+        }
+
+        return key;
+    }
+}
@@ -15,6 +15,8 @@
 #include "Symbols/GenericSymbol.hpp"
 #include "Symbols/PrototypeSymbol.hpp"
 #include "SymbolParentBinding.hpp"
+#include "BindingSpeculation.hpp"
+#include "AnonymousIdent.hpp"
 
 namespace Ace
 {
@@ -164,6 +166,12 @@ namespace Ace
         const InstantiationContext& context
     ) -> Expected<ISymbol*>
     {
+        BindingSpeculation::OnInstantiate(srcLocation, root, context);
+
+        // Instances are shared by every function that uses them, so they are named by the
+        // process-wide counter even while a function body is bound.
+        const AnonymousIdent::PrefixScope prefixScope{ std::nullopt };
+
         auto diagnostics = DiagnosticBag::Create();
 
         auto& self = root->GetScope()->GetGenericInstantiator();
@@ -188,6 +196,8 @@ namespace Ace
             }
         }
 
+        ACE_ASSERT(!FindInstance(root, context.TypeArgs, context.OptSelfType).has_value());
+
         auto ownedInstance = root->CreateInstantiated(root->GetScope(), context);
 
         auto* const instance = dynamic_cast<IGenericSymbol*>(ownedInstance.get());
@@ -229,20 +239,56 @@ namespace Ace
             return;
         }
 
-        if (!IsInstantiatable(generic))
+        const auto& name = generic->GetName().String;
+
+        const bool isRoot = IsInstantiatable(generic) && !self.m_NameToRootMap.contains(name);
+        if (isRoot)
         {
-            return;
+            self.m_NameToRootMap[name] = generic;
+            self.m_RootToMonosMap[generic] = {};
         }
 
-        const auto& name = generic->GetName().String;
+        self.m_KeyToInstanceMap.try_emplace(self.CreateInstanceKey(generic), generic);
+    }
 
-        if (self.m_NameToRootMap.contains(name))
+    auto GenericInstantiator::OnSymbolRemoved(ISymbol* const symbol) -> void
+    {
+        auto& self = symbol->GetScope()->GetGenericInstantiator();
+
+        auto* const generic = dynamic_cast<IGenericSymbol*>(symbol);
+        if (!generic)
         {
             return;
         }
 
-        self.m_NameToRootMap[name] = generic;
-        self.m_RootToMonosMap[generic] = {};
+        const auto instanceIt = self.m_KeyToInstanceMap.find(self.CreateInstanceKey(generic));
+        if ((instanceIt != end(self.m_KeyToInstanceMap)) && (instanceIt->second == generic))
+        {
+            self.m_KeyToInstanceMap.erase(instanceIt);
+        }
+    }
+
+    auto GenericInstantiator::FindInstance(
+        const IGenericSymbol* const root,
+        const std::vector<ITypeSymbol*>& typeArgs,
+        const std::optional<ITypeSymbol*>& optSelfType
+    ) -> std::optional<ISymbol*>
+    {
+        const auto& self = root->GetScope()->GetGenericInstantiator();
+
+        const auto optKey = CreateGenericInstanceKey(self.FindRoot(root), typeArgs, optSelfType);
+        if (!optKey.has_value())
+        {
+            return std::nullopt;
+        }
+
+        const auto instanceIt = self.m_KeyToInstanceMap.find(optKey.value());
+        if (instanceIt == end(self.m_KeyToInstanceMap))
+        {
+            return std::nullopt;
+        }
+
+        return instanceIt->second;
     }
 
     auto GenericInstantiator::GetGenericRoot(const IGenericSymbol* const instance)
@@ -464,4 +510,24 @@ namespace Ace
 
         return instances;
     }
+
+    auto GenericInstantiator::FindRoot(const IGenericSymbol* const generic) const
+        -> const IGenericSymbol*
+    {
+        const auto rootIt = m_NameToRootMap.find(generic->GetName().String);
+        return (rootIt == end(m_NameToRootMap)) ? generic : rootIt->second;
+    }
+
+    auto GenericInstantiator::CreateInstanceKey(const IGenericSymbol* const instance) const
+        -> GenericInstanceKey
+    {
+        std::optional<ITypeSymbol*> optSelfType{};
+        if (auto* const prototype = dynamic_cast<const PrototypeSymbol*>(instance))
+        {
+            optSelfType = prototype->GetSelfType();
+        }
+
+        return CreateGenericInstanceKey(FindRoot(instance), instance->GetTypeArgs(), optSelfType)
+            .value();
+    }
 }
@@ -0,0 +1,65 @@
+#include "InherentImplIndex.hpp"
+
+#include <vector>
+#include <map>
+#include <algorithm>
+
+#include "Assert.hpp"
+#include "Symbols/Impls/InherentImplSymbol.hpp"
+#include "Symbols/Types/TypeSymbol.hpp"
+#include "Symbols/Types/TypeParamTypeSymbol.hpp"
+
+namespace Ace
+{
+    static auto IsPlaceholderImpl(InherentImplSymbol* const impl) -> bool
+    {
+        return dynamic_cast<TypeParamTypeSymbol*>(impl->GetType()->GetUnaliasedType()) != nullptr;
+    }
+
+    auto InherentImplIndex::Add(InherentImplSymbol* const impl) -> void
+    {
+        CollectBucket(impl).push_back(impl);
+    }
+
+    auto InherentImplIndex::Remove(InherentImplSymbol* const impl) -> void
+    {
+        auto& impls = CollectBucket(impl);
+
+        const auto matchingImplIt = std::find(begin(impls), end(impls), impl);
+        ACE_ASSERT(matchingImplIt != end(impls));
+        impls.erase(matchingImplIt);
+    }
+
+    auto InherentImplIndex::Clear() -> void
+    {
+        m_TypeRootToImplsMap.clear();
+        m_PlaceholderImpls.clear();
+    }
+
+    auto InherentImplIndex::CollectCandidates(ITypeSymbol* const type) const
+        -> std::vector<InherentImplSymbol*>
+    {
+        std::vector<InherentImplSymbol*> impls{};
+
+        const auto typeImplsIt = m_TypeRootToImplsMap.find(type->GetRoot());
+        if (typeImplsIt != end(m_TypeRootToImplsMap))
+        {
+            impls.insert(end(impls), begin(typeImplsIt->second), end(typeImplsIt->second));
+        }
+
+        impls.insert(end(impls), begin(m_PlaceholderImpls), end(m_PlaceholderImpls));
+
+        return impls;
+    }
+
+    auto InherentImplIndex::CollectBucket(InherentImplSymbol* const impl)
+        -> std::vector<InherentImplSymbol*>&
+    {
+        if (IsPlaceholderImpl(impl))
+        {
+            return m_PlaceholderImpls;
+        }
+
+        return m_TypeRootToImplsMap[impl->GetType()->GetRoot()];
+    }
+}
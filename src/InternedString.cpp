@@ -0,0 +1,120 @@
+#include "InternedString.hpp"
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+
+namespace Ace
+{
+    class Interner
+    {
+    public:
+        Interner()
+        {
+            Intern("");
+        }
+
+        auto Intern(const std::string_view string) -> const InternedStringEntry*
+        {
+            {
+                const std::shared_lock lock{ m_Mutex };
+
+                const auto entryIt = m_EntryMap.find(string);
+                if (entryIt != end(m_EntryMap))
+                {
+                    return entryIt->second;
+                }
+            }
+
+            const std::unique_lock lock{ m_Mutex };
+
+            const auto entryIt = m_EntryMap.find(string);
+            if (entryIt != end(m_EntryMap))
+            {
+                return entryIt->second;
+            }
+
+            const auto& entry = m_Entries.emplace_back(InternedStringEntry{
+                std::string{ string },
+                static_cast<uint32_t>(m_Entries.size()),
+            });
+            m_EntryMap.emplace(entry.String, &entry);
+
+            return &entry;
+        }
+
+        auto Reset() -> void
+        {
+            const std::unique_lock lock{ m_Mutex };
+
+            m_Entries.erase(begin(m_Entries) + 1, end(m_Entries));
+            m_EntryMap.clear();
+            m_EntryMap.emplace(m_Entries.front().String, &m_Entries.front());
+        }
+
+        auto GetEmpty() const -> const InternedStringEntry*
+        {
+            return &m_Entries.front();
+        }
+
+    private:
+        std::shared_mutex m_Mutex{};
+        // A deque never moves its elements, so map keys can view the stored strings.
+        std::deque<InternedStringEntry> m_Entries{};
+        std::unordered_map<std::string_view, const InternedStringEntry*> m_EntryMap{};
+    };
+
+    static auto GetInterner() -> Interner&
+    {
+        static Interner interner{};
+        return interner;
+    }
+
+    InternedString::InternedString()
+        : m_Entry{ GetInterner().GetEmpty() }
+    {
+    }
+
+    InternedString::InternedString(const std::string_view string)
+        : m_Entry{ GetInterner().Intern(string) }
+    {
+    }
+
+    InternedString::InternedString(const std::string& string)
+        : InternedString{ std::string_view{ string } }
+    {
+    }
+
+    InternedString::InternedString(const char* const string)
+        : InternedString{ std::string_view{ string } }
+    {
+    }
+
+    auto ResetInternedStrings() -> void
+    {
+        GetInterner().Reset();
+    }
+
+    auto operator+(const std::string& lhs, const InternedString& rhs) -> std::string
+    {
+        return lhs + rhs.GetString();
+    }
+
+    auto operator+(const InternedString& lhs, const std::string& rhs) -> std::string
+    {
+        return lhs.GetString() + rhs;
+    }
+
+    auto operator+(const char* const lhs, const InternedString& rhs) -> std::string
+    {
+        return lhs + rhs.GetString();
+    }
+
+    auto operator+(const InternedString& lhs, const char* const rhs) -> std::string
+    {
+        return lhs.GetString() + rhs;
+    }
+}
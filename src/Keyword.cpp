@@ -1,72 +1,175 @@
 #include "Keyword.hpp"
 
+#include <array>
 #include <string_view>
-#include <unordered_map>
+#include <optional>
+#include <cstdint>
+#include <cstddef>
 
+#include "Assert.hpp"
 #include "TokenKind.hpp"
 
 namespace Ace
 {
-    auto CreateKeywordToTokenKindMap() -> std::unordered_map<std::string_view, TokenKind>
+    struct Keyword
     {
-        return {
-            { "__address_of", TokenKind::AddressOfKeyword },
-            { "__size_of", TokenKind::SizeOfKeyword },
-            { "__deref_as", TokenKind::DerefAsKeyword },
-            { "__copy", TokenKind::CopyKeyword },
-            { "__drop", TokenKind::DropKeyword },
-            { "__type_info_ptr", TokenKind::TypeInfoPtrKeyword },
-            { "__vtbl_ptr", TokenKind::VtblPtrKeyword },
-            { "if", TokenKind::IfKeyword },
-            { "else", TokenKind::ElseKeyword },
-            { "elif", TokenKind::ElifKeyword },
-            { "while", TokenKind::WhileKeyword },
-            { "self", TokenKind::LowerSelfKeyword },
-            { "ret", TokenKind::RetKeyword },
-            { "mod", TokenKind::ModKeyword },
-            { "trait", TokenKind::TraitKeyword },
-            { "struct", TokenKind::StructKeyword },
-            { "op", TokenKind::OpKeyword },
-            { "pub", TokenKind::PubKeyword },
-            { "extern", TokenKind::ExternKeyword },
-            { "cast", TokenKind::CastKeyword },
-            { "exit", TokenKind::ExitKeyword },
-            { "assert", TokenKind::AssertKeyword },
-            { "impl", TokenKind::ImplKeyword },
-            { "for", TokenKind::ForKeyword },
-            { "lock", TokenKind::LockKeyword },
-            { "box", TokenKind::BoxKeyword },
-            { "unbox", TokenKind::UnboxKeyword },
-            { "use", TokenKind::UseKeyword },
-            { "where", TokenKind::WhereKeyword },
-            { "true", TokenKind::TrueKeyword },
-            { "false", TokenKind::FalseKeyword },
-            { "Self", TokenKind::UpperSelfKeyword },
-            { "int", TokenKind::IntKeyword },
-            { "i8", TokenKind::Int8Keyword },
-            { "i16", TokenKind::Int16Keyword },
-            { "i32", TokenKind::Int32Keyword },
-            { "i64", TokenKind::Int64Keyword },
-            { "u8", TokenKind::UInt8Keyword },
-            { "u16", TokenKind::UInt16Keyword },
-            { "u32", TokenKind::UInt32Keyword },
-            { "u64", TokenKind::UInt64Keyword },
-            { "f32", TokenKind::Float32Keyword },
-            { "f64", TokenKind::Float64Keyword },
-            { "bool", TokenKind::BoolKeyword },
-            { "void", TokenKind::VoidKeyword },
-        };
+        std::string_view String{};
+        TokenKind Kind{};
+    };
+
+    // Ordered like the keyword token kinds, so a kind indexes its own entry.
+    static constexpr std::array Keywords{
+        Keyword{ "__address_of", TokenKind::AddressOfKeyword },
+        Keyword{ "__size_of", TokenKind::SizeOfKeyword },
+        Keyword{ "__deref_as", TokenKind::DerefAsKeyword },
+        Keyword{ "__copy", TokenKind::CopyKeyword },
+        Keyword{ "__drop", TokenKind::DropKeyword },
+        Keyword{ "__type_info_ptr", TokenKind::TypeInfoPtrKeyword },
+        Keyword{ "__vtbl_ptr", TokenKind::VtblPtrKeyword },
+        Keyword{ "if", TokenKind::IfKeyword },
+        Keyword{ "else", TokenKind::ElseKeyword },
+        Keyword{ "elif", TokenKind::ElifKeyword },
+        Keyword{ "while", TokenKind::WhileKeyword },
+        Keyword{ "self", TokenKind::LowerSelfKeyword },
+        Keyword{ "ret", TokenKind::RetKeyword },
+        Keyword{ "mod", TokenKind::ModKeyword },
+        Keyword{ "trait", TokenKind::TraitKeyword },
+        Keyword{ "struct", TokenKind::StructKeyword },
+        Keyword{ "op", TokenKind::OpKeyword },
+        Keyword{ "pub", TokenKind::PubKeyword },
+        Keyword{ "extern", TokenKind::ExternKeyword },
+        Keyword{ "cast", TokenKind::CastKeyword },
+        Keyword{ "exit", TokenKind::ExitKeyword },
+        Keyword{ "assert", TokenKind::AssertKeyword },
+        Keyword{ "impl", TokenKind::ImplKeyword },
+        Keyword{ "for", TokenKind::ForKeyword },
+        Keyword{ "lock", TokenKind::LockKeyword },
+        Keyword{ "box", TokenKind::BoxKeyword },
+        Keyword{ "unbox", TokenKind::UnboxKeyword },
+        Keyword{ "use", TokenKind::UseKeyword },
+        Keyword{ "where", TokenKind::WhereKeyword },
+        Keyword{ "true", TokenKind::TrueKeyword },
+        Keyword{ "false", TokenKind::FalseKeyword },
+        Keyword{ "Self", TokenKind::UpperSelfKeyword },
+        Keyword{ "int", TokenKind::IntKeyword },
+        Keyword{ "i8", TokenKind::Int8Keyword },
+        Keyword{ "i16", TokenKind::Int16Keyword },
+        Keyword{ "i32", TokenKind::Int32Keyword },
+        Keyword{ "i64", TokenKind::Int64Keyword },
+        Keyword{ "u8", TokenKind::UInt8Keyword },
+        Keyword{ "u16", TokenKind::UInt16Keyword },
+        Keyword{ "u32", TokenKind::UInt32Keyword },
+        Keyword{ "u64", TokenKind::UInt64Keyword },
+        Keyword{ "f32", TokenKind::Float32Keyword },
+        Keyword{ "f64", TokenKind::Float64Keyword },
+        Keyword{ "bool", TokenKind::BoolKeyword },
+        Keyword{ "void", TokenKind::VoidKeyword },
+    };
+
+    static constexpr auto FirstKeywordTokenKind = TokenKind::AddressOfKeyword;
+    static constexpr auto LastKeywordTokenKind = TokenKind::VoidKeyword;
+
+    static constexpr auto IsKeywordTokenKindInOrder() -> bool
+    {
+        for (size_t i = 0; i < Keywords.size(); i++)
+        {
+            const auto index = static_cast<size_t>(Keywords.at(i).Kind) -
+                static_cast<size_t>(FirstKeywordTokenKind);
+            if (index != i)
+            {
+                return false;
+            }
+        }
+
+        return Keywords.back().Kind == LastKeywordTokenKind;
+    }
+    static_assert(IsKeywordTokenKindInOrder());
+
+    // Keywords are told apart by their length and their first, middle and last character. These
+    // are packed into one word and multiplied, and the top bits of the product select a slot. The
+    // multiplier was searched for offline so that no two keywords share a slot; when a keyword is
+    // added and the assertion below fails, a new one has to be found.
+    static constexpr uint32_t KeywordHashMultiplier = 0x2AF689;
+    static constexpr size_t KeywordHashBitCount = 7;
+    static constexpr size_t KeywordSlotCount = size_t{ 1 } << KeywordHashBitCount;
+    static constexpr uint8_t EmptyKeywordSlot = 0xFF;
+
+    static constexpr auto HashKeyword(const std::string_view string) -> size_t
+    {
+        const uint32_t packed =
+            static_cast<uint32_t>(static_cast<uint8_t>(string.front())) |
+            (static_cast<uint32_t>(static_cast<uint8_t>(string.at(string.size() / 2))) << 8) |
+            (static_cast<uint32_t>(static_cast<uint8_t>(string.back())) << 16) |
+            (static_cast<uint32_t>(string.size()) << 24);
+
+        return static_cast<uint32_t>(packed * KeywordHashMultiplier) >>
+            (32 - KeywordHashBitCount);
     }
 
-    auto CreateTokenToKeywordKindMap() -> std::unordered_map<TokenKind, std::string_view>
+    static constexpr auto CreateKeywordSlots() -> std::array<uint8_t, KeywordSlotCount>
     {
-        std::unordered_map<TokenKind, std::string_view> map{};
-        for (const auto& keywordAndTokenKindPair : CreateKeywordToTokenKindMap())
+        std::array<uint8_t, KeywordSlotCount> slots{};
+        slots.fill(EmptyKeywordSlot);
+
+        for (size_t i = 0; i < Keywords.size(); i++)
         {
-            map[keywordAndTokenKindPair.second] = keywordAndTokenKindPair.first;
+            slots.at(HashKeyword(Keywords.at(i).String)) = static_cast<uint8_t>(i);
         }
 
-        return map;
+        return slots;
+    }
+
+    static constexpr auto KeywordSlots = CreateKeywordSlots();
+
+    static constexpr auto IsKeywordHashPerfect() -> bool
+    {
+        for (size_t i = 0; i < Keywords.size(); i++)
+        {
+            if (KeywordSlots.at(HashKeyword(Keywords.at(i).String)) != i)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+    static_assert(IsKeywordHashPerfect());
+
+    auto FindKeywordTokenKind(const std::string_view string) -> std::optional<TokenKind>
+    {
+        const bool isOutOfRange = string.empty() || (string.size() > 0xFF);
+        if (isOutOfRange)
+        {
+            return std::nullopt;
+        }
+
+        const auto keywordIndex = KeywordSlots[HashKeyword(string)];
+        if (keywordIndex == EmptyKeywordSlot)
+        {
+            return std::nullopt;
+        }
+
+        const auto& keyword = Keywords[keywordIndex];
+        if (keyword.String != string)
+        {
+            return std::nullopt;
+        }
+
+        return keyword.Kind;
+    }
+
+    auto IsKeywordTokenKind(const TokenKind tokenKind) -> bool
+    {
+        return (tokenKind >= FirstKeywordTokenKind) && (tokenKind <= LastKeywordTokenKind);
+    }
+
+    auto GetKeyword(const TokenKind tokenKind) -> std::string_view
+    {
+        ACE_ASSERT(IsKeywordTokenKind(tokenKind));
+
+        const auto index =
+            static_cast<size_t>(tokenKind) - static_cast<size_t>(FirstKeywordTokenKind);
+        return Keywords[index].String;
     }
 
     auto GetTokenKindNativeTypeSymbol(Compilation* const compilation, const TokenKind tokenKind)
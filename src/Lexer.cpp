@@ -3,6 +3,8 @@
 #include <memory>
 #include <vector>
 #include <string>
+#include <string_view>
+#include <optional>
 
 #include "Assert.hpp"
 #include "Diagnostic.hpp"
@@ -11,6 +13,7 @@
 #include "Keyword.hpp"
 #include "String.hpp"
 #include "FileBuffer.hpp"
+#include "LexerScan.hpp"
 #include "Compilation.hpp"
 #include "SrcLocation.hpp"
 
@@ -19,15 +22,14 @@ namespace Ace
     class Lexer
     {
     public:
-        Lexer(const FileBuffer* const fileBuffer)
+        Lexer(const FileBuffer* const fileBuffer, const size_t characterIndex)
             : m_FileBuffer{ fileBuffer }
         {
-            m_LineIterator = begin(m_FileBuffer->GetLines());
+            m_BeginIterator = begin(std::string_view{ m_FileBuffer->GetBuffer() });
+            m_CharacterIterator = m_BeginIterator + characterIndex;
 
-            m_CharacterIterator = begin(*m_LineIterator);
-            m_EndCharacterIterator = end(*m_LineIterator);
-
-            m_SrcLocation = CreateSrcLocation();
+            const auto lastLineIndex = m_FileBuffer->GetLineCount() - 1;
+            m_EndIterator = end(m_FileBuffer->GetLine(lastLineIndex));
         }
 
         ~Lexer() = default;
@@ -39,12 +41,12 @@ namespace Ace
 
         auto IsEnd() const -> bool
         {
-            return m_CharacterIterator == end(m_FileBuffer->GetLines().back());
+            return m_CharacterIterator == m_EndIterator;
         }
 
         auto IsEndOfLine() const -> bool
         {
-            return m_CharacterIterator == m_EndCharacterIterator;
+            return IsEnd() || (Peek() == '\n');
         }
 
         auto Peek(const size_t distance = 0) const -> char
@@ -52,123 +54,148 @@ namespace Ace
             return *(m_CharacterIterator + distance);
         }
 
-        auto GetSrcLocation() const -> SrcLocation
+        auto GetBeginIterator() const -> std::string_view::const_iterator
         {
-            return m_SrcLocation;
+            return m_BeginIterator;
         }
 
-        auto GetLastSrcLocation() const -> SrcLocation
+        auto GetIterator() const -> std::string_view::const_iterator
         {
-            return m_LastSrcLocation;
+            return m_CharacterIterator;
         }
 
-        auto Eat() -> char
+        auto GetEndIterator() const -> std::string_view::const_iterator
         {
-            const auto beginSrcLocation = m_SrcLocation;
-
-            if (IsEndOfLine())
-            {
-                ACE_ASSERT(!IsEnd());
+            return m_EndIterator;
+        }
 
-                m_LineIterator++;
+        auto GetSrcLocation() const -> SrcLocation
+        {
+            return {
+                m_FileBuffer,
+                m_CharacterIterator,
+                m_CharacterIterator + 1,
+            };
+        }
 
-                m_CharacterIterator = begin(*m_LineIterator);
-                m_EndCharacterIterator = end(*m_LineIterator);
-            }
-            else
+        auto GetLastSrcLocation() const -> SrcLocation
+        {
+            if (m_CharacterIterator == m_BeginIterator)
             {
-                m_CharacterIterator++;
+                return { m_FileBuffer, m_CharacterIterator, m_CharacterIterator };
             }
 
-            m_LastSrcLocation = beginSrcLocation;
-            m_SrcLocation = CreateSrcLocation();
+            return {
+                m_FileBuffer,
+                m_CharacterIterator - 1,
+                m_CharacterIterator,
+            };
+        }
 
-            return *beginSrcLocation.CharacterBeginIterator;
+        auto Eat() -> char
+        {
+            ACE_ASSERT(!IsEnd());
+            return *(m_CharacterIterator++);
         }
 
         auto Eat(const size_t count) -> void
         {
-            for (size_t i = 0; i < count; i++)
-            {
-                Eat();
-            }
+            ACE_ASSERT(count <= static_cast<size_t>(m_EndIterator - m_CharacterIterator));
+            m_CharacterIterator += count;
         }
 
-    private:
-        auto CreateSrcLocation() const -> SrcLocation
+        // Eats every character before `it`, which a scan from `GetIterator()` found.
+        auto EatUntil(const std::string_view::const_iterator it) -> void
         {
-            return {
-                m_FileBuffer,
-                m_CharacterIterator,
-                m_CharacterIterator + 1,
-            };
+            ACE_ASSERT(it >= m_CharacterIterator);
+            ACE_ASSERT(it <= m_EndIterator);
+            m_CharacterIterator = it;
         }
 
+    private:
         const FileBuffer* m_FileBuffer{};
 
-        std::vector<std::string_view>::const_iterator m_LineIterator{};
-
+        std::string_view::const_iterator m_BeginIterator{};
         std::string_view::const_iterator m_CharacterIterator{};
-        std::string_view::const_iterator m_EndCharacterIterator{};
-
-        SrcLocation m_SrcLocation{};
-        SrcLocation m_LastSrcLocation{};
+        std::string_view::const_iterator m_EndIterator{};
     };
 
     static auto
-    CreateNumericLiteralTokenKind(const SrcLocation& srcLocation, const std::string& suffix)
+    CreateNumericLiteralTokenKind(const SrcLocation& srcLocation, const std::string_view suffix)
         -> Expected<TokenKind>
     {
         auto diagnostics = DiagnosticBag::Create();
 
-        if (suffix == TokenKindToKeywordMap.at(TokenKind::Int8Keyword))
+        const auto optKeywordTokenKind = FindKeywordTokenKind(suffix);
+        const auto optTokenKind = [&]() -> std::optional<TokenKind>
         {
-            return Expected{ TokenKind::Int8, std::move(diagnostics) };
-        }
+            if (!optKeywordTokenKind.has_value())
+            {
+                return std::nullopt;
+            }
 
-        if (suffix == TokenKindToKeywordMap.at(TokenKind::Int16Keyword))
-        {
-            return Expected{ TokenKind::Int16, std::move(diagnostics) };
-        }
+            switch (optKeywordTokenKind.value())
+            {
+                case TokenKind::Int8Keyword:
+                {
+                    return TokenKind::Int8;
+                }
 
-        if (suffix == TokenKindToKeywordMap.at(TokenKind::Int32Keyword))
-        {
-            return Expected{ TokenKind::Int32, std::move(diagnostics) };
-        }
+                case TokenKind::Int16Keyword:
+                {
+                    return TokenKind::Int16;
+                }
 
-        if (suffix == TokenKindToKeywordMap.at(TokenKind::Int64Keyword))
-        {
-            return Expected{ TokenKind::Int64, std::move(diagnostics) };
-        }
+                case TokenKind::Int32Keyword:
+                {
+                    return TokenKind::Int32;
+                }
 
-        if (suffix == TokenKindToKeywordMap.at(TokenKind::UInt8Keyword))
-        {
-            return Expected{ TokenKind::UInt8, std::move(diagnostics) };
-        }
+                case TokenKind::Int64Keyword:
+                {
+                    return TokenKind::Int64;
+                }
 
-        if (suffix == TokenKindToKeywordMap.at(TokenKind::UInt16Keyword))
-        {
-            return Expected{ TokenKind::UInt16, std::move(diagnostics) };
-        }
+                case TokenKind::UInt8Keyword:
+                {
+                    return TokenKind::UInt8;
+                }
 
-        if (suffix == TokenKindToKeywordMap.at(TokenKind::UInt32Keyword))
-        {
-            return Expected{ TokenKind::UInt32, std::move(diagnostics) };
-        }
+                case TokenKind::UInt16Keyword:
+                {
+                    return TokenKind::UInt16;
+                }
 
-        if (suffix == TokenKindToKeywordMap.at(TokenKind::UInt64Keyword))
-        {
-            return Expected{ TokenKind::UInt64, std::move(diagnostics) };
-        }
+                case TokenKind::UInt32Keyword:
+                {
+                    return TokenKind::UInt32;
+                }
 
-        if (suffix == TokenKindToKeywordMap.at(TokenKind::Float32Keyword))
-        {
-            return Expected{ TokenKind::Float32, std::move(diagnostics) };
-        }
+                case TokenKind::UInt64Keyword:
+                {
+                    return TokenKind::UInt64;
+                }
+
+                case TokenKind::Float32Keyword:
+                {
+                    return TokenKind::Float32;
+                }
+
+                case TokenKind::Float64Keyword:
+                {
+                    return TokenKind::Float64;
+                }
 
-        if (suffix == TokenKindToKeywordMap.at(TokenKind::Float64Keyword))
+                default:
+                {
+                    return std::nullopt;
+                }
+            }
+        }();
+
+        if (optTokenKind.has_value())
         {
-            return Expected{ TokenKind::Float64, std::move(diagnostics) };
+            return Expected{ optTokenKind.value(), std::move(diagnostics) };
         }
 
         diagnostics.Add(CreateUnknownNumericLiteralTypeSuffixError(srcLocation));
@@ -180,25 +207,14 @@ namespace Ace
         return IsInAlphabet(lexer.Peek()) || (lexer.Peek() == '_');
     }
 
-    static auto IsIdentContinue(const Lexer& lexer) -> bool
-    {
-        return IsIdentBegin(lexer) || IsNumber(lexer.Peek());
-    }
-
     static auto IsNumericLiteralNumberBegin(const Lexer& lexer) -> bool
     {
         return IsNumber(lexer.Peek());
     }
 
-    static auto IsNumericLiteralNumberContinue(const Lexer& lexer, const bool hasDecimalPoint)
-        -> bool
+    static auto IsNumericLiteralDecimalPoint(const Lexer& lexer) -> bool
     {
-        if (IsNumericLiteralNumberBegin(lexer))
-        {
-            return true;
-        }
-
-        return (lexer.Peek(0) == '.') && IsNumber(lexer.Peek(1)) && !hasDecimalPoint;
+        return (lexer.Peek(0) == '.') && IsNumber(lexer.Peek(1));
     }
 
     static auto IsNumericLiteralSuffixBegin(const Lexer& lexer) -> bool
@@ -206,11 +222,6 @@ namespace Ace
         return IsInAlphabet(lexer.Peek());
     }
 
-    static auto IsNumericLiteralSuffixContinue(const Lexer& lexer) -> bool
-    {
-        return IsNumber(lexer.Peek());
-    }
-
     static auto IsNumericLiteralBegin(const Lexer& lexer) -> bool
     {
         return IsNumericLiteralNumberBegin(lexer);
@@ -237,31 +248,25 @@ namespace Ace
         const auto beginSrcLocation = lexer.GetSrcLocation();
 
         ACE_ASSERT(IsIdentBegin(lexer));
-        std::string string{ lexer.Eat() };
-        while (IsIdentContinue(lexer))
-        {
-            string += lexer.Eat();
-        }
+        lexer.Eat();
+        lexer.EatUntil(ScanIdentContinue(lexer.GetIterator(), lexer.GetEndIterator()));
 
         const SrcLocation srcLocation{
             beginSrcLocation,
             lexer.GetLastSrcLocation(),
         };
+        const std::string_view string{
+            srcLocation.CharacterBeginIterator,
+            srcLocation.CharacterEndIterator,
+        };
 
-        const auto keywordTokenKindIt = KeywordToTokenKindMap.find(string);
-        if (keywordTokenKindIt != end(KeywordToTokenKindMap))
+        const auto optKeywordTokenKind = FindKeywordTokenKind(string);
+        if (optKeywordTokenKind.has_value())
         {
-            return Token{
-                srcLocation,
-                keywordTokenKindIt->second,
-            };
+            return Token::Create(srcLocation, optKeywordTokenKind.value());
         }
 
-        return Token{
-            srcLocation,
-            TokenKind::Ident,
-            string,
-        };
+        return Token::Create(srcLocation, TokenKind::Ident, string.size());
     }
 
     static auto LexNumericLiteral(Lexer& lexer) -> Diagnosed<Token>
@@ -271,27 +276,32 @@ namespace Ace
         const auto beginSrcLocation = lexer.GetSrcLocation();
 
         ACE_ASSERT(IsNumericLiteralNumberBegin(lexer));
-        std::string numberString{ lexer.Eat() };
-        bool hasDecimalPoint = false;
-        while (IsNumericLiteralNumberContinue(lexer, hasDecimalPoint))
-        {
-            if (lexer.Peek() == '.')
-            {
-                hasDecimalPoint = true;
-            }
+        lexer.Eat();
+        lexer.EatUntil(ScanNumber(lexer.GetIterator(), lexer.GetEndIterator()));
 
-            numberString += lexer.Eat();
+        // A number has at most one decimal point, which must be followed by a digit.
+        if (IsNumericLiteralDecimalPoint(lexer))
+        {
+            lexer.Eat();
+            lexer.EatUntil(ScanNumber(lexer.GetIterator(), lexer.GetEndIterator()));
         }
 
         const auto suffixBeginSrcLocation = lexer.GetSrcLocation();
-        std::string suffix{};
+        std::string_view numberString{
+            beginSrcLocation.CharacterBeginIterator,
+            suffixBeginSrcLocation.CharacterBeginIterator,
+        };
+
+        std::string_view suffix{};
         if (IsNumericLiteralSuffixBegin(lexer))
         {
-            suffix += lexer.Eat();
-            while (IsNumericLiteralSuffixContinue(lexer))
-            {
-                suffix += lexer.Eat();
-            }
+            lexer.Eat();
+            lexer.EatUntil(ScanNumber(lexer.GetIterator(), lexer.GetEndIterator()));
+
+            suffix = std::string_view{
+                suffixBeginSrcLocation.CharacterBeginIterator,
+                lexer.GetLastSrcLocation().CharacterEndIterator,
+            };
         }
 
         auto tokenKind = TokenKind::Int;
@@ -310,7 +320,7 @@ namespace Ace
         }
 
         const auto decimalPointPos = numberString.find_first_of('.');
-        if (decimalPointPos != std::string::npos)
+        if (decimalPointPos != std::string_view::npos)
         {
             const bool isFloatKind =
                 (tokenKind == TokenKind::Float32) || (tokenKind == TokenKind::Float64);
@@ -327,14 +337,16 @@ namespace Ace
                     CreateDecimalPointInNonFloatNumericLiteralError(decimalPointSrcLocation)
                 );
 
-                numberString.erase(decimalPointPos);
+                numberString = numberString.substr(0, decimalPointPos);
             }
         }
 
         return Diagnosed{
-            Token{ SrcLocation{ beginSrcLocation, lexer.GetLastSrcLocation() },
-                   tokenKind,
-                   numberString },
+            Token::Create(
+                SrcLocation{ beginSrcLocation, lexer.GetLastSrcLocation() },
+                tokenKind,
+                numberString.size()
+            ),
             std::move(diagnostics),
         };
     }
@@ -793,8 +805,10 @@ namespace Ace
         }
 
         return Expected{
-            Token{ SrcLocation{ beginSrcLocation, lexer.GetLastSrcLocation() },
-                   optTokenKind.value() },
+            Token::Create(
+                SrcLocation{ beginSrcLocation, lexer.GetLastSrcLocation() },
+                optTokenKind.value()
+            ),
             std::move(diagnostics),
         };
     }
@@ -808,11 +822,9 @@ namespace Ace
         ACE_ASSERT(lexer.Peek() == '"');
         lexer.Eat();
 
-        std::string value{};
-        while (!lexer.IsEndOfLine() && (lexer.Peek() != '"'))
-        {
-            value += lexer.Eat();
-        }
+        const auto valueBeginIt = lexer.GetIterator();
+        lexer.EatUntil(FindEitherCharacter(valueBeginIt, lexer.GetEndIterator(), '"', '\n'));
+        const auto valueLength = static_cast<size_t>(lexer.GetIterator() - valueBeginIt);
 
         if (lexer.Peek() == '"')
         {
@@ -825,11 +837,11 @@ namespace Ace
         }
 
         return Diagnosed{
-            Token{
+            Token::Create(
                 SrcLocation{ beginSrcLocation, lexer.GetLastSrcLocation() },
                 TokenKind::String,
-                value,
-            },
+                valueLength
+            ),
             std::move(diagnostics),
         };
     }
@@ -877,8 +889,14 @@ namespace Ace
         ACE_ASSERT(lexer.Peek() == ':');
         lexer.Eat();
 
-        while (!lexer.IsEnd() && !IsMultiLineCommentEnd(lexer))
+        while (true)
         {
+            lexer.EatUntil(FindCharacter(lexer.GetIterator(), lexer.GetEndIterator(), ':'));
+            if (lexer.IsEnd() || IsMultiLineCommentEnd(lexer))
+            {
+                break;
+            }
+
             lexer.Eat();
         }
 
@@ -906,10 +924,7 @@ namespace Ace
 
         ACE_ASSERT(lexer.Peek() != ':');
 
-        while (!lexer.IsEndOfLine())
-        {
-            lexer.Eat();
-        }
+        lexer.EatUntil(FindCharacter(lexer.GetIterator(), lexer.GetEndIterator(), '\n'));
     }
 
     static auto DiscardComment(Lexer& lexer) -> Diagnosed<void>
@@ -932,19 +947,36 @@ namespace Ace
 
     static auto DiscardWhitespace(Lexer& lexer) -> void
     {
-        while (!lexer.IsEnd() && IsWhitespace(lexer))
-        {
-            lexer.Eat();
-        }
+        lexer.EatUntil(ScanWhitespace(lexer.GetIterator(), lexer.GetEndIterator()));
     }
 
-    auto LexTokens(const FileBuffer* const fileBuffer) -> Diagnosed<std::vector<Token>>
+    TokenStream::TokenStream(const FileBuffer* const fileBuffer)
+        : m_FileBuffer{ fileBuffer }
+    {
+    }
+
+    TokenStream::TokenStream(const FileBuffer* const fileBuffer, const size_t characterIndex)
+        : m_FileBuffer{ fileBuffer },
+          m_CharacterIndex{ characterIndex }
+    {
+    }
+
+    auto TokenStream::GetFileBuffer() const -> const FileBuffer*
+    {
+        return m_FileBuffer;
+    }
+
+    auto TokenStream::LexNext() -> Diagnosed<Token>
     {
         auto diagnostics = DiagnosticBag::Create();
 
-        Lexer lexer{ fileBuffer };
+        Lexer lexer{ m_FileBuffer, m_CharacterIndex };
+
+        const auto updateCharacterIndex = [&]() -> void
+        {
+            m_CharacterIndex = static_cast<size_t>(lexer.GetIterator() - lexer.GetBeginIterator());
+        };
 
-        std::vector<Token> tokens{};
         while (!lexer.IsEnd())
         {
             if (IsWhitespace(lexer))
@@ -959,18 +991,35 @@ namespace Ace
                 continue;
             }
 
-            auto optToken = diagnostics.Collect(Lex(lexer));
-            if (optToken.has_value())
-            {
-                tokens.push_back(std::move(optToken.value()));
-            }
-            else
+            const auto optToken = diagnostics.Collect(Lex(lexer));
+            if (!optToken.has_value())
             {
                 lexer.Eat();
+                continue;
             }
+
+            updateCharacterIndex();
+            return Diagnosed{ optToken.value(), std::move(diagnostics) };
         }
 
-        tokens.emplace_back(lexer.GetLastSrcLocation(), TokenKind::EndOfFile);
+        updateCharacterIndex();
+        return Diagnosed{
+            Token::Create(lexer.GetLastSrcLocation(), TokenKind::EndOfFile),
+            std::move(diagnostics),
+        };
+    }
+
+    auto LexTokens(const FileBuffer* const fileBuffer) -> Diagnosed<std::vector<Token>>
+    {
+        auto diagnostics = DiagnosticBag::Create();
+
+        TokenStream stream{ fileBuffer };
+
+        std::vector<Token> tokens{};
+        while (tokens.empty() || (tokens.back().Kind != TokenKind::EndOfFile))
+        {
+            tokens.push_back(diagnostics.Collect(stream.LexNext()));
+        }
 
         return Diagnosed{ tokens, std::move(diagnostics) };
     }
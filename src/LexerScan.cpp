@@ -0,0 +1,274 @@
+#include "LexerScan.hpp"
+
+#include <string_view>
+#include <array>
+#include <algorithm>
+#include <memory>
+#include <bit>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define ACE_LEXER_SCAN_AVX2
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define ACE_LEXER_SCAN_SSE2
+#endif
+
+namespace Ace
+{
+#if defined(ACE_LEXER_SCAN_AVX2)
+    using Block = __m256i;
+
+    constexpr size_t BlockSize = 32;
+
+    static auto LoadBlock(const char* const data) -> Block
+    {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+    }
+
+    static auto Splat(const char character) -> Block
+    {
+        return _mm256_set1_epi8(character);
+    }
+
+    static auto Or(const Block lhs, const Block rhs) -> Block
+    {
+        return _mm256_or_si256(lhs, rhs);
+    }
+
+    static auto And(const Block lhs, const Block rhs) -> Block
+    {
+        return _mm256_and_si256(lhs, rhs);
+    }
+
+    static auto IsEqual(const Block lhs, const Block rhs) -> Block
+    {
+        return _mm256_cmpeq_epi8(lhs, rhs);
+    }
+
+    static auto IsGreater(const Block lhs, const Block rhs) -> Block
+    {
+        return _mm256_cmpgt_epi8(lhs, rhs);
+    }
+
+    // One bit per character, set where `matches` is set.
+    static auto CreateMask(const Block matches) -> uint32_t
+    {
+        return static_cast<uint32_t>(_mm256_movemask_epi8(matches));
+    }
+
+    constexpr uint32_t FullMask = 0xFFFFFFFF;
+#elif defined(ACE_LEXER_SCAN_SSE2)
+    using Block = __m128i;
+
+    constexpr size_t BlockSize = 16;
+
+    static auto LoadBlock(const char* const data) -> Block
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    }
+
+    static auto Splat(const char character) -> Block
+    {
+        return _mm_set1_epi8(character);
+    }
+
+    static auto Or(const Block lhs, const Block rhs) -> Block
+    {
+        return _mm_or_si128(lhs, rhs);
+    }
+
+    static auto And(const Block lhs, const Block rhs) -> Block
+    {
+        return _mm_and_si128(lhs, rhs);
+    }
+
+    static auto IsEqual(const Block lhs, const Block rhs) -> Block
+    {
+        return _mm_cmpeq_epi8(lhs, rhs);
+    }
+
+    static auto IsGreater(const Block lhs, const Block rhs) -> Block
+    {
+        return _mm_cmpgt_epi8(lhs, rhs);
+    }
+
+    // One bit per character, set where `matches` is set.
+    static auto CreateMask(const Block matches) -> uint32_t
+    {
+        return static_cast<uint32_t>(_mm_movemask_epi8(matches));
+    }
+
+    constexpr uint32_t FullMask = 0xFFFF;
+#else
+    // Without vector instructions a block is a single character, and a comparison yields 0 or -1
+    // like a vector lane does.
+    using Block = char;
+
+    constexpr size_t BlockSize = 1;
+
+    static auto LoadBlock(const char* const data) -> Block
+    {
+        return *data;
+    }
+
+    static auto Splat(const char character) -> Block
+    {
+        return character;
+    }
+
+    static auto Or(const Block lhs, const Block rhs) -> Block
+    {
+        return static_cast<char>(lhs | rhs);
+    }
+
+    static auto And(const Block lhs, const Block rhs) -> Block
+    {
+        return static_cast<char>(lhs & rhs);
+    }
+
+    static auto IsEqual(const Block lhs, const Block rhs) -> Block
+    {
+        return (lhs == rhs) ? -1 : 0;
+    }
+
+    static auto IsGreater(const Block lhs, const Block rhs) -> Block
+    {
+        return (static_cast<signed char>(lhs) > static_cast<signed char>(rhs)) ? -1 : 0;
+    }
+
+    static auto CreateMask(const Block matches) -> uint32_t
+    {
+        return (matches != 0) ? 1 : 0;
+    }
+
+    constexpr uint32_t FullMask = 1;
+#endif
+
+    // Characters above 0x7F compare as negative, so they are never inside an ASCII range.
+    static auto IsInRange(const Block block, const char first, const char last) -> Block
+    {
+        return And(IsGreater(block, Splat(first - 1)), IsGreater(Splat(last + 1), block));
+    }
+
+    static auto IsWhitespace(const Block block) -> Block
+    {
+        return Or(IsEqual(block, Splat(' ')), IsInRange(block, '\t', '\f'));
+    }
+
+    static auto IsNumber(const Block block) -> Block
+    {
+        return IsInRange(block, '0', '9');
+    }
+
+    static auto IsIdentContinue(const Block block) -> Block
+    {
+        const auto isLetter = Or(IsInRange(block, 'a', 'z'), IsInRange(block, 'A', 'Z'));
+        return Or(Or(isLetter, IsNumber(block)), IsEqual(block, Splat('_')));
+    }
+
+    // Returns the first character that ends a run of characters matching `isMatch` when `IsRun`
+    // is true, or the first matching character when it is false. The last partial block is copied
+    // into a zero-filled block, and '\0' matches none of the classes scanned for.
+    template <bool IsRun, typename TMatch>
+    static auto Scan(
+        const std::string_view::const_iterator it,
+        const std::string_view::const_iterator endIt,
+        TMatch&& isMatch
+    ) -> std::string_view::const_iterator
+    {
+        const auto findStop = [&](const Block block) -> uint32_t
+        {
+            const auto matchMask = CreateMask(isMatch(block));
+            return IsRun ? (~matchMask & FullMask) : matchMask;
+        };
+
+        const auto* data = std::to_address(it);
+        const auto* const end = std::to_address(endIt);
+
+        while (static_cast<size_t>(end - data) >= BlockSize)
+        {
+            const auto stopMask = findStop(LoadBlock(data));
+            if (stopMask != 0)
+            {
+                return it + ((data - std::to_address(it)) + std::countr_zero(stopMask));
+            }
+
+            data += BlockSize;
+        }
+
+        if (data == end)
+        {
+            return endIt;
+        }
+
+        std::array<char, BlockSize> lastBlock{};
+        std::copy(data, end, begin(lastBlock));
+
+        const auto stopMask = findStop(LoadBlock(lastBlock.data()));
+        const auto stopIndex = std::min<ptrdiff_t>(std::countr_zero(stopMask), end - data);
+        return it + ((data - std::to_address(it)) + stopIndex);
+    }
+
+    auto ScanWhitespace(
+        std::string_view::const_iterator it,
+        const std::string_view::const_iterator endIt
+    ) -> std::string_view::const_iterator
+    {
+        return Scan<true>(it, endIt, [](const Block block) { return IsWhitespace(block); });
+    }
+
+    auto ScanIdentContinue(
+        std::string_view::const_iterator it,
+        const std::string_view::const_iterator endIt
+    ) -> std::string_view::const_iterator
+    {
+        return Scan<true>(it, endIt, [](const Block block) { return IsIdentContinue(block); });
+    }
+
+    auto ScanNumber(
+        std::string_view::const_iterator it,
+        const std::string_view::const_iterator endIt
+    ) -> std::string_view::const_iterator
+    {
+        return Scan<true>(it, endIt, [](const Block block) { return IsNumber(block); });
+    }
+
+    auto FindCharacter(
+        std::string_view::const_iterator it,
+        const std::string_view::const_iterator endIt,
+        const char character
+    ) -> std::string_view::const_iterator
+    {
+        const auto characterBlock = Splat(character);
+
+        return Scan<false>(
+            it,
+            endIt,
+            [&](const Block block) { return IsEqual(block, characterBlock); }
+        );
+    }
+
+    auto FindEitherCharacter(
+        std::string_view::const_iterator it,
+        const std::string_view::const_iterator endIt,
+        const char firstCharacter,
+        const char secondCharacter
+    ) -> std::string_view::const_iterator
+    {
+        const auto firstCharacterBlock = Splat(firstCharacter);
+        const auto secondCharacterBlock = Splat(secondCharacter);
+
+        return Scan<false>(
+            it,
+            endIt,
+            [&](const Block block)
+            {
+                const auto isFirstCharacter = IsEqual(block, firstCharacterBlock);
+                return Or(isFirstCharacter, IsEqual(block, secondCharacterBlock));
+            }
+        );
+    }
+}
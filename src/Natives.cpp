@@ -31,6 +31,10 @@ namespace Ace
 
         auto Emit(Emitter& emitter) const -> void final
         {
+            // Natives are thin wrappers around single instructions, so they are always inlined,
+            // even by the minimal `-O0` pipeline.
+            emitter.GetFunction()->addFnAttr(llvm::Attribute::AlwaysInline);
+
             m_BlockEmitter(emitter);
         }
 
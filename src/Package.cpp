@@ -9,6 +9,7 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <iterator>
+#include <optional>
 #include <nlohmann/json.hpp>
 
 #include "Diagnostic.hpp"
@@ -17,6 +18,7 @@
 #include "Diagnostics/JsonDiagnostics.hpp"
 #include "String.hpp"
 #include "Compilation.hpp"
+#include "Parallel.hpp"
 
 namespace Ace
 {
@@ -480,26 +482,6 @@ namespace Ace
         return normalizedFilePaths;
     }
 
-    static auto ReadFilePath(
-        std::vector<std::shared_ptr<const ISrcBuffer>>* const srcBuffers,
-        const FileBuffer* const fileBuffer,
-        const std::filesystem::path& filePath
-    ) -> Expected<const FileBuffer*>
-    {
-        auto diagnostics = DiagnosticBag::Create();
-
-        const auto optFileBuffer =
-            diagnostics.Collect(FileBuffer::Read(fileBuffer->GetCompilation(), filePath));
-        if (!optFileBuffer.has_value())
-        {
-            return std::move(diagnostics);
-        }
-
-        srcBuffers->push_back(optFileBuffer.value());
-
-        return Expected{ optFileBuffer.value().get(), std::move(diagnostics) };
-    }
-
     static auto CreateDefaultValue(const nlohmann::json::value_t type) -> nlohmann::json
     {
         switch (type)
@@ -705,20 +687,35 @@ namespace Ace
     {
         auto diagnostics = DiagnosticBag::Create();
 
+        auto* const compilation = fileBuffer->GetCompilation();
+
+        std::vector<std::optional<Expected<std::shared_ptr<const FileBuffer>>>> optReadResults(
+            filePaths.size()
+        );
+        ParallelFor(
+            compilation->GetJobCount(),
+            filePaths.size(),
+            [&](const size_t i)
+            {
+                optReadResults.at(i).emplace(FileBuffer::Read(compilation, filePaths.at(i)));
+            }
+        );
+
         std::vector<const FileBuffer*> fileBuffers{};
         std::for_each(
-            begin(filePaths),
-            end(filePaths),
-            [&](const std::filesystem::path& filePath)
+            begin(optReadResults),
+            end(optReadResults),
+            [&](std::optional<Expected<std::shared_ptr<const FileBuffer>>>& optReadResult)
             {
                 const auto optFileBuffer =
-                    diagnostics.Collect(ReadFilePath(srcBuffers, fileBuffer, filePath));
+                    diagnostics.Collect(std::move(optReadResult.value()));
                 if (!optFileBuffer.has_value())
                 {
                     return;
                 }
 
-                fileBuffers.push_back(optFileBuffer.value());
+                srcBuffers->push_back(optFileBuffer.value());
+                fileBuffers.push_back(optFileBuffer.value().get());
             }
         );
 
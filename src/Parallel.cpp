@@ -0,0 +1,48 @@
+#include "Parallel.hpp"
+
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <functional>
+
+namespace Ace
+{
+    auto ParallelFor(
+        const size_t jobCount, const size_t taskCount, const std::function<void(size_t)>& task
+    ) -> void
+    {
+        const auto threadCount = std::min(jobCount, taskCount);
+        if (threadCount <= 1)
+        {
+            for (size_t i = 0; i < taskCount; i++)
+            {
+                task(i);
+            }
+
+            return;
+        }
+
+        std::atomic<size_t> nextIndex = 0;
+        const auto runTasks = [&]() -> void
+        {
+            for (auto i = nextIndex++; i < taskCount; i = nextIndex++)
+            {
+                task(i);
+            }
+        };
+
+        std::vector<std::thread> threads{};
+        for (size_t i = 1; i < threadCount; i++)
+        {
+            threads.emplace_back(runTasks);
+        }
+
+        runTasks();
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+}
@@ -8,13 +8,15 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <map>
+#include <utility>
 
 #include "Diagnostic.hpp"
 #include "Diagnostics/BindingDiagnostics.hpp"
 #include "Diagnostics/ParsingDiagnostics.hpp"
 #include "Token.hpp"
-#include "Lexer.hpp"
+#include "TokenCursor.hpp"
 #include "Syntaxes/All.hpp"
+#include "SyntaxArena.hpp"
 #include "Compilation.hpp"
 #include "FileBuffer.hpp"
 #include "Scope.hpp"
@@ -24,6 +26,7 @@
 #include "AnonymousIdent.hpp"
 #include "Name.hpp"
 #include "Ident.hpp"
+#include "InternedString.hpp"
 #include "Keyword.hpp"
 
 namespace Ace
@@ -49,7 +52,7 @@ namespace Ace
     struct FunctionOrOpNameToken
     {
         FunctionOrOpNameKind Kind{};
-        Token Value{};
+        TokenView Value{};
     };
 
     enum class Modifier
@@ -62,13 +65,13 @@ namespace Ace
 
     struct NamedSymbolHeader
     {
-        std::map<Modifier, Token> ModifierToTokenMap{};
-        std::vector<std::shared_ptr<const AttributeSyntax>> Attributes{};
+        std::map<Modifier, TokenView> ModifierToTokenMap{};
+        std::vector<const AttributeSyntax*> Attributes{};
         Ident& Name;
         std::vector<Ident> NestedName{};
         std::shared_ptr<Scope> BodyScope{};
-        std::vector<std::shared_ptr<const TypeParamSyntax>> TypeParams{};
-        std::vector<std::shared_ptr<const NormalParamVarSyntax>> Params{};
+        std::vector<const TypeParamSyntax*> TypeParams{};
+        std::vector<const NormalParamVarSyntax*> Params{};
     };
 
     enum class SymbolFlags
@@ -418,36 +421,37 @@ namespace Ace
     }
 
     static auto CreateCollapsedPrefixExpr(
+        SyntaxArena* const arena,
         const SrcLocation& srcLocation,
-        const std::shared_ptr<const IExprSyntax>& expr,
+        const IExprSyntax* const expr,
         const LocatedOp& op
-    ) -> std::shared_ptr<const IExprSyntax>
+    ) -> const IExprSyntax*
     {
         switch (op.TokenKind)
         {
             case TokenKind::Exclamation:
             {
-                return std::make_shared<const LogicalNegationExprSyntax>(srcLocation, expr);
+                return arena->Create<LogicalNegationExprSyntax>(srcLocation, expr);
             }
 
             case TokenKind::LockKeyword:
             {
-                return std::make_shared<const LockExprSyntax>(srcLocation, expr);
+                return arena->Create<LockExprSyntax>(srcLocation, expr);
             }
 
             case TokenKind::BoxKeyword:
             {
-                return std::make_shared<const BoxExprSyntax>(srcLocation, expr);
+                return arena->Create<BoxExprSyntax>(srcLocation, expr);
             }
 
             case TokenKind::UnboxKeyword:
             {
-                return std::make_shared<const UnboxExprSyntax>(srcLocation, expr);
+                return arena->Create<UnboxExprSyntax>(srcLocation, expr);
             }
 
             default:
             {
-                return std::make_shared<const UserUnaryExprSyntax>(
+                return arena->Create<UserUnaryExprSyntax>(
                     srcLocation, expr, op.SrcLocation, GetUnaryOp(op.TokenKind)
                 );
             }
@@ -455,52 +459,59 @@ namespace Ace
     }
 
     static auto CreateCollapsedBinaryExpr(
+        SyntaxArena* const arena,
         const SrcLocation& srcLocation,
-        const std::shared_ptr<const IExprSyntax>& lhsExpr,
-        const std::shared_ptr<const IExprSyntax>& rhsExpr,
+        const IExprSyntax* const lhsExpr,
+        const IExprSyntax* const rhsExpr,
         const LocatedOp& op
-    ) -> std::shared_ptr<const IExprSyntax>
+    ) -> const IExprSyntax*
     {
         switch (op.TokenKind)
         {
             case TokenKind::AmpersandAmpersand:
             {
-                return std::make_shared<const AndExprSyntax>(srcLocation, lhsExpr, rhsExpr);
+                return arena->Create<AndExprSyntax>(srcLocation, lhsExpr, rhsExpr);
             }
 
             case TokenKind::VerticalBarVerticalBar:
             {
-                return std::make_shared<const OrExprSyntax>(srcLocation, lhsExpr, rhsExpr);
+                return arena->Create<OrExprSyntax>(srcLocation, lhsExpr, rhsExpr);
             }
 
             default:
             {
-                return std::make_shared<const UserBinaryExprSyntax>(
+                return arena->Create<UserBinaryExprSyntax>(
                     srcLocation, lhsExpr, rhsExpr, op.SrcLocation, GetBinaryOp(op.TokenKind)
                 );
             }
         }
     }
 
-    static auto CreateEmptyAttributes() -> std::vector<std::shared_ptr<const AttributeSyntax>>
+    static auto CreateEmptyAttributes() -> std::vector<const AttributeSyntax*>
     {
         return {};
     }
 
-    static auto CreateImplSelf(const std::shared_ptr<Scope>& scope, const SymbolName& selfTypeName)
-        -> std::shared_ptr<const ImplSelfSyntax>
+    static auto CreateImplSelf(
+        SyntaxArena* const arena,
+        const std::shared_ptr<Scope>& scope,
+        const SymbolName& selfTypeName
+    ) -> const ImplSelfSyntax*
     {
-        return std::make_shared<const ImplSelfSyntax>(scope, selfTypeName);
+        return arena->Create<ImplSelfSyntax>(scope, selfTypeName);
     }
 
-    static auto CreateSelfParamImpl(const NamedSymbolHeader& header, const bool isDyn)
-        -> Diagnosed<std::optional<std::shared_ptr<const SelfParamVarSyntax>>>
+    static auto CreateSelfParamImpl(
+        SyntaxArena* const arena,
+        const NamedSymbolHeader& header,
+        const bool isDyn
+    ) -> Diagnosed<std::optional<const SelfParamVarSyntax*>>
     {
         auto diagnostics = DiagnosticBag::Create();
 
         std::optional<SelfKind> optSelfKind{};
         bool isSelfStrongPtr = false;
-        std::vector<Token> selfTokens{};
+        std::vector<TokenView> selfTokens{};
 
         if (header.ModifierToTokenMap.contains(Modifier::StrongPtr))
         {
@@ -562,21 +573,21 @@ namespace Ace
         const TypeName typeName{ typeSymbolName, typeNameModifiers };
 
         return Diagnosed{
-            std::make_shared<const SelfParamVarSyntax>(srcLocation, header.BodyScope, typeName),
+            arena->Create<SelfParamVarSyntax>(srcLocation, header.BodyScope, typeName),
             std::move(diagnostics),
         };
     }
 
-    static auto CreateSelfParam(const NamedSymbolHeader& header)
-        -> Diagnosed<std::optional<std::shared_ptr<const SelfParamVarSyntax>>>
+    static auto CreateSelfParam(SyntaxArena* const arena, const NamedSymbolHeader& header)
+        -> Diagnosed<std::optional<const SelfParamVarSyntax*>>
     {
-        return CreateSelfParamImpl(header, false);
+        return CreateSelfParamImpl(arena, header, false);
     }
 
-    static auto CreateDynSelfParam(const NamedSymbolHeader& header)
-        -> Diagnosed<std::optional<std::shared_ptr<const SelfParamVarSyntax>>>
+    static auto CreateDynSelfParam(SyntaxArena* const arena, const NamedSymbolHeader& header)
+        -> Diagnosed<std::optional<const SelfParamVarSyntax*>>
     {
-        return CreateSelfParamImpl(header, true);
+        return CreateSelfParamImpl(arena, header, true);
     }
 
     static auto CreateName(const NamedSymbolHeader& header) -> SymbolName
@@ -586,7 +597,7 @@ namespace Ace
             begin(header.TypeParams),
             end(header.TypeParams),
             back_inserter(typeArgNames),
-            [](const std::shared_ptr<const TypeParamSyntax>& param)
+            [](const TypeParamSyntax* const param)
             {
                 return SymbolName{
                     SymbolNameSection{ param->GetName() },
@@ -604,15 +615,17 @@ namespace Ace
     }
 
     static auto CloneTypeParamInScope(
-        const std::shared_ptr<const TypeParamSyntax>& param, const std::shared_ptr<Scope>& scope
-    ) -> std::shared_ptr<const TypeParamSyntax>
+        SyntaxArena* const arena,
+        const TypeParamSyntax* const param,
+        const std::shared_ptr<Scope>& scope
+    ) -> const TypeParamSyntax*
     {
-        return std::make_shared<const TypeParamSyntax>(
+        return arena->Create<TypeParamSyntax>(
             param->GetSrcLocation(), scope, param->GetName(), param->GetIndex()
         );
     }
 
-    static auto GetLiteralKind(const Token& token) -> Expected<LiteralKind>
+    static auto GetLiteralKind(const TokenView& token) -> Expected<LiteralKind>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -696,7 +709,7 @@ namespace Ace
         }
     }
 
-    static auto GetModifier(const Token& token) -> Expected<Modifier>
+    static auto GetModifier(const TokenView& token) -> Expected<Modifier>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -745,19 +758,27 @@ namespace Ace
     class Parser
     {
     public:
-        Parser(const FileBuffer* const fileBuffer, std::vector<Token> tokens)
-            : m_FileBuffer{ fileBuffer },
-              m_Tokens{ std::move(tokens) },
-              m_Iterator{ begin(m_Tokens) },
-              m_EndIterator{ end(m_Tokens) - 1 }
+        Parser(SyntaxArena* const arena, TokenCursor tokenCursor)
+            : m_Arena{ arena },
+              m_TokenCursor{ std::move(tokenCursor) }
         {
         }
 
         ~Parser() = default;
 
+        auto GetArena() const -> SyntaxArena*
+        {
+            return m_Arena;
+        }
+
+        template <typename T, typename... TArgs> auto Create(TArgs&&... args) const -> const T*
+        {
+            return m_Arena->Create<T>(std::forward<TArgs>(args)...);
+        }
+
         auto GetFileBuffer() const -> const FileBuffer*
         {
-            return m_FileBuffer;
+            return m_TokenCursor.GetFileBuffer();
         }
 
         auto GetNestLevel() const -> size_t
@@ -765,9 +786,9 @@ namespace Ace
             return m_NestLevel;
         }
 
-        auto GetSrcLocation() const -> const SrcLocation&
+        auto GetSrcLocation() const -> SrcLocation
         {
-            return Peek().SrcLocation;
+            return m_TokenCursor.Peek().CreateSrcLocation(GetFileBuffer());
         }
 
         auto GetLastSrcLocation() const -> const SrcLocation&
@@ -777,23 +798,36 @@ namespace Ace
 
         auto IsEnd() const -> bool
         {
-            return m_Iterator == m_EndIterator;
+            return m_TokenCursor.IsEnd();
+        }
+
+        auto Peek(const size_t distance = 0) const -> TokenView
+        {
+            return CreateTokenView(m_TokenCursor.Peek(distance));
         }
 
-        auto Peek(const size_t distance = 0) const -> const Token&
+        // Kind of the token `distance` ahead for speculative scans, which stop at the end of the
+        // file. Scans may look past the cursor's buffer, whose size stays bounded.
+        auto PeekLookaheadKind(const size_t distance) const -> TokenKind
         {
-            return *(m_Iterator + distance);
+            return m_TokenCursor.PeekKind(distance);
         }
 
-        auto Eat() -> const Token&
+        auto Eat() -> TokenView
         {
+            ACE_ASSERT(!IsEnd());
+
             m_LastSrcLocation = GetSrcLocation();
 
-            m_Iterator++;
-            ACE_ASSERT(m_Iterator <= m_EndIterator);
-            UpdateNestLevel();
+            const auto token = m_TokenCursor.Eat();
+            UpdateNestLevel(token);
 
-            return *(m_Iterator - 1);
+            return CreateTokenView(token);
+        }
+
+        auto TakeLexingDiagnostics() -> DiagnosticBag
+        {
+            return m_TokenCursor.TakeDiagnostics();
         }
 
         auto DiscardUntil(const DiscardKind kind, const TokenKind tokenKind) -> void
@@ -837,19 +871,28 @@ namespace Ace
         }
 
     private:
-        auto UpdateNestLevel() -> void
+        auto CreateTokenView(const Token& token) const -> TokenView
+        {
+            return TokenView{
+                token.CreateSrcLocation(GetFileBuffer()),
+                token.Kind,
+                token.GetString(GetFileBuffer()),
+            };
+        }
+
+        auto UpdateNestLevel(const Token& eatenToken) -> void
         {
             if (IsEnd())
             {
                 return;
             }
 
-            if (*(m_Iterator - 1) == TokenKind::OpenBrace)
+            if (eatenToken == TokenKind::OpenBrace)
             {
                 m_NestLevel++;
             }
 
-            if (Peek() == TokenKind::CloseBrace)
+            if (m_TokenCursor.Peek() == TokenKind::CloseBrace)
             {
                 ssize_t signedNestLevel = static_cast<ssize_t>(m_NestLevel);
                 signedNestLevel--;
@@ -860,10 +903,8 @@ namespace Ace
             }
         }
 
-        const FileBuffer* m_FileBuffer{};
-        std::vector<Token> m_Tokens{};
-        std::vector<Token>::const_iterator m_Iterator{};
-        std::vector<Token>::const_iterator m_EndIterator{};
+        SyntaxArena* m_Arena{};
+        TokenCursor m_TokenCursor;
         size_t m_NestLevel{};
         SrcLocation m_LastSrcLocation{};
     };
@@ -961,239 +1002,263 @@ namespace Ace
         return parser.Peek() == TokenKind::OpenBrace;
     }
 
-    static auto
-    GetNamedSymbolHeaderEndIndex(const Parser& parser, const SymbolFlags flags = SymbolFlags::None)
-        -> std::optional<size_t>
+    // Declaration headers never span a statement or a body, so speculative scans over them stop at
+    // `;`, `{` and `}` as well as at the end of the file.
+    static auto IsHeaderScanEnd(const TokenKind tokenKind) -> bool
+    {
+        switch (tokenKind)
+        {
+            case TokenKind::EndOfFile:
+            case TokenKind::Semicolon:
+            case TokenKind::OpenBrace:
+            case TokenKind::CloseBrace:
+            {
+                return true;
+            }
+
+            default:
+            {
+                return false;
+            }
+        }
+    }
+
+    // Shape of the declaration that begins at the current token, found by a single scan over
+    // `modifiers :: name (:: name)* [type params]? (params)? : kind`.
+    struct DeclHead
+    {
+        bool IsNamed{};
+        size_t NestedNameSectionCount{};
+        bool HasTypeParams{};
+        bool HasParams{};
+        // Token after the header's colon.
+        TokenKind KindAfterColon{};
+    };
+
+    static auto ScanDeclHead(const Parser& parser) -> DeclHead
     {
+        const auto peek = [&](const size_t distance) -> TokenKind
+        {
+            return parser.PeekLookaheadKind(distance);
+        };
+
+        DeclHead head{};
+
         size_t i = 0;
-        while ((parser.Peek(i) != TokenKind::EndOfFile) &&
-               (parser.Peek(i) != TokenKind::ColonColon) &&
-               (parser.Peek(i) != TokenKind::OpenBracket) &&
-               (parser.Peek(i) != TokenKind::OpenParen) && (parser.Peek(i) != TokenKind::Ident))
+        while (!IsHeaderScanEnd(peek(i)) && (peek(i) != TokenKind::ColonColon) &&
+               (peek(i) != TokenKind::OpenBracket) && (peek(i) != TokenKind::OpenParen) &&
+               (peek(i) != TokenKind::Ident))
         {
             i++;
         }
 
         if (i != 0)
         {
-            if (parser.Peek(i) != TokenKind::ColonColon)
+            if (peek(i) != TokenKind::ColonColon)
             {
-                return std::nullopt;
+                return head;
             }
 
             i++;
         }
 
-        if (parser.Peek(i) != TokenKind::Ident)
+        if (peek(i) != TokenKind::Ident)
         {
-            return std::nullopt;
+            return head;
         }
 
         i++;
 
-        if (flags & SymbolFlags::NestedName)
+        while (peek(i) == TokenKind::ColonColon)
         {
-            while (parser.Peek(i) == TokenKind::ColonColon)
-            {
-                i++;
-
-                if (parser.Peek(i) != TokenKind::Ident)
-                {
-                    return std::nullopt;
-                }
+            i++;
 
-                i++;
+            if (peek(i) != TokenKind::Ident)
+            {
+                return head;
             }
+
+            i++;
+            head.NestedNameSectionCount++;
         }
 
-        if ((flags & SymbolFlags::Generic) && (parser.Peek(i) == TokenKind::OpenBracket))
+        if (peek(i) == TokenKind::OpenBracket)
         {
             i++;
 
-            while ((parser.Peek(i) != TokenKind::EndOfFile) &&
-                   (parser.Peek(i) != TokenKind::CloseBracket))
+            while (!IsHeaderScanEnd(peek(i)) && (peek(i) != TokenKind::CloseBracket))
             {
                 i++;
             }
 
-            if (parser.Peek(i) != TokenKind::CloseBracket)
+            if (peek(i) != TokenKind::CloseBracket)
             {
-                return std::nullopt;
+                return head;
             }
 
             i++;
+            head.HasTypeParams = true;
         }
 
-        if (flags & SymbolFlags::Paramized)
+        if (peek(i) == TokenKind::OpenParen)
         {
-            if (parser.Peek(i) != TokenKind::OpenParen)
-            {
-                return std::nullopt;
-            }
-
             i++;
 
-            while ((parser.Peek(i) != TokenKind::EndOfFile) &&
-                   (parser.Peek(i) != TokenKind::CloseParen))
+            while (!IsHeaderScanEnd(peek(i)) && (peek(i) != TokenKind::CloseParen))
             {
                 i++;
             }
 
-            if (parser.Peek(i) != TokenKind::CloseParen)
+            if (peek(i) != TokenKind::CloseParen)
             {
-                return std::nullopt;
+                return head;
             }
 
             i++;
+            head.HasParams = true;
         }
 
-        if (parser.Peek(i) != TokenKind::Colon)
+        if (peek(i) != TokenKind::Colon)
         {
-            return std::nullopt;
+            return head;
         }
 
         i++;
 
-        return i;
+        head.IsNamed = true;
+        head.KindAfterColon = peek(i);
+        return head;
     }
 
-    static auto IsModBegin(const Parser& parser) -> bool
+    static auto IsModHead(const DeclHead& head) -> bool
     {
-        const auto optHeaderEndIndex = GetNamedSymbolHeaderEndIndex(
-            parser, SymbolFlags::NestedName | SymbolFlags::NamedBodyScope
-        );
-        if (!optHeaderEndIndex.has_value())
-        {
-            return false;
-        }
+        return head.IsNamed && !head.HasTypeParams && !head.HasParams &&
+               (head.KindAfterColon == TokenKind::ModKeyword);
+    }
 
-        const auto i = optHeaderEndIndex.value();
+    static auto IsTraitHead(const DeclHead& head) -> bool
+    {
+        return head.IsNamed && (head.NestedNameSectionCount == 0) && !head.HasParams &&
+               (head.KindAfterColon == TokenKind::TraitKeyword);
+    }
 
-        return parser.Peek(i) == TokenKind::ModKeyword;
+    static auto IsStructHead(const DeclHead& head) -> bool
+    {
+        const bool isStructKind = (head.KindAfterColon == TokenKind::PubKeyword) ||
+                                  (head.KindAfterColon == TokenKind::StructKeyword);
+
+        return head.IsNamed && (head.NestedNameSectionCount == 0) && !head.HasParams &&
+               isStructKind;
     }
 
-    static auto IsTraitBegin(const Parser& parser) -> bool
+    static auto IsFunctionHead(const DeclHead& head) -> bool
     {
-        const auto optHeaderEndIndex = GetNamedSymbolHeaderEndIndex(parser, SymbolFlags::Generic);
-        if (!optHeaderEndIndex.has_value())
-        {
-            return false;
-        }
+        return head.IsNamed && (head.NestedNameSectionCount == 0) && head.HasParams;
+    }
 
-        const auto i = optHeaderEndIndex.value();
+    static auto IsVarHead(const DeclHead& head) -> bool
+    {
+        const bool isOtherKind = (head.KindAfterColon == TokenKind::ModKeyword) ||
+                                 (head.KindAfterColon == TokenKind::TraitKeyword) ||
+                                 (head.KindAfterColon == TokenKind::PubKeyword) ||
+                                 (head.KindAfterColon == TokenKind::StructKeyword);
 
-        return parser.Peek(i) == TokenKind::TraitKeyword;
+        return head.IsNamed && (head.NestedNameSectionCount == 0) && !head.HasTypeParams &&
+               !head.HasParams && !isOtherKind;
     }
 
-    static auto IsStructBegin(const Parser& parser) -> bool
+    // Whether the impl at the current token names a trait, i.e. has `for` before its body.
+    static auto IsTraitImplHead(const Parser& parser) -> bool
     {
-        const auto optHeaderEndIndex = GetNamedSymbolHeaderEndIndex(parser, SymbolFlags::Generic);
-        if (!optHeaderEndIndex.has_value())
+        for (size_t i = 0;; i++)
         {
-            return false;
-        }
+            switch (parser.PeekLookaheadKind(i))
+            {
+                case TokenKind::ForKeyword:
+                {
+                    return true;
+                }
 
-        const auto i = optHeaderEndIndex.value();
+                case TokenKind::EndOfFile:
+                case TokenKind::OpenBrace:
+                case TokenKind::CloseBrace:
+                case TokenKind::Semicolon:
+                {
+                    return false;
+                }
 
-        return (parser.Peek(i) == TokenKind::PubKeyword) ||
-               (parser.Peek(i) == TokenKind::StructKeyword);
+                default:
+                {
+                    break;
+                }
+            }
+        }
     }
 
-    static auto IsTypeBegin(const Parser& parser) -> bool
+    static auto IsFunctionBegin(const Parser& parser) -> bool
     {
-        return IsTraitBegin(parser) || IsStructBegin(parser);
+        return IsFunctionHead(ScanDeclHead(parser));
     }
 
-    static auto IsFunctionBegin(const Parser& parser) -> bool
+    static auto IsVarBegin(const Parser& parser) -> bool
     {
-        return GetNamedSymbolHeaderEndIndex(parser, SymbolFlags::Generic | SymbolFlags::Paramized)
-            .has_value();
+        return IsVarHead(ScanDeclHead(parser));
     }
 
-    static auto GetTokenKindSetUntil(const Parser& parser, const std::vector<TokenKind> predicates)
-        -> std::set<TokenKind>
+    enum class DeclKind
     {
-        std::set<TokenKind> tokenKindSet{};
+        None,
+        Mod,
+        Trait,
+        Struct,
+        InherentImpl,
+        TraitImpl,
+        Function,
+        Var,
+        Use,
+    };
 
-        size_t i = 0;
+    // Classifies the declaration at the current token of a mod body with one scan of its head.
+    static auto ClassifyDecl(const Parser& parser) -> DeclKind
+    {
+        const auto head = ScanDeclHead(parser);
 
-        while (std::find(begin(predicates), end(predicates), parser.Peek(i).Kind) == end(predicates)
-        )
+        if (IsModHead(head))
         {
-            tokenKindSet.insert(parser.Peek(i).Kind);
-            i++;
+            return DeclKind::Mod;
         }
 
-        return tokenKindSet;
-    }
-
-    static auto IsInherentImplBegin(const Parser& parser) -> bool
-    {
-        if (parser.Peek(0) != TokenKind::ImplKeyword)
+        if (IsTraitHead(head))
         {
-            return false;
+            return DeclKind::Trait;
         }
 
-        const auto tokenKindSet = GetTokenKindSetUntil(
-            parser,
-            {
-                TokenKind::OpenBrace,
-                TokenKind::CloseBrace,
-                TokenKind::Semicolon,
-            }
-        );
-
-        if (tokenKindSet.contains(TokenKind::ForKeyword))
+        if (IsStructHead(head))
         {
-            return false;
+            return DeclKind::Struct;
         }
 
-        return true;
-    }
-
-    static auto IsTraitImplBegin(const Parser& parser) -> bool
-    {
-        if (parser.Peek(0) != TokenKind::ImplKeyword)
+        if (parser.Peek() == TokenKind::ImplKeyword)
         {
-            return false;
+            return IsTraitImplHead(parser) ? DeclKind::TraitImpl : DeclKind::InherentImpl;
         }
 
-        const auto tokenKindSet = GetTokenKindSetUntil(
-            parser,
-            {
-                TokenKind::OpenBrace,
-                TokenKind::CloseBrace,
-                TokenKind::Semicolon,
-            }
-        );
-
-        if (!tokenKindSet.contains(TokenKind::ForKeyword))
+        if (IsFunctionHead(head))
         {
-            return false;
+            return DeclKind::Function;
         }
 
-        return true;
-    }
-
-    static auto IsVarBegin(const Parser& parser) -> bool
-    {
-        const auto optHeaderEndIndex = GetNamedSymbolHeaderEndIndex(parser);
-        if (!optHeaderEndIndex.has_value())
+        if (IsVarHead(head))
         {
-            return false;
+            return DeclKind::Var;
         }
 
-        const auto i = optHeaderEndIndex.value();
+        if (parser.Peek() == TokenKind::UseKeyword)
+        {
+            return DeclKind::Use;
+        }
 
-        return (parser.Peek(i) != TokenKind::ModKeyword) &&
-               (parser.Peek(i) != TokenKind::TraitKeyword) &&
-               (parser.Peek(i) != TokenKind::PubKeyword) &&
-               (parser.Peek(i) != TokenKind::StructKeyword);
-    }
-
-    static auto IsUseBegin(const Parser& parser) -> bool
-    {
-        return parser.Peek() == TokenKind::UseKeyword;
+        return DeclKind::None;
     }
 
     static auto IsSpecialSymbolNameSectionBegin(const Parser& parser) -> bool
@@ -1226,7 +1291,7 @@ namespace Ace
     }
 
     static auto RemoveConstrainedTypeParams(
-        std::unordered_map<std::string_view, std::shared_ptr<const TypeParamSyntax>>&
+        std::unordered_map<InternedString, const TypeParamSyntax*>&
             unconstrainedParamMap,
         const SymbolName& typeName
     ) -> void
@@ -1254,18 +1319,18 @@ namespace Ace
     }
 
     static auto CreateUnconstrainedTypeParamMap(
-        const std::vector<std::shared_ptr<const TypeParamSyntax>>& params
-    ) -> std::unordered_map<std::string_view, std::shared_ptr<const TypeParamSyntax>>
+        const std::vector<const TypeParamSyntax*>& params
+    ) -> std::unordered_map<InternedString, const TypeParamSyntax*>
     {
-        std::unordered_map<std::string_view, std::shared_ptr<const TypeParamSyntax>>
+        std::unordered_map<InternedString, const TypeParamSyntax*>
             unconstrainedParamMap{};
         std::for_each(
             begin(params),
             end(params),
-            [&](const std::shared_ptr<const TypeParamSyntax>& param)
+            [&](const TypeParamSyntax* const param)
             {
                 const auto& name = param->GetName().String;
-                if (!name.starts_with("?"))
+                if (!name.GetString().starts_with("?"))
                 {
                     unconstrainedParamMap[name] = param;
                 }
@@ -1276,7 +1341,7 @@ namespace Ace
     }
 
     static auto DiagnoseUnconstrainedTypeParams(
-        const std::unordered_map<std::string_view, std::shared_ptr<const TypeParamSyntax>>&
+        const std::unordered_map<InternedString, const TypeParamSyntax*>&
             unconstrainedParamMap
     ) -> Diagnosed<void>
     {
@@ -1297,7 +1362,7 @@ namespace Ace
     }
 
     static auto AreInherentImplTypeParamsConstrained(
-        const std::vector<std::shared_ptr<const TypeParamSyntax>>& params,
+        const std::vector<const TypeParamSyntax*>& params,
         const SymbolName& typeName
     ) -> Expected<void>
     {
@@ -1318,7 +1383,7 @@ namespace Ace
     }
 
     static auto AreTraitImplTypeParamsConstrained(
-        const std::vector<std::shared_ptr<const TypeParamSyntax>>& params,
+        const std::vector<const TypeParamSyntax*>& params,
         const SymbolName& traitName,
         const SymbolName& typeName
     ) -> Expected<void>
@@ -1341,16 +1406,16 @@ namespace Ace
     }
 
     static auto ParseExpr(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const IExprSyntax>>;
+        -> Expected<const IExprSyntax*>;
 
     static auto ParseOptionalTypeArgs(Parser& parser, const std::shared_ptr<Scope>& scope)
         -> Expected<std::vector<SymbolName>>;
 
     static auto ParseStructConstructionExpr(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const StructConstructionExprSyntax>>;
+        -> Expected<const StructConstructionExprSyntax*>;
 
     static auto ParseStmt(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const IStmtSyntax>>;
+        -> Expected<const IStmtSyntax*>;
 
     template <typename T>
     static auto ParseList(
@@ -1475,7 +1540,7 @@ namespace Ace
 
         const auto& token = parser.Eat();
 
-        std::string name{ TokenKindToKeywordMap.at(token.Kind) };
+        std::string name{ GetKeyword(token.Kind) };
 
         return Expected{
             SymbolNameSection{ Ident{ token.SrcLocation, std::move(name) } },
@@ -1671,28 +1736,28 @@ namespace Ace
     static auto ParseTypeParams(
         Parser& parser,
         const std::shared_ptr<Scope>& scope,
-        const std::vector<std::shared_ptr<const TypeParamSyntax>>& parentParams = {}
-    ) -> Expected<std::vector<std::shared_ptr<const TypeParamSyntax>>>
+        const std::vector<const TypeParamSyntax*>& parentParams = {}
+    ) -> Expected<std::vector<const TypeParamSyntax*>>
     {
         auto diagnostics = DiagnosticBag::Create();
 
-        std::vector<std::shared_ptr<const TypeParamSyntax>> params{};
-        std::unordered_map<std::string, SrcLocation> declaredNameToSrcLocation{};
+        std::vector<const TypeParamSyntax*> params{};
+        std::unordered_map<InternedString, SrcLocation> declaredNameToSrcLocation{};
 
         std::transform(
             begin(parentParams),
             end(parentParams),
             back_inserter(params),
-            [&](const std::shared_ptr<const TypeParamSyntax>& param)
+            [&](const TypeParamSyntax* const param)
             {
-                return CloneTypeParamInScope(param, scope);
+                return CloneTypeParamInScope(parser.GetArena(), param, scope);
             }
         );
 
         std::for_each(
             begin(params),
             end(params),
-            [&](const std::shared_ptr<const TypeParamSyntax>& param)
+            [&](const TypeParamSyntax* const param)
             {
                 declaredNameToSrcLocation.emplace(param->GetName().String, param->GetSrcLocation());
             }
@@ -1723,7 +1788,7 @@ namespace Ace
 
                 declaredNameToSrcLocation[finalName.String] = name.SrcLocation;
 
-                return std::make_shared<const TypeParamSyntax>(
+                return parser.Create<TypeParamSyntax>(
                     name.SrcLocation, scope, finalName, params.size()
                 );
             }
@@ -1735,19 +1800,19 @@ namespace Ace
     static auto ParseOptionalTypeParams(
         Parser& parser,
         const std::shared_ptr<Scope>& scope,
-        const std::vector<std::shared_ptr<const TypeParamSyntax>>& parentParams = {}
-    ) -> Expected<std::vector<std::shared_ptr<const TypeParamSyntax>>>
+        const std::vector<const TypeParamSyntax*>& parentParams = {}
+    ) -> Expected<std::vector<const TypeParamSyntax*>>
     {
         if (parser.Peek() != TokenKind::OpenBracket)
         {
-            std::vector<std::shared_ptr<const TypeParamSyntax>> params{};
+            std::vector<const TypeParamSyntax*> params{};
             std::transform(
                 begin(parentParams),
                 end(parentParams),
                 back_inserter(params),
-                [&](const std::shared_ptr<const TypeParamSyntax>& param)
+                [&](const TypeParamSyntax* const param)
                 {
-                    return CloneTypeParamInScope(param, scope);
+                    return CloneTypeParamInScope(parser.GetArena(), param, scope);
                 }
             );
 
@@ -1832,7 +1897,7 @@ namespace Ace
     }
 
     static auto ParseAttribute(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const AttributeSyntax>>
+        -> Expected<const AttributeSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -1862,7 +1927,7 @@ namespace Ace
         parser.Eat();
 
         return Expected{
-            std::make_shared<const AttributeSyntax>(
+            parser.Create<AttributeSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() },
                 optStructConstructionExpr.value()
             ),
@@ -1871,11 +1936,11 @@ namespace Ace
     }
 
     static auto ParseAttributes(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::vector<std::shared_ptr<const AttributeSyntax>>>
+        -> Expected<std::vector<const AttributeSyntax*>>
     {
         auto diagnostics = DiagnosticBag::Create();
 
-        std::vector<std::shared_ptr<const AttributeSyntax>> attributes{};
+        std::vector<const AttributeSyntax*> attributes{};
         while (parser.Peek() == TokenKind::OpenBracket)
         {
             const auto optAttribute = diagnostics.Collect(ParseAttribute(parser, scope));
@@ -1892,7 +1957,7 @@ namespace Ace
     }
 
     static auto ParseParam(Parser& parser, const std::shared_ptr<Scope>& scope, const size_t index)
-        -> Expected<std::shared_ptr<const NormalParamVarSyntax>>
+        -> Expected<const NormalParamVarSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -1926,7 +1991,7 @@ namespace Ace
         }
 
         return Expected{
-            std::make_shared<const NormalParamVarSyntax>(
+            parser.Create<NormalParamVarSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() },
                 scope,
                 optName.value(),
@@ -1939,7 +2004,7 @@ namespace Ace
     }
 
     static auto ParseParams(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::vector<std::shared_ptr<const NormalParamVarSyntax>>>
+        -> Expected<std::vector<const NormalParamVarSyntax*>>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -1952,7 +2017,7 @@ namespace Ace
         parser.Eat();
 
         const auto optParams =
-            diagnostics.Collect(ParseList<std::shared_ptr<const NormalParamVarSyntax>>(
+            diagnostics.Collect(ParseList<const NormalParamVarSyntax*>(
                 parser,
                 { TokenKind::CloseParen },
                 [&](const size_t index)
@@ -1981,11 +2046,11 @@ namespace Ace
 
     static auto ParseModifiers(
         Parser& parser, const std::shared_ptr<Scope>& scope, std::vector<Modifier> allowedModifiers
-    ) -> Diagnosed<std::map<Modifier, Token>>
+    ) -> Diagnosed<std::map<Modifier, TokenView>>
     {
         auto diagnostics = DiagnosticBag::Create();
 
-        std::map<Modifier, Token> modifierToTokenMap{};
+        std::map<Modifier, TokenView> modifierToTokenMap{};
         while (!parser.IsEnd() && (parser.Peek() != TokenKind::ColonColon) &&
                (parser.Peek() != TokenKind::OpenBracket) &&
                (parser.Peek() != TokenKind::OpenParen) && (parser.Peek() != TokenKind::Ident))
@@ -2034,7 +2099,7 @@ namespace Ace
         const std::shared_ptr<Scope>& scope,
         std::vector<Modifier> allowedModifiers,
         const SymbolFlags flags,
-        const std::vector<std::shared_ptr<const TypeParamSyntax>>& parentTypeParams = {}
+        const std::vector<const TypeParamSyntax*>& parentTypeParams = {}
     ) -> Expected<NamedSymbolHeader>
     {
         auto diagnostics = DiagnosticBag::Create();
@@ -2095,7 +2160,7 @@ namespace Ace
                             : scope->GetOrCreateChild(AnonymousIdent::Create(name->String));
         }
 
-        std::vector<std::shared_ptr<const TypeParamSyntax>> typeParams{};
+        std::vector<const TypeParamSyntax*> typeParams{};
         if (flags & SymbolFlags::Generic)
         {
             const auto optTypeParams =
@@ -2108,7 +2173,7 @@ namespace Ace
             typeParams = std::move(optTypeParams.value());
         }
 
-        std::vector<std::shared_ptr<const NormalParamVarSyntax>> params{};
+        std::vector<const NormalParamVarSyntax*> params{};
         if (flags & SymbolFlags::Paramized)
         {
             const auto optParams = diagnostics.Collect(ParseParams(parser, bodyScope));
@@ -2196,7 +2261,7 @@ namespace Ace
     }
 
     static auto ParseConstraint(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const ConstraintSyntax>>
+        -> Expected<const ConstraintSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -2223,7 +2288,7 @@ namespace Ace
         }
 
         return Expected{
-            std::make_shared<const ConstraintSyntax>(
+            parser.Create<ConstraintSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() },
                 scope,
                 optTypeName.value(),
@@ -2234,14 +2299,14 @@ namespace Ace
     }
 
     static auto ParseConstraints(Parser& parser, const NamedSymbolHeader& header)
-        -> Expected<std::vector<std::shared_ptr<const ConstraintSyntax>>>
+        -> Expected<std::vector<const ConstraintSyntax*>>
     {
         auto diagnostics = DiagnosticBag::Create();
 
         if (parser.Peek() != TokenKind::WhereKeyword)
         {
             return Expected{
-                std::vector<std::shared_ptr<const ConstraintSyntax>>{},
+                std::vector<const ConstraintSyntax*>{},
                 std::move(diagnostics),
             };
         }
@@ -2249,7 +2314,7 @@ namespace Ace
         const auto whereToken = parser.Eat();
 
         const auto optConstraints =
-            diagnostics.Collect(ParseList<std::shared_ptr<const ConstraintSyntax>>(
+            diagnostics.Collect(ParseList<const ConstraintSyntax*>(
                 parser,
                 { TokenKind::Semicolon, TokenKind::OpenBrace },
                 [&](const size_t index)
@@ -2276,7 +2341,7 @@ namespace Ace
                 optConstraints.value().back()->GetSrcLocation(),
             }));
             return Expected{
-                std::vector<std::shared_ptr<const ConstraintSyntax>>{},
+                std::vector<const ConstraintSyntax*>{},
                 std::move(diagnostics),
             };
         }
@@ -2285,7 +2350,7 @@ namespace Ace
     }
 
     static auto ParseArgs(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::vector<std::shared_ptr<const IExprSyntax>>>
+        -> Expected<std::vector<const IExprSyntax*>>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -2297,7 +2362,7 @@ namespace Ace
 
         parser.Eat();
 
-        const auto optArgs = diagnostics.Collect(ParseList<std::shared_ptr<const IExprSyntax>>(
+        const auto optArgs = diagnostics.Collect(ParseList<const IExprSyntax*>(
             parser,
             { TokenKind::CloseParen },
             [&](const size_t index)
@@ -2325,7 +2390,7 @@ namespace Ace
     }
 
     static auto ParseLiteralExpr(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const LiteralExprSyntax>>
+        -> Expected<const LiteralExprSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -2338,15 +2403,18 @@ namespace Ace
         }
 
         return Expected{
-            std::make_shared<const LiteralExprSyntax>(
-                literalToken.SrcLocation, scope, optLiteralKind.value(), literalToken.String
+            parser.Create<LiteralExprSyntax>(
+                literalToken.SrcLocation,
+                scope,
+                optLiteralKind.value(),
+                std::string{ literalToken.String }
             ),
             std::move(diagnostics),
         };
     }
 
     static auto ParseSelfSymbolLiteralExpr(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const SymbolLiteralExprSyntax>>
+        -> Expected<const SymbolLiteralExprSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -2364,13 +2432,13 @@ namespace Ace
         };
 
         return Expected{
-            std::make_shared<const SymbolLiteralExprSyntax>(token.SrcLocation, scope, name),
+            parser.Create<SymbolLiteralExprSyntax>(token.SrcLocation, scope, name),
             std::move(diagnostics),
         };
     }
 
     static auto ParseSymbolLiteralExpr(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const SymbolLiteralExprSyntax>>
+        -> Expected<const SymbolLiteralExprSyntax*>
     {
         if (parser.Peek() == TokenKind::LowerSelfKeyword)
         {
@@ -2388,7 +2456,7 @@ namespace Ace
         }
 
         return Expected{
-            std::make_shared<const SymbolLiteralExprSyntax>(
+            parser.Create<SymbolLiteralExprSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() }, scope, optName.value()
             ),
             std::move(diagnostics),
@@ -2423,7 +2491,7 @@ namespace Ace
                     return std::move(diagnostics);
                 }
 
-                std::optional<std::shared_ptr<const IExprSyntax>> optValue{};
+                std::optional<const IExprSyntax*> optValue{};
                 if (parser.Peek() == TokenKind::Colon)
                 {
                     parser.Eat();
@@ -2461,7 +2529,7 @@ namespace Ace
     }
 
     static auto ParseStructConstructionExpr(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const StructConstructionExprSyntax>>
+        -> Expected<const StructConstructionExprSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -2488,7 +2556,7 @@ namespace Ace
         }
 
         return Expected{
-            std::make_shared<const StructConstructionExprSyntax>(
+            parser.Create<StructConstructionExprSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() },
                 scope,
                 optTypeName.value(),
@@ -2499,7 +2567,7 @@ namespace Ace
     }
 
     static auto ParseCastExpr(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const CastExprSyntax>>
+        -> Expected<const CastExprSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -2559,7 +2627,7 @@ namespace Ace
         parser.Eat();
 
         return Expected{
-            std::make_shared<const CastExprSyntax>(
+            parser.Create<CastExprSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() },
                 optTypeName.value(),
                 optExpr.value()
@@ -2569,7 +2637,7 @@ namespace Ace
     }
 
     static auto ParseAddressOfExpr(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const AddressOfExprSyntax>>
+        -> Expected<const AddressOfExprSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -2606,7 +2674,7 @@ namespace Ace
         parser.Eat();
 
         return Expected{
-            std::make_shared<const AddressOfExprSyntax>(
+            parser.Create<AddressOfExprSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() }, optExpr.value()
             ),
             std::move(diagnostics),
@@ -2614,7 +2682,7 @@ namespace Ace
     }
 
     static auto ParseSizeOfExpr(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const SizeOfExprSyntax>>
+        -> Expected<const SizeOfExprSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -2652,7 +2720,7 @@ namespace Ace
         parser.Eat();
 
         return Expected{
-            std::make_shared<const SizeOfExprSyntax>(
+            parser.Create<SizeOfExprSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() },
                 scope,
                 optTypeName.value()
@@ -2662,7 +2730,7 @@ namespace Ace
     }
 
     static auto ParseDerefAsExpr(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const DerefAsExprSyntax>>
+        -> Expected<const DerefAsExprSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -2722,7 +2790,7 @@ namespace Ace
         parser.Eat();
 
         return Expected{
-            std::make_shared<const DerefAsExprSyntax>(
+            parser.Create<DerefAsExprSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() },
                 optTypeName.value(),
                 optExpr.value()
@@ -2732,7 +2800,7 @@ namespace Ace
     }
 
     static auto ParseTypeInfoPtrExpr(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const TypeInfoPtrExprSyntax>>
+        -> Expected<const TypeInfoPtrExprSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -2771,7 +2839,7 @@ namespace Ace
         parser.Eat();
 
         return Expected{
-            std::make_shared<const TypeInfoPtrExprSyntax>(
+            parser.Create<TypeInfoPtrExprSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() },
                 scope,
                 optTypeName.value()
@@ -2781,7 +2849,7 @@ namespace Ace
     }
 
     static auto ParseVtblPtrExpr(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const VtblPtrExprSyntax>>
+        -> Expected<const VtblPtrExprSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -2834,7 +2902,7 @@ namespace Ace
         parser.Eat();
 
         return Expected{
-            std::make_shared<const VtblPtrExprSyntax>(
+            parser.Create<VtblPtrExprSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() },
                 scope,
                 optTypeName.value(),
@@ -2845,7 +2913,7 @@ namespace Ace
     }
 
     static auto ParseCopyStmt(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const CopyStmtSyntax>>
+        -> Expected<const CopyStmtSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -2930,7 +2998,7 @@ namespace Ace
         }
 
         return Expected{
-            std::make_shared<const CopyStmtSyntax>(
+            parser.Create<CopyStmtSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() },
                 optTypeName.value(),
                 optSrcExpr.value(),
@@ -2941,7 +3009,7 @@ namespace Ace
     }
 
     static auto ParseDropStmt(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const DropStmtSyntax>>
+        -> Expected<const DropStmtSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -3012,7 +3080,7 @@ namespace Ace
         }
 
         return Expected{
-            std::make_shared<const DropStmtSyntax>(
+            parser.Create<DropStmtSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() },
                 optTypeName.value(),
                 optExpr.value()
@@ -3022,7 +3090,7 @@ namespace Ace
     }
 
     static auto ParseExprExpr(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const ExprExprSyntax>>
+        -> Expected<const ExprExprSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -3051,7 +3119,7 @@ namespace Ace
         parser.Eat();
 
         return Expected{
-            std::make_shared<const ExprExprSyntax>(
+            parser.Create<ExprExprSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() }, optExpr.value()
             ),
             std::move(diagnostics),
@@ -3059,7 +3127,7 @@ namespace Ace
     }
 
     static auto ParseKeywordExpr(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const IExprSyntax>>
+        -> Expected<const IExprSyntax*>
     {
         switch (parser.Peek().Kind)
         {
@@ -3103,7 +3171,7 @@ namespace Ace
     }
 
     static auto ParsePrimaryExpr(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const IExprSyntax>>
+        -> Expected<const IExprSyntax*>
     {
         if (IsKeywordExprBegin(parser))
         {
@@ -3136,7 +3204,7 @@ namespace Ace
     }
 
     static auto ParseSecondaryExpr(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const IExprSyntax>>
+        -> Expected<const IExprSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -3162,7 +3230,7 @@ namespace Ace
                     return std::move(diagnostics);
                 }
 
-                expr = std::make_shared<const MemberAccessExprSyntax>(
+                expr = parser.Create<MemberAccessExprSyntax>(
                     SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() },
                     expr,
                     optName.value()
@@ -3177,7 +3245,7 @@ namespace Ace
                     return std::move(diagnostics);
                 }
 
-                expr = std::make_shared<const CallExprSyntax>(
+                expr = parser.Create<CallExprSyntax>(
                     SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() },
                     expr,
                     optArgs.value()
@@ -3192,7 +3260,7 @@ namespace Ace
     }
 
     static auto ParseUnaryExpr(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const IExprSyntax>>
+        -> Expected<const IExprSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -3218,7 +3286,7 @@ namespace Ace
                 op.SrcLocation,
                 parser.GetLastSrcLocation(),
             };
-            expr = CreateCollapsedPrefixExpr(srcLocation, expr, op);
+            expr = CreateCollapsedPrefixExpr(parser.GetArena(), srcLocation, expr, op);
 
             ops.pop_back();
         }
@@ -3230,7 +3298,7 @@ namespace Ace
     }
 
     static auto ParseExpr(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const IExprSyntax>>
+        -> Expected<const IExprSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -3240,7 +3308,7 @@ namespace Ace
             return std::move(diagnostics);
         }
 
-        std::vector<std::shared_ptr<const IExprSyntax>> exprs{};
+        std::vector<const IExprSyntax*> exprs{};
         std::vector<LocatedOp> ops{};
 
         exprs.push_back(optUnaryExpr.value());
@@ -3296,7 +3364,9 @@ namespace Ace
                             lhsExpr->GetSrcLocation(),
                             rhsExpr->GetSrcLocation(),
                         };
-                        exprs.at(i) = CreateCollapsedBinaryExpr(srcLocation, lhsExpr, rhsExpr, op);
+                        exprs.at(i) = CreateCollapsedBinaryExpr(
+                            parser.GetArena(), srcLocation, lhsExpr, rhsExpr, op
+                        );
 
                         break;
                     }
@@ -3314,7 +3384,7 @@ namespace Ace
     }
 
     static auto ParseBlockStmt(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const BlockStmtSyntax>>
+        -> Expected<const BlockStmtSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -3329,7 +3399,7 @@ namespace Ace
 
         parser.Eat();
 
-        std::vector<std::shared_ptr<const IStmtSyntax>> stmts{};
+        std::vector<const IStmtSyntax*> stmts{};
         while (!parser.IsEnd() && (parser.Peek() != TokenKind::CloseBrace))
         {
             const auto optStmt = diagnostics.Collect(ParseStmt(parser, bodyScope));
@@ -3361,7 +3431,7 @@ namespace Ace
         }
 
         return Expected{
-            std::make_shared<const BlockStmtSyntax>(
+            parser.Create<BlockStmtSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() }, bodyScope, stmts
             ),
             std::move(diagnostics),
@@ -3369,7 +3439,7 @@ namespace Ace
     }
 
     static auto ParseExprStmt(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const ExprStmtSyntax>>
+        -> Expected<const ExprStmtSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -3390,7 +3460,7 @@ namespace Ace
         parser.Eat();
 
         return Expected{
-            std::make_shared<const ExprStmtSyntax>(
+            parser.Create<ExprStmtSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() }, optExpr.value()
             ),
             std::move(diagnostics),
@@ -3398,7 +3468,7 @@ namespace Ace
     }
 
     static auto ParseAssignmentStmt(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const SimpleAssignmentStmtSyntax>>
+        -> Expected<const SimpleAssignmentStmtSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -3433,7 +3503,7 @@ namespace Ace
         parser.Eat();
 
         return Expected{
-            std::make_shared<const SimpleAssignmentStmtSyntax>(
+            parser.Create<SimpleAssignmentStmtSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() },
                 scope,
                 optLHSExpr.value(),
@@ -3444,7 +3514,7 @@ namespace Ace
     }
 
     static auto ParseCompoundAssignmentStmt(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const CompoundAssignmentStmtSyntax>>
+        -> Expected<const CompoundAssignmentStmtSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -3479,7 +3549,7 @@ namespace Ace
         parser.Eat();
 
         return Expected{
-            std::make_shared<const CompoundAssignmentStmtSyntax>(
+            parser.Create<CompoundAssignmentStmtSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() },
                 optLhsExpr.value(),
                 optRhsExpr.value(),
@@ -3491,7 +3561,7 @@ namespace Ace
     }
 
     static auto ParseVarStmt(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const VarStmtSyntax>>
+        -> Expected<const VarStmtSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -3509,7 +3579,7 @@ namespace Ace
             return std::move(diagnostics);
         }
 
-        std::optional<std::shared_ptr<const IExprSyntax>> optAssignedExpr{};
+        std::optional<const IExprSyntax*> optAssignedExpr{};
         if (parser.Peek() == TokenKind::Equals)
         {
             parser.Eat();
@@ -3530,7 +3600,7 @@ namespace Ace
         parser.Eat();
 
         return Expected{
-            std::make_shared<const VarStmtSyntax>(
+            parser.Create<VarStmtSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() },
                 scope,
                 header.Name,
@@ -3543,7 +3613,7 @@ namespace Ace
     }
 
     static auto ParseIfBlock(Parser& parser, const std::shared_ptr<Scope>& scope) -> Expected<
-        std::pair<std::shared_ptr<const IExprSyntax>, std::shared_ptr<const BlockStmtSyntax>>>
+        std::pair<const IExprSyntax*, const BlockStmtSyntax*>>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -3574,7 +3644,7 @@ namespace Ace
     }
 
     static auto ParseElifBlock(Parser& parser, const std::shared_ptr<Scope>& scope) -> Expected<
-        std::pair<std::shared_ptr<const IExprSyntax>, std::shared_ptr<const BlockStmtSyntax>>>
+        std::pair<const IExprSyntax*, const BlockStmtSyntax*>>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -3605,7 +3675,7 @@ namespace Ace
     }
 
     static auto ParseElseBlock(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const BlockStmtSyntax>>
+        -> Expected<const BlockStmtSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -3627,14 +3697,14 @@ namespace Ace
     }
 
     static auto ParseIfStmt(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const IfStmtSyntax>>
+        -> Expected<const IfStmtSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
         const auto beginSrcLocation = parser.GetSrcLocation();
 
-        std::vector<std::shared_ptr<const IExprSyntax>> conditions{};
-        std::vector<std::shared_ptr<const BlockStmtSyntax>> bodies{};
+        std::vector<const IExprSyntax*> conditions{};
+        std::vector<const BlockStmtSyntax*> bodies{};
 
         const auto optIfBlock = diagnostics.Collect(ParseIfBlock(parser, scope));
         if (!optIfBlock.has_value())
@@ -3669,7 +3739,7 @@ namespace Ace
         }
 
         return Expected{
-            std::make_shared<const IfStmtSyntax>(
+            parser.Create<IfStmtSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() },
                 scope,
                 conditions,
@@ -3680,7 +3750,7 @@ namespace Ace
     }
 
     static auto ParseWhileStmt(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const WhileStmtSyntax>>
+        -> Expected<const WhileStmtSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -3707,7 +3777,7 @@ namespace Ace
         }
 
         return Expected{
-            std::make_shared<const WhileStmtSyntax>(
+            parser.Create<WhileStmtSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() },
                 scope,
                 optCondition.value(),
@@ -3718,7 +3788,7 @@ namespace Ace
     }
 
     static auto ParseRetStmt(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const RetStmtSyntax>>
+        -> Expected<const RetStmtSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -3732,7 +3802,7 @@ namespace Ace
 
         parser.Eat();
 
-        std::optional<std::shared_ptr<const IExprSyntax>> optExpr{};
+        std::optional<const IExprSyntax*> optExpr{};
         if (parser.Peek() != TokenKind::Semicolon)
         {
             optExpr = diagnostics.Collect(ParseExpr(parser, scope));
@@ -3754,7 +3824,7 @@ namespace Ace
         }
 
         return Expected{
-            std::make_shared<const RetStmtSyntax>(
+            parser.Create<RetStmtSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() }, scope, optExpr
             ),
             std::move(diagnostics),
@@ -3762,7 +3832,7 @@ namespace Ace
     }
 
     static auto ParseExitStmt(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const ExitStmtSyntax>>
+        -> Expected<const ExitStmtSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -3786,7 +3856,7 @@ namespace Ace
         }
 
         return Expected{
-            std::make_shared<const ExitStmtSyntax>(
+            parser.Create<ExitStmtSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() }, scope
             ),
             std::move(diagnostics),
@@ -3794,7 +3864,7 @@ namespace Ace
     }
 
     static auto ParseAssertStmt(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const AssertStmtSyntax>>
+        -> Expected<const AssertStmtSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -3826,7 +3896,7 @@ namespace Ace
         }
 
         return Expected{
-            std::make_shared<const AssertStmtSyntax>(
+            parser.Create<AssertStmtSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() },
                 scope,
                 optCondition.value()
@@ -3836,7 +3906,7 @@ namespace Ace
     }
 
     static auto ParseKeywordStmt(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const IStmtSyntax>>
+        -> Expected<const IStmtSyntax*>
     {
         switch (parser.Peek().Kind)
         {
@@ -3885,7 +3955,7 @@ namespace Ace
     }
 
     static auto ParseStmt(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const IStmtSyntax>>
+        -> Expected<const IStmtSyntax*>
     {
         if (IsVarBegin(parser))
         {
@@ -3928,7 +3998,7 @@ namespace Ace
             }
 
             return Expected{
-                std::make_shared<const ExprStmtSyntax>(
+                parser.Create<ExprStmtSyntax>(
                     SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() }, optExpr.value()
                 ),
                 std::move(diagnostics),
@@ -3957,7 +4027,7 @@ namespace Ace
         if (isAssignment)
         {
             return Expected{
-                std::make_shared<const SimpleAssignmentStmtSyntax>(
+                parser.Create<SimpleAssignmentStmtSyntax>(
                     SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() },
                     scope,
                     optExpr.value(),
@@ -3970,7 +4040,7 @@ namespace Ace
         if (isCompoundAssignment)
         {
             return Expected{
-                std::make_shared<const CompoundAssignmentStmtSyntax>(
+                parser.Create<CompoundAssignmentStmtSyntax>(
                     SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() },
                     optExpr.value(),
                     optRhsExpr.value(),
@@ -3988,8 +4058,8 @@ namespace Ace
         Parser& parser,
         const std::shared_ptr<Scope>& scope,
         const SymbolName& selfTypeName,
-        const std::vector<std::shared_ptr<const TypeParamSyntax>>& parentTypeParams
-    ) -> Expected<std::shared_ptr<const FunctionSyntax>>
+        const std::vector<const TypeParamSyntax*>& parentTypeParams
+    ) -> Expected<const FunctionSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -4034,17 +4104,17 @@ namespace Ace
             return std::move(diagnostics);
         }
 
-        const auto optSelfParam = diagnostics.Collect(CreateSelfParam(header));
+        const auto optSelfParam = diagnostics.Collect(CreateSelfParam(parser.GetArena(), header));
 
         return Expected{
-            std::make_shared<const FunctionSyntax>(
+            parser.Create<FunctionSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetSrcLocation() },
                 header.BodyScope,
                 accessModifier,
                 header.Name,
                 optTypeName.value(),
                 header.Attributes,
-                CreateImplSelf(header.BodyScope, selfTypeName),
+                CreateImplSelf(parser.GetArena(), header.BodyScope, selfTypeName),
                 optSelfParam,
                 header.Params,
                 optBlock,
@@ -4056,7 +4126,7 @@ namespace Ace
     }
 
     static auto ParseInherentImpl(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const InherentImplSyntax>>
+        -> Expected<const InherentImplSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -4099,7 +4169,7 @@ namespace Ace
 
         parser.Eat();
 
-        std::vector<std::shared_ptr<const FunctionSyntax>> functions{};
+        std::vector<const FunctionSyntax*> functions{};
         while (!parser.IsEnd() && (parser.Peek() != TokenKind::CloseBrace))
         {
             if (IsFunctionBegin(parser))
@@ -4135,12 +4205,12 @@ namespace Ace
         }
 
         return Expected{
-            std::make_shared<const InherentImplSyntax>(
+            parser.Create<InherentImplSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() },
                 bodyScope,
                 optTypeParams.value(),
                 optTypeName.value(),
-                std::vector<std::shared_ptr<const ConstraintSyntax>>{},
+                std::vector<const ConstraintSyntax*>{},
                 functions
             ),
             std::move(diagnostics),
@@ -4151,8 +4221,8 @@ namespace Ace
         Parser& parser,
         const std::shared_ptr<Scope>& scope,
         const SymbolName& selfTypeName,
-        const std::vector<std::shared_ptr<const TypeParamSyntax>>& parentTypeParams
-    ) -> Expected<std::shared_ptr<const FunctionSyntax>>
+        const std::vector<const TypeParamSyntax*>& parentTypeParams
+    ) -> Expected<const FunctionSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -4191,17 +4261,17 @@ namespace Ace
             return std::move(diagnostics);
         }
 
-        const auto optSelfParam = diagnostics.Collect(CreateSelfParam(header));
+        const auto optSelfParam = diagnostics.Collect(CreateSelfParam(parser.GetArena(), header));
 
         return Expected{
-            std::make_shared<const FunctionSyntax>(
+            parser.Create<FunctionSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetSrcLocation() },
                 header.BodyScope,
                 AccessModifier::Pub,
                 header.Name,
                 optTypeName.value(),
                 header.Attributes,
-                CreateImplSelf(header.BodyScope, selfTypeName),
+                CreateImplSelf(parser.GetArena(), header.BodyScope, selfTypeName),
                 optSelfParam,
                 header.Params,
                 optBlock,
@@ -4213,7 +4283,7 @@ namespace Ace
     }
 
     static auto ParseTraitImpl(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const TraitImplSyntax>>
+        -> Expected<const TraitImplSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -4270,7 +4340,7 @@ namespace Ace
 
         parser.Eat();
 
-        std::vector<std::shared_ptr<const FunctionSyntax>> functions{};
+        std::vector<const FunctionSyntax*> functions{};
         while (!parser.IsEnd() && (parser.Peek() != TokenKind::CloseBrace))
         {
             if (IsFunctionBegin(parser))
@@ -4306,14 +4376,14 @@ namespace Ace
         }
 
         return Expected{
-            std::make_shared<const TraitImplSyntax>(
+            parser.Create<TraitImplSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() },
                 bodyScope,
                 optTypeParams.value(),
                 optTraitName.value(),
                 optTypeName.value(),
-                std::vector<std::shared_ptr<const ConstraintSyntax>>{},
-                CreateImplSelf(bodyScope, optTypeName.value()),
+                std::vector<const ConstraintSyntax*>{},
+                CreateImplSelf(parser.GetArena(), bodyScope, optTypeName.value()),
                 functions
             ),
             std::move(diagnostics),
@@ -4321,7 +4391,7 @@ namespace Ace
     }
 
     static auto ParseFunction(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const FunctionSyntax>>
+        -> Expected<const FunctionSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -4361,7 +4431,7 @@ namespace Ace
             return std::move(diagnostics);
         }
 
-        std::optional<std::shared_ptr<const BlockStmtSyntax>> optBlock{};
+        std::optional<const BlockStmtSyntax*> optBlock{};
         if (isExtern)
         {
             if (parser.Peek() != TokenKind::Semicolon)
@@ -4382,7 +4452,7 @@ namespace Ace
         }
 
         return Expected{
-            std::make_shared<const FunctionSyntax>(
+            parser.Create<FunctionSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() },
                 header.BodyScope,
                 accessModifier,
@@ -4401,7 +4471,7 @@ namespace Ace
     }
 
     static auto ParseGlobalVar(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const GlobalVarSyntax>>
+        -> Expected<const GlobalVarSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -4439,7 +4509,7 @@ namespace Ace
         parser.Eat();
 
         return Expected{
-            std::make_shared<const GlobalVarSyntax>(
+            parser.Create<GlobalVarSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() },
                 scope,
                 header.Name,
@@ -4455,9 +4525,9 @@ namespace Ace
         Parser& parser,
         const std::shared_ptr<Scope>& scope,
         const SymbolName& parentTraitName,
-        const std::vector<std::shared_ptr<const TypeParamSyntax>>& parentTypeParams,
+        const std::vector<const TypeParamSyntax*>& parentTypeParams,
         const size_t index
-    ) -> Expected<std::shared_ptr<const PrototypeSyntax>>
+    ) -> Expected<const PrototypeSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -4501,10 +4571,10 @@ namespace Ace
             );
         }
 
-        const auto optSelfParam = diagnostics.Collect(CreateSelfParam(header));
+        const auto optSelfParam = diagnostics.Collect(CreateSelfParam(parser.GetArena(), header));
 
         return Expected{
-            std::make_shared<const PrototypeSyntax>(
+            parser.Create<PrototypeSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() },
                 header.BodyScope,
                 parentTraitName,
@@ -4522,7 +4592,7 @@ namespace Ace
     }
 
     static auto ParseTrait(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const TraitSyntax>>
+        -> Expected<const TraitSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -4568,16 +4638,14 @@ namespace Ace
             supertraitNames = std::move(optSupertraitNames.value());
         }
 
-        std::vector<std::shared_ptr<const SupertraitSyntax>> supertraits{};
+        std::vector<const SupertraitSyntax*> supertraits{};
         std::transform(
             begin(supertraitNames),
             end(supertraitNames),
             back_inserter(supertraits),
             [&](const SymbolName& name)
             {
-                return std::make_shared<const SupertraitSyntax>(
-                    name, header.Name, header.BodyScope
-                );
+                return parser.Create<SupertraitSyntax>(name, header.Name, header.BodyScope);
             }
         );
 
@@ -4589,7 +4657,7 @@ namespace Ace
 
         parser.Eat();
 
-        std::vector<std::shared_ptr<const PrototypeSyntax>> prototypes{};
+        std::vector<const PrototypeSyntax*> prototypes{};
         while (!parser.IsEnd() && (parser.Peek() != TokenKind::CloseBrace))
         {
             if (IsFunctionBegin(parser))
@@ -4625,23 +4693,23 @@ namespace Ace
         }
 
         const auto self =
-            std::make_shared<const TraitSelfSyntax>(header.Name.SrcLocation, prototypeScope);
+            parser.Create<TraitSelfSyntax>(header.Name.SrcLocation, prototypeScope);
 
-        std::vector<std::shared_ptr<const TypeReimportSyntax>> typeParamReimports{};
+        std::vector<const TypeReimportSyntax*> typeParamReimports{};
         std::transform(
             begin(header.TypeParams),
             end(header.TypeParams),
             back_inserter(typeParamReimports),
-            [&](const std::shared_ptr<const TypeParamSyntax>& typeParam)
+            [&](const TypeParamSyntax* const typeParam)
             {
-                return std::make_shared<const TypeReimportSyntax>(
+                return parser.Create<TypeReimportSyntax>(
                     prototypeScope, header.BodyScope, typeParam->GetName()
                 );
             }
         );
 
         return Expected{
-            std::make_shared<const TraitSyntax>(
+            parser.Create<TraitSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() },
                 header.BodyScope,
                 prototypeScope,
@@ -4664,7 +4732,7 @@ namespace Ace
         const SymbolName& parentStructName,
         const AccessModifier accessModifier,
         const size_t index
-    ) -> Expected<std::shared_ptr<const FieldVarSyntax>>
+    ) -> Expected<const FieldVarSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -4687,7 +4755,7 @@ namespace Ace
         }
 
         return Expected{
-            std::make_shared<const FieldVarSyntax>(
+            parser.Create<FieldVarSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() },
                 scope,
                 accessModifier,
@@ -4706,7 +4774,7 @@ namespace Ace
         const std::shared_ptr<Scope>& scope,
         const SymbolName& name,
         const AccessModifier memberAccessModifier
-    ) -> Expected<std::vector<std::shared_ptr<const FieldVarSyntax>>>
+    ) -> Expected<std::vector<const FieldVarSyntax*>>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -4718,7 +4786,7 @@ namespace Ace
 
         parser.Eat();
 
-        const auto optFields = diagnostics.Collect(ParseList<std::shared_ptr<const FieldVarSyntax>>(
+        const auto optFields = diagnostics.Collect(ParseList<const FieldVarSyntax*>(
             parser,
             { TokenKind::CloseBrace },
             [&](const size_t index)
@@ -4746,7 +4814,7 @@ namespace Ace
     }
 
     static auto ParseStruct(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const StructSyntax>>
+        -> Expected<const StructSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -4792,7 +4860,7 @@ namespace Ace
         }
 
         return Expected{
-            std::make_shared<const StructSyntax>(
+            parser.Create<StructSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() },
                 header.BodyScope,
                 accessModifier,
@@ -4805,38 +4873,8 @@ namespace Ace
         };
     }
 
-    static auto ParseType(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const ISyntax>>
-    {
-        auto diagnostics = DiagnosticBag::Create();
-
-        if (IsTraitBegin(parser))
-        {
-            const auto optTrait = diagnostics.Collect(ParseTrait(parser, scope));
-            if (!optTrait.has_value())
-            {
-                return std::move(diagnostics);
-            }
-
-            return Expected{ optTrait.value(), std::move(diagnostics) };
-        }
-        else if (IsStructBegin(parser))
-        {
-            const auto optStruct = diagnostics.Collect(ParseStruct(parser, scope));
-            if (!optStruct.has_value())
-            {
-                return std::move(diagnostics);
-            }
-
-            return Expected{ optStruct.value(), std::move(diagnostics) };
-        }
-
-        diagnostics.Add(CreateUnexpectedTokenError(parser.Peek()));
-        return std::move(diagnostics);
-    }
-
     static auto ParseUse(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const UseSyntax>>
+        -> Expected<const UseSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -4873,7 +4911,7 @@ namespace Ace
         }
 
         return Expected{
-            std::make_shared<const UseSyntax>(
+            parser.Create<UseSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() }, scope, rootTraitName
             ),
             std::move(diagnostics),
@@ -4881,7 +4919,7 @@ namespace Ace
     }
 
     static auto ParseMod(Parser& parser, const std::shared_ptr<Scope>& scope)
-        -> Expected<std::shared_ptr<const ModSyntax>>
+        -> Expected<const ModSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -4919,85 +4957,123 @@ namespace Ace
 
         parser.Eat();
 
-        std::vector<std::shared_ptr<const ModSyntax>> mods{};
-        std::vector<std::shared_ptr<const ISyntax>> types{};
-        std::vector<std::shared_ptr<const InherentImplSyntax>> inherentImpls{};
-        std::vector<std::shared_ptr<const TraitImplSyntax>> traitImpls{};
-        std::vector<std::shared_ptr<const FunctionSyntax>> functions{};
-        std::vector<std::shared_ptr<const GlobalVarSyntax>> globalVars{};
-        std::vector<std::shared_ptr<const UseSyntax>> uses{};
+        std::vector<const ModSyntax*> mods{};
+        std::vector<const ISyntax*> types{};
+        std::vector<const InherentImplSyntax*> inherentImpls{};
+        std::vector<const TraitImplSyntax*> traitImpls{};
+        std::vector<const FunctionSyntax*> functions{};
+        std::vector<const GlobalVarSyntax*> globalVars{};
+        std::vector<const UseSyntax*> uses{};
         while (!parser.IsEnd() && (parser.Peek() != TokenKind::CloseBrace))
         {
-            if (IsModBegin(parser))
+            switch (ClassifyDecl(parser))
             {
-                const auto optMod = diagnostics.Collect(ParseMod(parser, header.BodyScope));
-                if (optMod.has_value())
+                case DeclKind::Mod:
                 {
-                    mods.push_back(optMod.value());
-                    continue;
+                    const auto optMod = diagnostics.Collect(ParseMod(parser, header.BodyScope));
+                    if (optMod.has_value())
+                    {
+                        mods.push_back(optMod.value());
+                        continue;
+                    }
+
+                    break;
                 }
-            }
-            else if (IsTypeBegin(parser))
-            {
-                const auto optType = diagnostics.Collect(ParseType(parser, header.BodyScope));
-                if (optType.has_value())
+
+                case DeclKind::Trait:
                 {
-                    types.push_back(optType.value());
-                    continue;
+                    const auto optTrait = diagnostics.Collect(ParseTrait(parser, header.BodyScope));
+                    if (optTrait.has_value())
+                    {
+                        types.push_back(optTrait.value());
+                        continue;
+                    }
+
+                    break;
                 }
-            }
-            else if (IsInherentImplBegin(parser))
-            {
-                const auto optInherentImpl =
-                    diagnostics.Collect(ParseInherentImpl(parser, header.BodyScope));
-                if (optInherentImpl.has_value())
+
+                case DeclKind::Struct:
                 {
-                    inherentImpls.push_back(optInherentImpl.value());
-                    continue;
+                    const auto optStruct =
+                        diagnostics.Collect(ParseStruct(parser, header.BodyScope));
+                    if (optStruct.has_value())
+                    {
+                        types.push_back(optStruct.value());
+                        continue;
+                    }
+
+                    break;
                 }
-            }
-            else if (IsTraitImplBegin(parser))
-            {
-                const auto optTraitImpl =
-                    diagnostics.Collect(ParseTraitImpl(parser, header.BodyScope));
-                if (optTraitImpl.has_value())
+
+                case DeclKind::InherentImpl:
                 {
-                    traitImpls.push_back(optTraitImpl.value());
-                    continue;
+                    const auto optInherentImpl =
+                        diagnostics.Collect(ParseInherentImpl(parser, header.BodyScope));
+                    if (optInherentImpl.has_value())
+                    {
+                        inherentImpls.push_back(optInherentImpl.value());
+                        continue;
+                    }
+
+                    break;
                 }
-            }
-            else if (IsFunctionBegin(parser))
-            {
-                const auto optFunction =
-                    diagnostics.Collect(ParseFunction(parser, header.BodyScope));
-                if (optFunction.has_value())
+
+                case DeclKind::TraitImpl:
                 {
-                    functions.push_back(optFunction.value());
-                    continue;
+                    const auto optTraitImpl =
+                        diagnostics.Collect(ParseTraitImpl(parser, header.BodyScope));
+                    if (optTraitImpl.has_value())
+                    {
+                        traitImpls.push_back(optTraitImpl.value());
+                        continue;
+                    }
+
+                    break;
                 }
-            }
-            else if (IsVarBegin(parser))
-            {
-                const auto optGlobalVar =
-                    diagnostics.Collect(ParseGlobalVar(parser, header.BodyScope));
-                if (optGlobalVar.has_value())
+
+                case DeclKind::Function:
                 {
-                    globalVars.push_back(optGlobalVar.value());
-                    continue;
+                    const auto optFunction =
+                        diagnostics.Collect(ParseFunction(parser, header.BodyScope));
+                    if (optFunction.has_value())
+                    {
+                        functions.push_back(optFunction.value());
+                        continue;
+                    }
+
+                    break;
                 }
-            }
-            else if (IsUseBegin(parser))
-            {
-                const auto optUse = diagnostics.Collect(ParseUse(parser, header.BodyScope));
-                if (optUse.has_value())
+
+                case DeclKind::Var:
                 {
-                    uses.push_back(optUse.value());
-                    continue;
+                    const auto optGlobalVar =
+                        diagnostics.Collect(ParseGlobalVar(parser, header.BodyScope));
+                    if (optGlobalVar.has_value())
+                    {
+                        globalVars.push_back(optGlobalVar.value());
+                        continue;
+                    }
+
+                    break;
+                }
+
+                case DeclKind::Use:
+                {
+                    const auto optUse = diagnostics.Collect(ParseUse(parser, header.BodyScope));
+                    if (optUse.has_value())
+                    {
+                        uses.push_back(optUse.value());
+                        continue;
+                    }
+
+                    break;
+                }
+
+                case DeclKind::None:
+                {
+                    diagnostics.Add(CreateUnexpectedTokenError(parser.Peek()));
+                    break;
                 }
-            }
-            else
-            {
-                diagnostics.Add(CreateUnexpectedTokenError(parser.Peek()));
             }
 
             parser.DiscardUntil(
@@ -5017,7 +5093,7 @@ namespace Ace
         }
 
         return Expected{
-            std::make_shared<const ModSyntax>(
+            parser.Create<ModSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() },
                 scope,
                 header.BodyScope,
@@ -5036,7 +5112,7 @@ namespace Ace
     }
 
     static auto ParseTopLevelMod(Parser& parser, const std::string& packageName)
-        -> Expected<std::shared_ptr<const ModSyntax>>
+        -> Expected<const ModSyntax*>
     {
         auto diagnostics = DiagnosticBag::Create();
 
@@ -5047,82 +5123,121 @@ namespace Ace
         const auto scope = compilation->GetGlobalScope();
         const auto bodyScope = scope->GetOrCreateChild(packageName);
 
-        std::vector<std::shared_ptr<const ModSyntax>> mods{};
-        std::vector<std::shared_ptr<const ISyntax>> types{};
-        std::vector<std::shared_ptr<const InherentImplSyntax>> inherentImpls{};
-        std::vector<std::shared_ptr<const TraitImplSyntax>> traitImpls{};
-        std::vector<std::shared_ptr<const FunctionSyntax>> functions{};
-        std::vector<std::shared_ptr<const GlobalVarSyntax>> globalVars{};
-        std::vector<std::shared_ptr<const UseSyntax>> uses{};
+        std::vector<const ModSyntax*> mods{};
+        std::vector<const ISyntax*> types{};
+        std::vector<const InherentImplSyntax*> inherentImpls{};
+        std::vector<const TraitImplSyntax*> traitImpls{};
+        std::vector<const FunctionSyntax*> functions{};
+        std::vector<const GlobalVarSyntax*> globalVars{};
+        std::vector<const UseSyntax*> uses{};
         while (!parser.IsEnd())
         {
-            if (IsModBegin(parser))
+            switch (ClassifyDecl(parser))
             {
-                const auto optMod = diagnostics.Collect(ParseMod(parser, bodyScope));
-                if (optMod.has_value())
+                case DeclKind::Mod:
                 {
-                    mods.push_back(optMod.value());
-                    continue;
+                    const auto optMod = diagnostics.Collect(ParseMod(parser, bodyScope));
+                    if (optMod.has_value())
+                    {
+                        mods.push_back(optMod.value());
+                        continue;
+                    }
+
+                    break;
                 }
-            }
-            else if (IsTypeBegin(parser))
-            {
-                const auto optType = diagnostics.Collect(ParseType(parser, bodyScope));
-                if (optType.has_value())
+
+                case DeclKind::Trait:
                 {
-                    types.push_back(optType.value());
-                    continue;
+                    const auto optTrait = diagnostics.Collect(ParseTrait(parser, bodyScope));
+                    if (optTrait.has_value())
+                    {
+                        types.push_back(optTrait.value());
+                        continue;
+                    }
+
+                    break;
                 }
-            }
-            else if (IsInherentImplBegin(parser))
-            {
-                const auto optInherentImpl =
-                    diagnostics.Collect(ParseInherentImpl(parser, bodyScope));
-                if (optInherentImpl.has_value())
+
+                case DeclKind::Struct:
                 {
-                    inherentImpls.push_back(optInherentImpl.value());
-                    continue;
+                    const auto optStruct = diagnostics.Collect(ParseStruct(parser, bodyScope));
+                    if (optStruct.has_value())
+                    {
+                        types.push_back(optStruct.value());
+                        continue;
+                    }
+
+                    break;
                 }
-            }
-            else if (IsTraitImplBegin(parser))
-            {
-                const auto optTraitImpl = diagnostics.Collect(ParseTraitImpl(parser, bodyScope));
-                if (optTraitImpl.has_value())
+
+                case DeclKind::InherentImpl:
                 {
-                    traitImpls.push_back(optTraitImpl.value());
-                    continue;
+                    const auto optInherentImpl =
+                        diagnostics.Collect(ParseInherentImpl(parser, bodyScope));
+                    if (optInherentImpl.has_value())
+                    {
+                        inherentImpls.push_back(optInherentImpl.value());
+                        continue;
+                    }
+
+                    break;
                 }
-            }
-            else if (IsFunctionBegin(parser))
-            {
-                const auto optFunction = diagnostics.Collect(ParseFunction(parser, bodyScope));
-                if (optFunction.has_value())
+
+                case DeclKind::TraitImpl:
                 {
-                    functions.push_back(optFunction.value());
-                    continue;
+                    const auto optTraitImpl =
+                        diagnostics.Collect(ParseTraitImpl(parser, bodyScope));
+                    if (optTraitImpl.has_value())
+                    {
+                        traitImpls.push_back(optTraitImpl.value());
+                        continue;
+                    }
+
+                    break;
                 }
-            }
-            else if (IsVarBegin(parser))
-            {
-                const auto optGlobalVar = diagnostics.Collect(ParseGlobalVar(parser, bodyScope));
-                if (optGlobalVar.has_value())
+
+                case DeclKind::Function:
                 {
-                    globalVars.push_back(optGlobalVar.value());
-                    continue;
+                    const auto optFunction = diagnostics.Collect(ParseFunction(parser, bodyScope));
+                    if (optFunction.has_value())
+                    {
+                        functions.push_back(optFunction.value());
+                        continue;
+                    }
+
+                    break;
                 }
-            }
-            else if (IsUseBegin(parser))
-            {
-                const auto optUse = diagnostics.Collect(ParseUse(parser, bodyScope));
-                if (optUse.has_value())
+
+                case DeclKind::Var:
                 {
-                    uses.push_back(optUse.value());
-                    continue;
+                    const auto optGlobalVar =
+                        diagnostics.Collect(ParseGlobalVar(parser, bodyScope));
+                    if (optGlobalVar.has_value())
+                    {
+                        globalVars.push_back(optGlobalVar.value());
+                        continue;
+                    }
+
+                    break;
+                }
+
+                case DeclKind::Use:
+                {
+                    const auto optUse = diagnostics.Collect(ParseUse(parser, bodyScope));
+                    if (optUse.has_value())
+                    {
+                        uses.push_back(optUse.value());
+                        continue;
+                    }
+
+                    break;
+                }
+
+                case DeclKind::None:
+                {
+                    diagnostics.Add(CreateUnexpectedTokenError(parser.Peek()));
+                    break;
                 }
-            }
-            else
-            {
-                diagnostics.Add(CreateUnexpectedTokenError(parser.Peek()));
             }
 
             parser.DiscardUntil(
@@ -5135,7 +5250,7 @@ namespace Ace
         const std::vector name{ Ident{ beginSrcLocation, packageName } };
 
         return Expected{
-            std::make_shared<const ModSyntax>(
+            parser.Create<ModSyntax>(
                 SrcLocation{ beginSrcLocation, parser.GetLastSrcLocation() },
                 scope,
                 bodyScope,
@@ -5153,16 +5268,26 @@ namespace Ace
         };
     }
 
-    auto ParseAST(const std::string& packageName, const FileBuffer* const fileBuffer)
-        -> Expected<std::shared_ptr<const ModSyntax>>
+    auto ParseAST(
+        SyntaxArena* const arena,
+        const std::string& packageName,
+        const FileBuffer* const fileBuffer,
+        TokenCursor tokenCursor
+    ) -> Expected<const ModSyntax*>
     {
-        auto diagnostics = DiagnosticBag::Create();
+        ACE_ASSERT(tokenCursor.GetFileBuffer() == fileBuffer);
+
+        auto parseDiagnostics = DiagnosticBag::Create();
+
+        Parser parser{ arena, std::move(tokenCursor) };
 
-        const auto tokens = diagnostics.Collect(LexTokens(fileBuffer));
+        const auto optMod = parseDiagnostics.Collect(ParseTopLevelMod(parser, packageName));
 
-        Parser parser{ fileBuffer, std::move(tokens) };
+        // Lexing diagnostics are reported ahead of parsing diagnostics, as when the file was lexed
+        // before it was parsed.
+        auto diagnostics = parser.TakeLexingDiagnostics();
+        diagnostics.Add(std::move(parseDiagnostics));
 
-        const auto optMod = diagnostics.Collect(ParseTopLevelMod(parser, packageName));
         if (!optMod.has_value())
         {
             return std::move(diagnostics);
@@ -5,6 +5,7 @@
 #include <string>
 #include <optional>
 #include <map>
+#include <mutex>
 
 #include "Assert.hpp"
 #include "Diagnostic.hpp"
@@ -20,6 +21,7 @@
 #include "Keyword.hpp"
 #include "PlaceholderOverlapping.hpp"
 #include "GenericInstantiator.hpp"
+#include "BindingSpeculation.hpp"
 
 namespace Ace
 {
@@ -40,7 +42,8 @@ namespace Ace
             dynamic_cast<const FileBuffer*>(declSyntax->GetSrcLocation().Buffer);
         ACE_ASSERT(fileBuffer);
 
-        if ((fileBuffer->GetOrigin() == SourceOrigin::User) && name.String.starts_with("__"))
+        const bool isUserDecl = fileBuffer->GetOrigin() == SourceOrigin::User;
+        if (isUserDecl && name.String.GetString().starts_with("__"))
         {
             diagnostics.Add(CreateReservedCompilerPrefixError(name));
         }
@@ -170,7 +173,7 @@ namespace Ace
         return std::distance(NameSection, NameSectionsEnd) == 1;
     }
 
-    auto SymbolResolutionContext::GetName() const -> const std::string&
+    auto SymbolResolutionContext::GetName() const -> const InternedString&
     {
         return NameSection->Name.String;
     }
@@ -199,19 +202,6 @@ namespace Ace
         return m_Scope;
     }
 
-    static auto FindExpiredChild(const std::vector<std::weak_ptr<Scope>>& children)
-        -> std::vector<std::weak_ptr<Scope>>::const_iterator
-    {
-        return std::find_if(
-            begin(children),
-            end(children),
-            [&](const std::weak_ptr<Scope>& child)
-            {
-                return child.expired();
-            }
-        );
-    }
-
     Scope::~Scope()
     {
         if (!m_OptParent.has_value())
@@ -219,13 +209,15 @@ namespace Ace
             return;
         }
 
-        auto& parentChildren = m_OptParent.value()->m_Children;
+        auto* const parent = m_OptParent.value().get();
 
-        const auto expiredChildIt = FindExpiredChild(parentChildren);
-        ACE_ASSERT(expiredChildIt != end(parentChildren));
-        parentChildren.erase(expiredChildIt);
+        ACE_ASSERT(m_ParentChildIt->expired());
+        parent->m_Children.erase(m_ParentChildIt);
 
-        ACE_ASSERT(FindExpiredChild(parentChildren) == end(parentChildren));
+        if (m_OptName.has_value())
+        {
+            parent->m_NamedChildMap.erase(m_OptName.value());
+        }
     }
 
     auto Scope::GetCompilation() const -> Compilation*
@@ -258,6 +250,16 @@ namespace Ace
         return m_GenericInstantiator;
     }
 
+    auto Scope::GetTraitImplIndex() const -> TraitImplIndex&
+    {
+        return *m_TraitImplIndex;
+    }
+
+    auto Scope::GetInherentImplIndex() const -> InherentImplIndex&
+    {
+        return *m_InherentImplIndex;
+    }
+
     auto Scope::FindMod() const -> std::optional<ModSymbol*>
     {
         auto child = shared_from_this();
@@ -278,7 +280,8 @@ namespace Ace
                 continue;
             }
 
-            const auto matchingNameSymbolsIt = parent->m_SymbolMap.find(child->GetName().value());
+            const auto matchingNameSymbolsIt =
+                parent->m_SymbolMap.find(InternedString{ child->GetName().value() });
 
             if (matchingNameSymbolsIt == end(parent->m_SymbolMap))
             {
@@ -322,17 +325,10 @@ namespace Ace
 
     auto Scope::GetOrCreateChild(const std::string& name) -> std::shared_ptr<Scope>
     {
-        const auto matchingNameChildIt = std::find_if(
-            begin(m_Children),
-            end(m_Children),
-            [&](const std::weak_ptr<Scope>& child)
-            {
-                return child.lock()->m_OptName == name;
-            }
-        );
-        if (matchingNameChildIt != end(m_Children))
+        const auto matchingNameChildIt = m_NamedChildMap.find(name);
+        if (matchingNameChildIt != end(m_NamedChildMap))
         {
-            return matchingNameChildIt->lock();
+            return matchingNameChildIt->second.lock();
         }
 
         return AddChild(name);
@@ -410,7 +406,7 @@ namespace Ace
         return children;
     }
 
-    auto Scope::HasSymbolWithName(const std::string& name) const -> bool
+    auto Scope::HasSymbolWithName(const InternedString& name) const -> bool
     {
         return m_SymbolMap.find(name) != end(m_SymbolMap);
     }
@@ -418,7 +414,8 @@ namespace Ace
     auto Scope::RemoveSymbol(ISymbol* const symbol) -> void
     {
         const auto scope = symbol->GetScope();
-        auto& symbols = scope->m_SymbolMap.at(symbol->GetName().String);
+        const auto name = symbol->GetName().String;
+        auto& symbols = scope->m_SymbolMap.at(name);
 
         const auto matchingSymbolIt = std::find_if(
             begin(symbols),
@@ -430,7 +427,42 @@ namespace Ace
         );
         ACE_ASSERT(matchingSymbolIt != end(symbols));
 
+        GenericInstantiator::OnSymbolRemoved(symbol);
+
+        if (auto* const traitImpl = dynamic_cast<TraitImplSymbol*>(symbol))
+        {
+            scope->m_TraitImplIndex->Remove(traitImpl);
+        }
+
+        if (auto* const inherentImpl = dynamic_cast<InherentImplSymbol*>(symbol))
+        {
+            scope->m_InherentImplIndex->Remove(inherentImpl);
+        }
+
+        {
+            std::lock_guard lock{ scope->m_SymbolIndexMutex };
+
+            auto& declaredSymbols = scope->m_DeclaredSymbols;
+            declaredSymbols.erase(std::find(begin(declaredSymbols), end(declaredSymbols), symbol));
+
+            std::for_each(
+                begin(scope->m_SymbolIndexMap),
+                end(scope->m_SymbolIndexMap),
+                [&](const auto& typeAndIndex)
+                {
+                    typeAndIndex.second->Remove(symbol);
+                }
+            );
+        }
+
+        // The indices cast the symbol, so it is only destroyed once they no longer refer to it.
         symbols.erase(matchingSymbolIt);
+
+        // Lookups expect every name in the map to have a symbol.
+        if (symbols.empty())
+        {
+            scope->m_SymbolMap.erase(name);
+        }
     }
 
     auto Scope::CreateArgTypes(const std::vector<ITypeSymbol*>& argTypes)
@@ -441,27 +473,8 @@ namespace Ace
 
     auto Scope::CollectAllSymbols() const -> std::vector<ISymbol*>
     {
-        std::vector<ISymbol*> symbols{};
-
-        std::for_each(
-            begin(m_SymbolMap),
-            end(m_SymbolMap),
-            [&](const std::pair<const std::string&, const std::vector<std::unique_ptr<ISymbol>>&>&
-                    pair)
-            {
-                std::transform(
-                    begin(pair.second),
-                    end(pair.second),
-                    back_inserter(symbols),
-                    [](const std::unique_ptr<ISymbol>& symbol)
-                    {
-                        return symbol.get();
-                    }
-                );
-            }
-        );
-
-        return symbols;
+        std::lock_guard lock{ m_SymbolIndexMutex };
+        return m_DeclaredSymbols;
     }
 
     auto Scope::CollectAllSymbolsRecursive() const -> std::vector<ISymbol*>
@@ -763,7 +776,8 @@ namespace Ace
 
     auto Scope::CollectTypeParams() const -> std::vector<TypeParamTypeSymbol*>
     {
-        auto params = CollectSymbols<TypeParamTypeSymbol>();
+        const auto declaredParams = CollectSymbols<TypeParamTypeSymbol>();
+        std::vector<TypeParamTypeSymbol*> params{ begin(declaredParams), end(declaredParams) };
         std::sort(
             begin(params),
             end(params),
@@ -776,90 +790,61 @@ namespace Ace
         return params;
     }
 
-    auto Scope::HasImpl(TraitTypeSymbol* const trait, ITypeSymbol* const type) -> bool
+    static auto CollectOverlappingImpls(TraitTypeSymbol* const trait, ITypeSymbol* const type)
+        -> std::set<TraitImplSymbol*>
     {
-        if (dynamic_cast<TypeParamTypeSymbol*>(type->GetUnaliasedType()))
-        {
-            return false;
-        }
-
-        std::vector scopes{ trait->GetUnaliased()->GetScope() };
-
+        const auto traitScope = trait->GetUnaliased()->GetScope();
         const auto typeScope = type->GetUnaliased()->GetScope();
-        if (typeScope != scopes.front())
-        {
-            scopes.push_back(typeScope);
-        }
+
+        const auto candidateImpls =
+            traitScope->GetTraitImplIndex().CollectCandidates(trait, type->GetUnaliasedType());
 
         std::set<TraitImplSymbol*> impls{};
         std::for_each(
-            begin(scopes),
-            end(scopes),
-            [&](const std::shared_ptr<Scope>& scope)
+            begin(candidateImpls),
+            end(candidateImpls),
+            [&](TraitImplSymbol* const impl)
             {
-                const auto allImpls = scope->CollectSymbols<TraitImplSymbol>();
+                const auto implScope = impl->GetScope();
+                const bool isInSearchedScope = (implScope == traitScope) ||
+                                               (implScope == typeScope);
+                if (!isInSearchedScope)
+                {
+                    return;
+                }
 
-                std::for_each(
-                    begin(allImpls),
-                    end(allImpls),
-                    [&](TraitImplSymbol* const impl)
-                    {
-                        const bool doesOverlap = DoPlaceholdersOverlap(trait, impl->GetTrait()) &&
-                                                 DoPlaceholdersOverlap(type, impl->GetType());
-                        if (doesOverlap)
-                        {
-                            impls.insert(dynamic_cast<TraitImplSymbol*>(impl->GetUnaliased()));
-                        }
-                    }
-                );
+                const bool doesOverlap = DoPlaceholdersOverlap(trait, impl->GetTrait()) &&
+                                         DoPlaceholdersOverlap(type, impl->GetType());
+                if (doesOverlap)
+                {
+                    impls.insert(dynamic_cast<TraitImplSymbol*>(impl->GetUnaliased()));
+                }
             }
         );
 
         ACE_ASSERT(impls.empty() || impls.size() == 1);
-        return !impls.empty();
+        return impls;
     }
 
-    auto Scope::CollectImplOfFor(TraitTypeSymbol* const trait, ITypeSymbol* const type)
-        -> std::optional<TraitImplSymbol*>
+    auto Scope::HasImpl(TraitTypeSymbol* const trait, ITypeSymbol* const type) -> bool
     {
         if (dynamic_cast<TypeParamTypeSymbol*>(type->GetUnaliasedType()))
         {
-            return std::nullopt;
+            return false;
         }
 
-        std::vector scopes{ trait->GetUnaliased()->GetScope() };
+        return !CollectOverlappingImpls(trait, type).empty();
+    }
 
-        const auto typeScope = type->GetUnaliased()->GetScope();
-        if (typeScope != scopes.front())
+    auto Scope::CollectImplOfFor(TraitTypeSymbol* const trait, ITypeSymbol* const type)
+        -> std::optional<TraitImplSymbol*>
+    {
+        if (dynamic_cast<TypeParamTypeSymbol*>(type->GetUnaliasedType()))
         {
-            scopes.push_back(typeScope);
+            return std::nullopt;
         }
 
-        std::set<TraitImplSymbol*> impls{};
-        std::for_each(
-            begin(scopes),
-            end(scopes),
-            [&](const std::shared_ptr<Scope>& scope)
-            {
-                const auto allImpls = scope->CollectSymbols<TraitImplSymbol>();
-
-                std::for_each(
-                    begin(allImpls),
-                    end(allImpls),
-                    [&](TraitImplSymbol* const impl)
-                    {
-                        const bool doesOverlap = DoPlaceholdersOverlap(trait, impl->GetTrait()) &&
-                                                 DoPlaceholdersOverlap(type, impl->GetType());
-                        if (doesOverlap)
-                        {
-                            impls.insert(dynamic_cast<TraitImplSymbol*>(impl->GetUnaliased()));
-                        }
-                    }
-                );
-            }
-        );
-
-        ACE_ASSERT(impls.empty() || impls.size() == 1);
+        const auto impls = CollectOverlappingImpls(trait, type);
         return impls.empty() ? std::nullopt : std::optional{ *begin(impls) };
     }
 
@@ -1015,6 +1000,13 @@ namespace Ace
         );
 
         m_SymbolMap.clear();
+        {
+            std::lock_guard lock{ m_SymbolIndexMutex };
+            m_DeclaredSymbols.clear();
+            m_SymbolIndexMap.clear();
+        }
+        m_TraitImplIndex->Clear();
+        m_InherentImplIndex->Clear();
         m_OptParent = std::nullopt;
     }
 
@@ -1031,21 +1023,34 @@ namespace Ace
           m_OptParent{ optParent },
           m_SymbolMap{},
           m_Children{},
-          m_GenericInstantiator{ this }
+          m_GenericInstantiator{ this },
+          m_TraitImplIndex{ optParent.has_value() ? optParent.value()->m_TraitImplIndex
+                                                  : std::make_shared<TraitImplIndex>() },
+          m_InherentImplIndex{ optParent.has_value() ? optParent.value()->m_InherentImplIndex
+                                                     : std::make_shared<InherentImplIndex>() }
     {
         m_NestLevel = optParent.has_value() ? (optParent.value()->GetNestLevel() + 1) : 0;
     }
 
     auto Scope::AddChild(const std::optional<std::string>& optName) -> std::shared_ptr<Scope>
     {
+        BindingSpeculation::OnCreateChild(this);
+
         std::shared_ptr<Scope> child{ new Scope(m_Compilation, optName, shared_from_this()) };
 
         m_Children.push_back(child);
+        child->m_ParentChildIt = std::prev(end(m_Children));
+
+        if (optName.has_value())
+        {
+            m_NamedChildMap.emplace(optName.value(), child);
+        }
+
         return child;
     }
 
     auto Scope::GetDeclaredSymbol(
-        const std::string& name,
+        const InternedString& name,
         const std::vector<ITypeSymbol*>& typeArgs,
         const std::optional<ITypeSymbol*>& optSelfType
     ) const -> std::optional<ISymbol*>
@@ -1072,8 +1077,41 @@ namespace Ace
         return ResolveGenericInstance(generic->GetGenericRoot(), typeArgs, optSelfType);
     }
 
+    auto Scope::AddSymbol(std::unique_ptr<ISymbol> ownedSymbol) -> void
+    {
+        auto* const symbol = ownedSymbol.get();
+
+        BindingSpeculation::OnDeclareSymbol(symbol);
+
+        m_SymbolMap[symbol->GetName().String].push_back(std::move(ownedSymbol));
+        OnSymbolDeclared(symbol);
+    }
+
     auto Scope::OnSymbolDeclared(ISymbol* const symbol) -> void
     {
+        {
+            std::lock_guard lock{ m_SymbolIndexMutex };
+            m_DeclaredSymbols.push_back(symbol);
+            std::for_each(
+                begin(m_SymbolIndexMap),
+                end(m_SymbolIndexMap),
+                [&](const auto& typeAndIndex)
+                {
+                    typeAndIndex.second->Add(symbol);
+                }
+            );
+        }
+
+        if (auto* const traitImpl = dynamic_cast<TraitImplSymbol*>(symbol))
+        {
+            m_TraitImplIndex->Add(traitImpl);
+        }
+
+        if (auto* const inherentImpl = dynamic_cast<InherentImplSymbol*>(symbol))
+        {
+            m_InherentImplIndex->Add(inherentImpl);
+        }
+
         GenericInstantiator::OnSymbolDeclared(symbol);
     }
 
@@ -1247,74 +1285,18 @@ namespace Ace
         return Expected{ optGenericInstance.value(), std::move(diagnostics) };
     }
 
-    static auto
-    DoTypeArgsMatch(ISymbol* const genericInstance, const std::vector<ITypeSymbol*>& typeArgs)
-        -> bool
-    {
-        auto* const generic = dynamic_cast<IGenericSymbol*>(genericInstance);
-        ACE_ASSERT(generic);
-
-        if (typeArgs.size() != generic->GetTypeArgs().size())
-        {
-            return false;
-        }
-
-        for (size_t i = 0; i < typeArgs.size(); i++)
-        {
-            auto* const lhsType = typeArgs.at(i)->GetUnaliased();
-            auto* const rhsType = generic->GetTypeArgs().at(i)->GetUnaliased();
-
-            if (lhsType != rhsType)
-            {
-                return false;
-            }
-        }
-
-        return true;
-    }
-
-    static auto DoesPrototypeSelfTypeMatch(
-        ISymbol* const genericInstance, const std::optional<ITypeSymbol*>& optSelfType
-    ) -> bool
-    {
-        auto* const prototype = dynamic_cast<PrototypeSymbol*>(genericInstance->GetUnaliased());
-        if (!prototype)
-        {
-            return true;
-        }
-
-        if (!optSelfType.has_value())
-        {
-            return false;
-        }
-
-        return prototype->GetSelfType()->GetUnaliased() == optSelfType.value()->GetUnaliased();
-    }
-
     auto Scope::ResolveGenericInstance(
         const IGenericSymbol* const root,
         std::vector<ITypeSymbol*> typeArgs,
         const std::optional<ITypeSymbol*>& optSelfType
     ) -> std::optional<ISymbol*>
     {
-        const auto& instances = root->GetScope()->m_SymbolMap.at(root->GetName().String);
-
         if (root->GetTypeArgs().empty())
         {
             typeArgs.clear();
         }
 
-        const auto instanceIt = std::find_if(
-            begin(instances),
-            end(instances),
-            [&](const std::unique_ptr<ISymbol>& instance)
-            {
-                return DoTypeArgsMatch(instance.get(), typeArgs) &&
-                       DoesPrototypeSelfTypeMatch(instance.get(), optSelfType);
-            }
-        );
-
-        return (instanceIt == end(instances)) ? std::nullopt : std::optional{ instanceIt->get() };
+        return GenericInstantiator::FindInstance(root, typeArgs, optSelfType);
     }
 
     auto Scope::FindStaticBeginScope(const SrcLocation& srcLocation, const SymbolName& name) const
@@ -1326,7 +1308,7 @@ namespace Ace
 
         const auto& nameString = name.Sections.front().Name.String;
 
-        const bool isNativeType = KeywordToTokenKindMap.contains(nameString);
+        const bool isNativeType = FindKeywordTokenKind(nameString.GetString()).has_value();
         const bool isGlobal = name.IsGlobal && globalScope->m_SymbolMap.contains(nameString);
 
         if (isNativeType || isGlobal)
@@ -1605,7 +1587,7 @@ namespace Ace
         return Expected{ symbol, std::move(diagnostics) };
     }
 
-    auto Scope::CollectInherentImplFor(const std::string& name, ITypeSymbol* type)
+    auto Scope::CollectInherentImplFor(const InternedString& name, ITypeSymbol* type)
         -> std::optional<InherentImplSymbol*>
     {
         auto diagnostics = DiagnosticBag::Create();
@@ -1613,21 +1595,22 @@ namespace Ace
         type = type->GetUnaliasedType();
 
         auto* const packageMod = type->GetScope()->FindPackageMod();
-        const auto packageBodyScope = packageMod->GetBodyScope();
 
-        const auto allImpls = packageBodyScope->CollectSymbolsRecursive<InherentImplSymbol>();
+        const auto candidateImpls =
+            type->GetScope()->GetInherentImplIndex().CollectCandidates(type);
 
         const auto implIt = std::find_if(
-            begin(allImpls),
-            end(allImpls),
+            begin(candidateImpls),
+            end(candidateImpls),
             [&](InherentImplSymbol* const impl)
             {
-                return DoPlaceholdersOverlap(type, impl->GetType()) &&
-                       impl->GetBodyScope()->HasSymbolWithName(name);
+                return impl->GetBodyScope()->HasSymbolWithName(name) &&
+                       (impl->GetScope()->FindPackageMod() == packageMod) &&
+                       DoPlaceholdersOverlap(type, impl->GetType());
             }
         );
 
-        return (implIt == end(allImpls)) ? std::nullopt : std::optional{ *implIt };
+        return (implIt == end(candidateImpls)) ? std::nullopt : std::optional{ *implIt };
     }
 
     static auto CollectMatchingNameImplSymbol(const std::string& name, TraitImplSymbol* const impl)
@@ -1677,7 +1660,7 @@ namespace Ace
         const auto uses = modBodyScope->CollectSymbols<UseSymbol>();
         const auto traits = modBodyScope->CollectSymbols<TraitTypeSymbol>();
 
-        auto rootTraits = traits;
+        std::vector<TraitTypeSymbol*> rootTraits{ begin(traits), end(traits) };
         std::transform(
             begin(uses),
             end(uses),
@@ -1780,7 +1763,7 @@ namespace Ace
         return Expected{ scopes, std::move(diagnostics) };
     }
 
-    auto Scope::CollectInherentScopes(const std::string& name, ITypeSymbol* const type)
+    auto Scope::CollectInherentScopes(const InternedString& name, ITypeSymbol* const type)
         -> std::vector<std::shared_ptr<const Scope>>
     {
         std::vector<std::shared_ptr<const Scope>> scopes{};
@@ -1798,13 +1781,13 @@ namespace Ace
     auto Scope::ResolveSpecialSymbol(const SymbolResolutionContext& context)
         -> std::optional<Expected<ISymbol*>>
     {
-        const auto tokenKindIt = KeywordToTokenKindMap.find(context.GetName());
-        if (tokenKindIt == end(KeywordToTokenKindMap))
+        const auto optTokenKind = FindKeywordTokenKind(context.GetName().GetString());
+        if (!optTokenKind.has_value())
         {
             return std::nullopt;
         }
 
-        const auto tokenKind = tokenKindIt->second;
+        const auto tokenKind = optTokenKind.value();
         switch (tokenKind)
         {
             case TokenKind::UpperSelfKeyword:
@@ -1814,9 +1797,8 @@ namespace Ace
 
             default:
             {
-                auto* const nativeTypeSymbol = GetTokenKindNativeTypeSymbol(
-                    context.BeginScope->GetCompilation(), tokenKindIt->second
-                );
+                auto* const nativeTypeSymbol =
+                    GetTokenKindNativeTypeSymbol(context.BeginScope->GetCompilation(), tokenKind);
                 return Expected{ nativeTypeSymbol, DiagnosticBag::Create() };
             }
         }
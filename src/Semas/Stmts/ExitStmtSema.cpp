@@ -72,7 +72,10 @@ namespace Ace
         const auto srcLocation = GetSrcLocation();
         const auto location = srcLocation.Buffer->FormatLocation(srcLocation);
 
-        emitter.EmitPrintf(emitter.EmitString("Aborted at " + location));
+        emitter.EmitPrintf({
+            emitter.EmitString("Aborted at %s"),
+            emitter.EmitString(location),
+        });
 
         auto* const argValue = llvm::ConstantInt::get(emitter.GetC().GetTypes().GetInt(), -1, true);
 
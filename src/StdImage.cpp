@@ -0,0 +1,125 @@
+#include "StdImage.hpp"
+
+#include <vector>
+#include <algorithm>
+#include <span>
+#include <string>
+#include <string_view>
+#include <optional>
+#include <ostream>
+#include <memory>
+#include <cstdint>
+
+#include "Std.hpp"
+#include "Lexer.hpp"
+#include "Token.hpp"
+#include "TokenKind.hpp"
+#include "FileBuffer.hpp"
+#include "SrcLocation.hpp"
+#include "Diagnostic.hpp"
+
+namespace Ace::Std
+{
+    auto FindImageTokens(const FileBuffer* const fileBuffer)
+        -> std::optional<std::span<const Token>>
+    {
+        const auto* const image = GetImage();
+        if (!image || (fileBuffer->GetOrigin() != SourceOrigin::Compiler))
+        {
+            return std::nullopt;
+        }
+
+        const std::string_view buffer{ fileBuffer->GetBuffer() };
+
+        const auto* const filesEnd = image->Files + image->FileCount;
+        const auto* const matchingFile = std::find_if(
+            image->Files,
+            filesEnd,
+            [&](const ImageFile& file)
+            {
+                return (file.Path == fileBuffer->GetPath().string()) &&
+                       (file.BufferSize == buffer.size());
+            }
+        );
+        if (matchingFile == filesEnd)
+        {
+            return std::nullopt;
+        }
+
+        return std::span<const Token>{ matchingFile->Tokens, matchingFile->TokenCount };
+    }
+
+    // Writes `string` as the contents of a C++ string literal.
+    static auto WriteEscapedString(std::ostream& stream, const std::string_view string) -> void
+    {
+        std::for_each(
+            begin(string),
+            end(string),
+            [&](const char character)
+            {
+                if ((character == '\\') || (character == '"'))
+                {
+                    stream << '\\';
+                }
+
+                stream << character;
+            }
+        );
+    }
+
+    auto WriteImageSource(std::ostream& stream) -> bool
+    {
+        const auto fileBuffers = CreateFileBuffers(nullptr);
+
+        stream << "#include \"StdImage.hpp\"\n\n";
+        stream << "#include <iterator>\n\n";
+        stream << "namespace Ace::Std\n{\n";
+
+        for (size_t i = 0; i < fileBuffers.size(); i++)
+        {
+            const auto* const fileBuffer = fileBuffers.at(i).get();
+
+            auto diagnostics = DiagnosticBag::Create();
+            const auto tokens = diagnostics.Collect(LexTokens(fileBuffer));
+            if (diagnostics.HasErrors())
+            {
+                return false;
+            }
+
+            stream << "    static constexpr Token Tokens" << i << "[] =\n    {\n";
+            std::for_each(
+                begin(tokens),
+                end(tokens),
+                [&](const Token& token)
+                {
+                    stream << "        { static_cast<TokenKind>(";
+                    stream << static_cast<uint32_t>(token.Kind) << "), ";
+                    stream << token.CharacterBeginIndex << ", ";
+                    stream << token.CharacterLength << ", ";
+                    stream << token.StringLength << " },\n";
+                }
+            );
+            stream << "    };\n\n";
+        }
+
+        stream << "    static const ImageFile Files[] =\n    {\n";
+        for (size_t i = 0; i < fileBuffers.size(); i++)
+        {
+            const auto* const fileBuffer = fileBuffers.at(i).get();
+
+            stream << "        { \"";
+            WriteEscapedString(stream, fileBuffer->GetPath().string());
+            stream << "\", ";
+            stream << fileBuffer->GetBuffer().size();
+            stream << ", Tokens" << i << ", std::size(Tokens" << i << ") },\n";
+        }
+        stream << "    };\n\n";
+
+        stream << "    static const Image StdImage{ Files, std::size(Files) };\n\n";
+
+        stream << "    auto GetImage() -> const Image*\n    {\n";
+        stream << "        return &StdImage;\n    }\n}\n";
+
+        return true;
+    }
+}
@@ -13,7 +13,8 @@ namespace Ace
 {
     auto ICallableSymbol::CollectParams() const -> std::vector<IParamVarSymbol*>
     {
-        auto params = GetBodyScope()->CollectSymbols<NormalParamVarSymbol>();
+        const auto declaredParams = GetBodyScope()->CollectSymbols<NormalParamVarSymbol>();
+        std::vector<NormalParamVarSymbol*> params{ begin(declaredParams), end(declaredParams) };
         std::sort(
             begin(params),
             end(params),
@@ -13,7 +13,8 @@ namespace Ace
 {
     auto IConstrainedSymbol::CollectConstraints() const -> std::vector<ConstraintSymbol*>
     {
-        return GetConstrainedScope()->CollectSymbols<ConstraintSymbol>();
+        const auto constraints = GetConstrainedScope()->CollectSymbols<ConstraintSymbol>();
+        return { begin(constraints), end(constraints) };
     }
 
     auto DiagnoseUnsatisfiedConstraint(
@@ -4,6 +4,8 @@
 #include <vector>
 #include <string>
 #include <optional>
+#include <atomic>
+#include <mutex>
 
 #include "Assert.hpp"
 #include "Symbols/Symbol.hpp"
@@ -26,12 +28,12 @@ namespace Ace
         return GetScope()->GetCompilation();
     }
 
-    auto ISymbol::GetUnaliased() const -> ISymbol*
+    static auto FindUnaliased(const ISymbol* const symbol) -> ISymbol*
     {
-        auto* aliasType = dynamic_cast<IAliasTypeSymbol*>(const_cast<ISymbol*>(this));
+        auto* aliasType = dynamic_cast<IAliasTypeSymbol*>(const_cast<ISymbol*>(symbol));
         if (!aliasType)
         {
-            return const_cast<ISymbol*>(this);
+            return const_cast<ISymbol*>(symbol);
         }
 
         auto* type = dynamic_cast<ITypeSymbol*>(aliasType);
@@ -43,6 +45,19 @@ namespace Ace
         return type;
     }
 
+    auto ISymbol::GetUnaliased() const -> ISymbol*
+    {
+        // Every thread finds the same symbol, so a race only stores it twice.
+        auto* unaliased = m_UnaliasedCache.load(std::memory_order_acquire);
+        if (!unaliased)
+        {
+            unaliased = FindUnaliased(this);
+            m_UnaliasedCache.store(unaliased, std::memory_order_release);
+        }
+
+        return unaliased;
+    }
+
     static auto CreateTypeArgsSignature(const IGenericSymbol* const generic) -> std::string
     {
         const auto& args = generic->GetTypeArgs();
@@ -80,7 +95,7 @@ namespace Ace
         return signature;
     }
 
-    auto ISymbol::CreateLocalSignature() const -> std::string
+    auto ISymbol::CreateLocalSignature() const -> const std::string&
     {
         auto* const symbol = GetUnaliased();
         if (symbol != this)
@@ -88,19 +103,27 @@ namespace Ace
             return symbol->CreateLocalSignature();
         }
 
-        std::string signature = GetName().String;
+        std::call_once(
+            m_LocalSignatureOnceFlag,
+            [&]()
+            {
+                std::string signature = GetName().String;
 
-        if (auto* const prototype = dynamic_cast<const PrototypeSymbol*>(this))
-        {
-            signature += "<" + prototype->GetSelfType()->CreateSignature() + ">";
-        }
+                if (auto* const prototype = dynamic_cast<const PrototypeSymbol*>(this))
+                {
+                    signature += "<" + prototype->GetSelfType()->CreateSignature() + ">";
+                }
 
-        if (auto* const generic = dynamic_cast<const IGenericSymbol*>(this))
-        {
-            signature += CreateTypeArgsSignature(generic);
-        }
+                if (auto* const generic = dynamic_cast<const IGenericSymbol*>(this))
+                {
+                    signature += CreateTypeArgsSignature(generic);
+                }
 
-        return signature;
+                m_OptLocalSignatureCache = std::move(signature);
+            }
+        );
+
+        return m_OptLocalSignatureCache.value();
     }
 
     static auto CreateScopeName(const std::shared_ptr<Scope>& scope) -> std::string
@@ -109,7 +132,7 @@ namespace Ace
                                             : scope->GetAnonymousName().value();
     }
 
-    auto ISymbol::CreateSignature() const -> std::string
+    auto ISymbol::CreateSignature() const -> const std::string&
     {
         auto* const symbol = GetUnaliased();
         if (symbol != this)
@@ -117,34 +140,43 @@ namespace Ace
             return symbol->CreateSignature();
         }
 
-        std::vector<std::shared_ptr<Scope>> scopes{};
-        for (auto optScope = std::optional{ GetScope() }; optScope.has_value();
-             optScope = optScope.value()->GetParent())
-        {
-            scopes.push_back(optScope.value());
-        }
-
-        std::string signature{};
-        bool isFirstScope = true;
-        std::for_each(
-            rbegin(scopes) + 1,
-            rend(scopes),
-            [&](const std::shared_ptr<Scope>& scope)
+        std::call_once(
+            m_SignatureOnceFlag,
+            [&]()
             {
-                if (isFirstScope)
-                {
-                    signature = CreateScopeName(scope);
-                    isFirstScope = false;
-                }
-                else
+                std::vector<std::shared_ptr<Scope>> scopes{};
+                for (auto optScope = std::optional{ GetScope() }; optScope.has_value();
+                     optScope = optScope.value()->GetParent())
                 {
-                    signature = signature + "::" + CreateScopeName(scope);
+                    scopes.push_back(optScope.value());
                 }
+
+                std::string signature{};
+                bool isFirstScope = true;
+                std::for_each(
+                    rbegin(scopes) + 1,
+                    rend(scopes),
+                    [&](const std::shared_ptr<Scope>& scope)
+                    {
+                        if (isFirstScope)
+                        {
+                            signature = CreateScopeName(scope);
+                            isFirstScope = false;
+                        }
+                        else
+                        {
+                            signature = signature + "::" + CreateScopeName(scope);
+                        }
+                    }
+                );
+
+                m_OptSignatureCache = signature.empty()
+                                          ? CreateLocalSignature()
+                                          : signature + "::" + CreateLocalSignature();
             }
         );
 
-        return signature.empty() ? CreateLocalSignature()
-                                 : signature + "::" + CreateLocalSignature();
+        return m_OptSignatureCache.value();
     }
 
     auto ISymbol::CreateFullyQualifiedName(const SrcLocation& srcLocation) const -> SymbolName
@@ -343,7 +375,7 @@ namespace Ace
 
         if (tokenKind != TokenKind::Ident)
         {
-            return std::string{ TokenKindToKeywordMap.at(tokenKind) };
+            return std::string{ GetKeyword(tokenKind) };
         }
 
         std::vector<std::shared_ptr<Scope>> scopes{};
@@ -434,6 +466,28 @@ namespace Ace
         return const_cast<ISymbol*>(this)->GetUnaliased();
     }
 
+    auto ISymbol::CollectCacheStats(SymbolCacheStats& stats) const -> void
+    {
+        stats.SymbolCount++;
+        stats.ByteSize += sizeof(m_UnaliasedCache) + sizeof(m_LocalSignatureOnceFlag) +
+                          sizeof(m_OptLocalSignatureCache) + sizeof(m_SignatureOnceFlag) +
+                          sizeof(m_OptSignatureCache);
+
+        const auto addString = [&](const std::optional<std::string>& optString) -> void
+        {
+            if (!optString.has_value())
+            {
+                return;
+            }
+
+            stats.CachedStringCount++;
+            stats.ByteSize += optString.value().capacity();
+        };
+
+        addString(m_OptLocalSignatureCache);
+        addString(m_OptSignatureCache);
+    }
+
     static auto CreateInstantiatedSymbol(
         const IGenericSymbol* const symbol, const InstantiationContext& context
     ) -> IGenericSymbol*
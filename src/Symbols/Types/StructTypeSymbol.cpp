@@ -181,7 +181,8 @@ namespace Ace
 
     auto StructTypeSymbol::CollectFields() const -> std::vector<FieldVarSymbol*>
     {
-        auto fields = m_BodyScope->CollectSymbols<FieldVarSymbol>();
+        const auto declaredFields = m_BodyScope->CollectSymbols<FieldVarSymbol>();
+        std::vector<FieldVarSymbol*> fields{ begin(declaredFields), end(declaredFields) };
         std::sort(
             begin(fields),
             end(fields),
@@ -83,19 +83,19 @@ namespace Ace
 
     auto TraitTypeSymbol::CollectPrototypes() const -> std::vector<PrototypeSymbol*>
     {
-        auto prototypes = GetPrototypeScope()->CollectSymbols<PrototypeSymbol>();
+        const auto declaredPrototypes = GetPrototypeScope()->CollectSymbols<PrototypeSymbol>();
 
         std::set<PrototypeSymbol*> prototypeSet{};
         std::for_each(
-            begin(prototypes),
-            end(prototypes),
+            begin(declaredPrototypes),
+            end(declaredPrototypes),
             [&](PrototypeSymbol* const prototype)
             {
                 prototypeSet.insert(dynamic_cast<PrototypeSymbol*>(prototype->GetRoot()));
             }
         );
 
-        prototypes = std::vector<PrototypeSymbol*>{ begin(prototypeSet), end(prototypeSet) };
+        std::vector<PrototypeSymbol*> prototypes{ begin(prototypeSet), end(prototypeSet) };
 
         std::sort(
             begin(prototypes),
@@ -15,7 +15,7 @@ namespace Ace
         : m_BodyScope{ scope->CreateChild() },
           m_Name{
               SrcLocation{ GetCompilation() },
-              std::string{ TokenKindToKeywordMap.at(TokenKind::VoidKeyword) },
+              std::string{ GetKeyword(TokenKind::VoidKeyword) },
           }
     {
     }
@@ -0,0 +1,61 @@
+#include "SyntaxArena.hpp"
+
+#include <memory>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#include "Assert.hpp"
+
+namespace Ace
+{
+    SyntaxArena::~SyntaxArena()
+    {
+        std::for_each(
+            m_Destructors.rbegin(),
+            m_Destructors.rend(),
+            [](const Destructor& destructor)
+            {
+                destructor.Destroy(destructor.Object);
+            }
+        );
+    }
+
+    auto SyntaxArena::Allocate(const size_t size, const size_t alignment) -> void*
+    {
+        ACE_ASSERT(alignment <= alignof(std::max_align_t));
+
+        const auto position = reinterpret_cast<uintptr_t>(m_Position);
+        const auto padding = (alignment - (position % alignment)) % alignment;
+
+        const bool isFitting =
+            m_Position && ((padding + size) <= static_cast<size_t>(m_End - m_Position));
+        if (!isFitting)
+        {
+            // Allocations larger than a quarter block get a block of their own, and the current
+            // block stays in use for the next small allocation.
+            if (size > (BlockSize / 4))
+            {
+                m_Blocks.push_back(std::unique_ptr<std::byte[]>(new std::byte[size]));
+                m_ByteSize += size;
+                return m_Blocks.back().get();
+            }
+
+            m_Blocks.push_back(std::unique_ptr<std::byte[]>(new std::byte[BlockSize]));
+            m_ByteSize += BlockSize;
+            m_Position = m_Blocks.back().get();
+            m_End = m_Position + BlockSize;
+
+            return Allocate(size, alignment);
+        }
+
+        auto* const allocation = m_Position + padding;
+        m_Position = allocation + size;
+        return allocation;
+    }
+
+    auto SyntaxArena::GetByteSize() const -> size_t
+    {
+        return m_ByteSize;
+    }
+}
@@ -11,7 +11,7 @@ namespace Ace
 {
     AttributeSyntax::AttributeSyntax(
         const SrcLocation& srcLocation,
-        const std::shared_ptr<const StructConstructionExprSyntax>& structConstructionExpr
+        const StructConstructionExprSyntax* const structConstructionExpr
     )
         : m_SrcLocation{ srcLocation },
           m_StructConstructionExpr{ structConstructionExpr }
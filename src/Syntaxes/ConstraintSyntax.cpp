@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <vector>
+#include <span>
 
 #include "SrcLocation.hpp"
 #include "Scope.hpp"
@@ -18,7 +19,7 @@ namespace Ace
         const SrcLocation& srcLocation,
         const std::shared_ptr<Scope>& scope,
         const SymbolName& typeName,
-        const std::vector<SymbolName>& traitNames
+        const std::span<const SymbolName> traitNames
     )
         : m_SrcLocation{ srcLocation },
           m_Scope{ scope },
@@ -11,7 +11,7 @@
 namespace Ace
 {
     AddressOfExprSyntax::AddressOfExprSyntax(
-        const SrcLocation& srcLocation, const std::shared_ptr<const IExprSyntax>& expr
+        const SrcLocation& srcLocation, const IExprSyntax* const expr
     )
         : m_Expr{ expr }
     {
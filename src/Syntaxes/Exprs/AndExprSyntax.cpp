@@ -12,8 +12,8 @@ namespace Ace
 {
     AndExprSyntax::AndExprSyntax(
         const SrcLocation& srcLocation,
-        const std::shared_ptr<const IExprSyntax>& lhsExpr,
-        const std::shared_ptr<const IExprSyntax>& rhsExpr
+        const IExprSyntax* const lhsExpr,
+        const IExprSyntax* const rhsExpr
     )
         : m_SrcLocation{ srcLocation },
           m_LHSExpr{ lhsExpr },
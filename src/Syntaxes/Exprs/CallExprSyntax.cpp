@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <vector>
+#include <span>
 
 #include "SrcLocation.hpp"
 #include "Scope.hpp"
@@ -20,8 +21,8 @@ namespace Ace
 {
     CallExprSyntax::CallExprSyntax(
         const SrcLocation& srcLocation,
-        const std::shared_ptr<const IExprSyntax>& expr,
-        const std::vector<std::shared_ptr<const IExprSyntax>>& args
+        const IExprSyntax* const expr,
+        const std::span<const IExprSyntax* const> args
     )
         : m_SrcLocation{ srcLocation },
           m_Expr{ expr },
@@ -53,7 +54,7 @@ namespace Ace
             begin(m_Args),
             end(m_Args),
             back_inserter(argSemas),
-            [&](const std::shared_ptr<const IExprSyntax>& arg)
+            [&](const IExprSyntax* const arg)
             {
                 return diagnostics.Collect(arg->CreateExprSema());
             }
@@ -71,7 +72,7 @@ namespace Ace
         );
 
         if (const auto* const symbolLiteralExpr =
-                dynamic_cast<const SymbolLiteralExprSyntax*>(m_Expr.get()))
+                dynamic_cast<const SymbolLiteralExprSyntax*>(m_Expr))
         {
             const auto optCallableSymbol =
                 diagnostics.Collect(GetScope()->ResolveStaticSymbol<ICallableSymbol>(
@@ -89,7 +90,7 @@ namespace Ace
         }
 
         if (const auto* const memberAccessExpr =
-                dynamic_cast<const MemberAccessExprSyntax*>(m_Expr.get()))
+                dynamic_cast<const MemberAccessExprSyntax*>(m_Expr))
         {
             const auto exprSema =
                 diagnostics.Collect(memberAccessExpr->GetExpr()->CreateExprSema());
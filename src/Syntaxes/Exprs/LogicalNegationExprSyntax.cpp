@@ -11,7 +11,7 @@
 namespace Ace
 {
     LogicalNegationExprSyntax::LogicalNegationExprSyntax(
-        const SrcLocation& srcLocation, const std::shared_ptr<const IExprSyntax>& expr
+        const SrcLocation& srcLocation, const IExprSyntax* const expr
     )
         : m_SrcLocation{ srcLocation },
           m_Expr{ expr }
@@ -15,7 +15,7 @@ namespace Ace
 {
     MemberAccessExprSyntax::MemberAccessExprSyntax(
         const SrcLocation& srcLocation,
-        const std::shared_ptr<const IExprSyntax>& expr,
+        const IExprSyntax* const expr,
         const SymbolNameSection& name
     )
         : m_SrcLocation{ srcLocation },
@@ -73,7 +73,7 @@ namespace Ace
 
     auto MemberAccessExprSyntax::GetExpr() const -> const IExprSyntax*
     {
-        return m_Expr.get();
+        return m_Expr;
     }
 
     auto MemberAccessExprSyntax::GetName() const -> const SymbolNameSection&
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <vector>
+#include <span>
 
 #include "SrcLocation.hpp"
 #include "Scope.hpp"
@@ -18,7 +19,7 @@ namespace Ace
         const SrcLocation& srcLocation,
         const std::shared_ptr<Scope>& scope,
         const SymbolName& typeName,
-        std::vector<StructConstructionExprArg>&& args
+        const std::span<const StructConstructionExprArg> args
     )
         : m_SrcLocation{ srcLocation },
           m_Scope{ scope },
@@ -67,10 +68,10 @@ namespace Ace
             SymbolNameResolutionScope::Local,
         };
 
-        return std::make_shared<const SymbolLiteralExprSyntax>(
-                   arg.Name.SrcLocation, scope, symbolName
-        )
-            ->CreateSema();
+        // The shorthand's symbol literal only lives for this call, so it is not put in the arena,
+        // which is only allocated from while parsing.
+        const SymbolLiteralExprSyntax symbolLiteral{ arg.Name.SrcLocation, scope, symbolName };
+        return symbolLiteral.CreateSema();
     }
 
     static auto
@@ -216,7 +217,7 @@ namespace Ace
         const SrcLocation& srcLocation,
         const std::shared_ptr<Scope>& scope,
         StructTypeSymbol* const structSymbol,
-        const std::vector<StructConstructionExprArg>& args
+        const std::span<const StructConstructionExprArg> args
     ) -> Diagnosed<std::vector<StructConstructionExprSemaArg>>
     {
         auto diagnostics = DiagnosticBag::Create();
@@ -12,7 +12,7 @@
 namespace Ace
 {
     UnboxExprSyntax::UnboxExprSyntax(
-        const SrcLocation& srcLocation, const std::shared_ptr<const IExprSyntax>& expr
+        const SrcLocation& srcLocation, const IExprSyntax* const expr
     )
         : m_SrcLocation{ srcLocation },
           m_Expr{ expr }
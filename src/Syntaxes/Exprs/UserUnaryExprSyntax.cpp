@@ -16,7 +16,7 @@ namespace Ace
 {
     UserUnaryExprSyntax::UserUnaryExprSyntax(
         const SrcLocation& srcLocation,
-        const std::shared_ptr<const IExprSyntax>& expr,
+        const IExprSyntax* const expr,
         const SrcLocation& opSrcLocation,
         const Op op
     )
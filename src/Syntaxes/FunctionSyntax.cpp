@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <vector>
+#include <span>
 #include <optional>
 
 #include "SrcLocation.hpp"
@@ -30,13 +31,13 @@ namespace Ace
         const AccessModifier accessModifier,
         const Ident& name,
         const TypeName& typeName,
-        const std::vector<std::shared_ptr<const AttributeSyntax>>& attributes,
-        const std::optional<std::shared_ptr<const ImplSelfSyntax>>& optSelf,
-        const std::optional<std::shared_ptr<const SelfParamVarSyntax>>& optSelfParam,
-        const std::vector<std::shared_ptr<const NormalParamVarSyntax>>& params,
-        const std::optional<std::shared_ptr<const BlockStmtSyntax>>& optBlock,
-        const std::vector<std::shared_ptr<const TypeParamSyntax>>& typeParams,
-        const std::vector<std::shared_ptr<const ConstraintSyntax>>& constraints
+        const std::span<const AttributeSyntax* const> attributes,
+        const std::optional<const ImplSelfSyntax*>& optSelf,
+        const std::optional<const SelfParamVarSyntax*>& optSelfParam,
+        const std::span<const NormalParamVarSyntax* const> params,
+        const std::optional<const BlockStmtSyntax*>& optBlock,
+        const std::span<const TypeParamSyntax* const> typeParams,
+        const std::span<const ConstraintSyntax* const> constraints
     )
         : m_SrcLocation{ srcLocation },
           m_BodyScope{ bodyScope },
@@ -115,7 +116,7 @@ namespace Ace
     }
 
     auto FunctionSyntax::GetBlock() const
-        -> const std::optional<std::shared_ptr<const BlockStmtSyntax>>&
+        -> const std::optional<const BlockStmtSyntax*>&
     {
         return m_OptBlock;
     }
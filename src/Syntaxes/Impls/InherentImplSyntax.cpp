@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <vector>
+#include <span>
 
 #include "SrcLocation.hpp"
 #include "Scope.hpp"
@@ -17,10 +18,10 @@ namespace Ace
     InherentImplSyntax::InherentImplSyntax(
         const SrcLocation& srcLocation,
         const std::shared_ptr<Scope>& bodyScope,
-        const std::vector<std::shared_ptr<const TypeParamSyntax>>& typeParams,
+        const std::span<const TypeParamSyntax* const> typeParams,
         const SymbolName& typeName,
-        const std::vector<std::shared_ptr<const ConstraintSyntax>>& constraints,
-        const std::vector<std::shared_ptr<const FunctionSyntax>>& functions
+        const std::span<const ConstraintSyntax* const> constraints,
+        const std::span<const FunctionSyntax* const> functions
     )
         : m_SrcLocation{ srcLocation },
           m_BodyScope{ bodyScope },
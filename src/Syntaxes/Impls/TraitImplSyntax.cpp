@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <vector>
+#include <span>
 
 #include "SrcLocation.hpp"
 #include "Scope.hpp"
@@ -19,12 +20,12 @@ namespace Ace
     TraitImplSyntax::TraitImplSyntax(
         const SrcLocation& srcLocation,
         const std::shared_ptr<Scope>& bodyScope,
-        const std::vector<std::shared_ptr<const TypeParamSyntax>>& typeParams,
+        const std::span<const TypeParamSyntax* const> typeParams,
         const SymbolName& traitName,
         const SymbolName& typeName,
-        const std::vector<std::shared_ptr<const ConstraintSyntax>>& constraints,
-        const std::shared_ptr<const ImplSelfSyntax>& self,
-        const std::vector<std::shared_ptr<const FunctionSyntax>>& functions
+        const std::span<const ConstraintSyntax* const> constraints,
+        const ImplSelfSyntax* const self,
+        const std::span<const FunctionSyntax* const> functions
     )
         : m_SrcLocation{ srcLocation },
           m_BodyScope{ bodyScope },
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <vector>
+#include <span>
 #include <string>
 
 #include "SrcLocation.hpp"
@@ -24,15 +25,15 @@ namespace Ace
         const SrcLocation& srcLocation,
         const std::shared_ptr<Scope>& scope,
         const std::shared_ptr<Scope>& bodyScope,
-        const std::vector<Ident>& name,
+        const std::span<const Ident> name,
         const AccessModifier accessModifier,
-        const std::vector<std::shared_ptr<const ModSyntax>>& mods,
-        const std::vector<std::shared_ptr<const ISyntax>>& types,
-        const std::vector<std::shared_ptr<const InherentImplSyntax>>& inherentImpls,
-        const std::vector<std::shared_ptr<const TraitImplSyntax>>& traitImpls,
-        const std::vector<std::shared_ptr<const FunctionSyntax>>& functions,
-        const std::vector<std::shared_ptr<const GlobalVarSyntax>>& globalVars,
-        const std::vector<std::shared_ptr<const UseSyntax>>& uses
+        const std::span<const ModSyntax* const> mods,
+        const std::span<const ISyntax* const> types,
+        const std::span<const InherentImplSyntax* const> inherentImpls,
+        const std::span<const TraitImplSyntax* const> traitImpls,
+        const std::span<const FunctionSyntax* const> functions,
+        const std::span<const GlobalVarSyntax* const> globalVars,
+        const std::span<const UseSyntax* const> uses
     )
         : m_SrcLocation{ srcLocation },
           m_Scope{ scope },
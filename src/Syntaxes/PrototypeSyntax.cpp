@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <vector>
+#include <span>
 #include <optional>
 
 #include "SrcLocation.hpp"
@@ -28,12 +29,12 @@ namespace Ace
         const SymbolName& parentTraitName,
         const Ident& name,
         const TypeName& typeName,
-        const std::vector<std::shared_ptr<const AttributeSyntax>>& attributes,
+        const std::span<const AttributeSyntax* const> attributes,
         const size_t index,
-        const std::optional<std::shared_ptr<const SelfParamVarSyntax>>& optSelfParam,
-        const std::vector<std::shared_ptr<const NormalParamVarSyntax>>& params,
-        const std::vector<std::shared_ptr<const TypeParamSyntax>>& typeParams,
-        const std::vector<std::shared_ptr<const ConstraintSyntax>>& constraints
+        const std::optional<const SelfParamVarSyntax*>& optSelfParam,
+        const std::span<const NormalParamVarSyntax* const> params,
+        const std::span<const TypeParamSyntax* const> typeParams,
+        const std::span<const ConstraintSyntax* const> constraints
     )
         : m_SrcLocation{ srcLocation },
           m_BodyScope{ bodyScope },
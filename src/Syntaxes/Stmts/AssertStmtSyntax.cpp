@@ -13,7 +13,7 @@ namespace Ace
     AssertStmtSyntax::AssertStmtSyntax(
         const SrcLocation& srcLocation,
         const std::shared_ptr<Scope>& scope,
-        const std::shared_ptr<const IExprSyntax>& condition
+        const IExprSyntax* const condition
     )
         : m_SrcLocation{ srcLocation },
           m_Scope{ scope },
@@ -14,8 +14,8 @@ namespace Ace
 {
     CompoundAssignmentStmtSyntax::CompoundAssignmentStmtSyntax(
         const SrcLocation& srcLocation,
-        const std::shared_ptr<const IExprSyntax>& lhsExpr,
-        const std::shared_ptr<const IExprSyntax>& rhsExpr,
+        const IExprSyntax* const lhsExpr,
+        const IExprSyntax* const rhsExpr,
         const SrcLocation& opSrcLocation,
         const Op op
     )
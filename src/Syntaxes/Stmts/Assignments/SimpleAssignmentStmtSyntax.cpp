@@ -13,8 +13,8 @@ namespace Ace
     SimpleAssignmentStmtSyntax::SimpleAssignmentStmtSyntax(
         const SrcLocation& srcLocation,
         const std::shared_ptr<Scope>& scope,
-        const std::shared_ptr<const IExprSyntax>& lhsExpr,
-        const std::shared_ptr<const IExprSyntax>& rhsExpr
+        const IExprSyntax* const lhsExpr,
+        const IExprSyntax* const rhsExpr
     )
         : m_SrcLocation{ srcLocation },
           m_Scope{ scope },
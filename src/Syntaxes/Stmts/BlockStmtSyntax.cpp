@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <vector>
+#include <span>
 
 #include "SrcLocation.hpp"
 #include "Scope.hpp"
@@ -14,7 +15,7 @@ namespace Ace
     BlockStmtSyntax::BlockStmtSyntax(
         const SrcLocation& srcLocation,
         const std::shared_ptr<Scope>& bodyScope,
-        const std::vector<std::shared_ptr<const IStmtSyntax>>& stmts
+        const std::span<const IStmtSyntax* const> stmts
     )
         : m_SrcLocation{ srcLocation },
           m_BodyScope{ bodyScope },
@@ -46,7 +47,7 @@ namespace Ace
             begin(m_Stmts),
             end(m_Stmts),
             back_inserter(stmtSemas),
-            [&](const std::shared_ptr<const IStmtSyntax>& stmt)
+            [&](const IStmtSyntax* const stmt)
             {
                 return diagnostics.Collect(stmt->CreateStmtSema());
             }
@@ -15,8 +15,8 @@ namespace Ace
     CopyStmtSyntax::CopyStmtSyntax(
         const SrcLocation& srcLocation,
         const TypeName& typeName,
-        const std::shared_ptr<const IExprSyntax>& srcExpr,
-        const std::shared_ptr<const IExprSyntax>& dstExpr
+        const IExprSyntax* const srcExpr,
+        const IExprSyntax* const dstExpr
     )
         : m_SrcLocation{ srcLocation },
           m_TypeName{ typeName },
@@ -15,7 +15,7 @@ namespace Ace
     DropStmtSyntax::DropStmtSyntax(
         const SrcLocation& srcLocation,
         const TypeName& typeName,
-        const std::shared_ptr<const IExprSyntax>& expr
+        const IExprSyntax* const expr
     )
         : m_SrcLocation{ srcLocation },
           m_TypeName{ typeName },
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <vector>
+#include <span>
 #include <optional>
 
 #include "SrcLocation.hpp"
@@ -16,8 +17,8 @@ namespace Ace
     IfStmtSyntax::IfStmtSyntax(
         const SrcLocation& srcLocation,
         const std::shared_ptr<Scope>& scope,
-        const std::vector<std::shared_ptr<const IExprSyntax>>& conditions,
-        const std::vector<std::shared_ptr<const BlockStmtSyntax>>& blocks
+        const std::span<const IExprSyntax* const> conditions,
+        const std::span<const BlockStmtSyntax* const> blocks
     )
         : m_SrcLocation{ srcLocation },
           m_Scope{ scope },
@@ -51,7 +52,7 @@ namespace Ace
             begin(m_Conditions),
             end(m_Conditions),
             back_inserter(conditionSemas),
-            [&](const std::shared_ptr<const IExprSyntax>& condition)
+            [&](const IExprSyntax* const condition)
             {
                 return diagnostics.Collect(condition->CreateExprSema());
             }
@@ -62,7 +63,7 @@ namespace Ace
             begin(m_Blocks),
             end(m_Blocks),
             back_inserter(blockSemas),
-            [&](const std::shared_ptr<const BlockStmtSyntax>& block)
+            [&](const BlockStmtSyntax* const block)
             {
                 return diagnostics.Collect(block->CreateSema());
             }
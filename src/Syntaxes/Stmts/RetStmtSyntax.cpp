@@ -15,7 +15,7 @@ namespace Ace
     RetStmtSyntax::RetStmtSyntax(
         const SrcLocation& srcLocation,
         const std::shared_ptr<Scope>& scope,
-        const std::optional<std::shared_ptr<const IExprSyntax>>& optExpr
+        const std::optional<const IExprSyntax*>& optExpr
     )
         : m_SrcLocation{ srcLocation },
           m_Scope{ scope },
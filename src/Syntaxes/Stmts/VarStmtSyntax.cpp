@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <vector>
+#include <span>
 
 #include "SrcLocation.hpp"
 #include "Scope.hpp"
@@ -20,8 +21,8 @@ namespace Ace
         const std::shared_ptr<Scope>& scope,
         const Ident& name,
         const TypeName& typeName,
-        const std::vector<std::shared_ptr<const AttributeSyntax>>& attributes,
-        const std::optional<std::shared_ptr<const IExprSyntax>>& optAssignedExpr
+        const std::span<const AttributeSyntax* const> attributes,
+        const std::optional<const IExprSyntax*>& optAssignedExpr
     )
         : m_SrcLocation{ srcLocation },
           m_Scope{ scope },
@@ -16,8 +16,8 @@ namespace Ace
     WhileStmtSyntax::WhileStmtSyntax(
         const SrcLocation& srcLocation,
         const std::shared_ptr<Scope>& scope,
-        const std::shared_ptr<const IExprSyntax>& condition,
-        const std::shared_ptr<const BlockStmtSyntax>& block
+        const IExprSyntax* const condition,
+        const BlockStmtSyntax* const block
     )
         : m_SrcLocation{ srcLocation },
           m_Scope{ scope },
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <vector>
+#include <span>
 
 #include "SrcLocation.hpp"
 #include "Scope.hpp"
@@ -20,9 +21,9 @@ namespace Ace
         const std::shared_ptr<Scope>& bodyScope,
         const AccessModifier accessModifier,
         const Ident& name,
-        const std::vector<std::shared_ptr<const AttributeSyntax>>& attributes,
-        const std::vector<std::shared_ptr<const FieldVarSyntax>>& fields,
-        const std::vector<std::shared_ptr<const TypeParamSyntax>>& typeParams
+        const std::span<const AttributeSyntax* const> attributes,
+        const std::span<const FieldVarSyntax* const> fields,
+        const std::span<const TypeParamSyntax* const> typeParams
     )
         : m_SrcLocation{ srcLocation },
           m_BodyScope{ bodyScope },
@@ -4,10 +4,12 @@
 #include <string>
 #include <unordered_map>
 #include <vector>
+#include <span>
 
 #include "Compilation.hpp"
 #include "Diagnostics/BindingDiagnostics.hpp"
 #include "Scope.hpp"
+#include "InternedString.hpp"
 #include "Syntaxes/TypeParamSyntax.hpp"
 #include "Symbols/Types/TypeSymbol.hpp"
 #include "Symbols/Types/TypeParamTypeSymbol.hpp"
@@ -26,22 +28,22 @@ namespace Ace
 
     auto ResolveTypeParamSymbols(
         const std::shared_ptr<Scope>& scope,
-        const std::vector<std::shared_ptr<const TypeParamSyntax>>& typeParams
+        const std::span<const TypeParamSyntax* const> typeParams
     ) -> Diagnosed<std::vector<ITypeSymbol*>>
     {
         auto diagnostics = DiagnosticBag::Create();
 
         std::vector<ITypeSymbol*> symbols{};
-        std::unordered_map<std::string, const TypeParamSyntax*> firstTypeParams{};
-        std::unordered_map<std::string, ITypeSymbol*> firstTypeParamSymbols{};
+        std::unordered_map<InternedString, const TypeParamSyntax*> firstTypeParams{};
+        std::unordered_map<InternedString, ITypeSymbol*> firstTypeParamSymbols{};
         std::for_each(
             begin(typeParams),
             end(typeParams),
-            [&](const std::shared_ptr<const TypeParamSyntax>& typeParam)
+            [&](const TypeParamSyntax* const typeParam)
             {
                 const auto& name = typeParam->GetName();
 
-                const auto [it, inserted] = firstTypeParams.emplace(name.String, typeParam.get());
+                const auto [it, inserted] = firstTypeParams.emplace(name.String, typeParam);
                 if (!inserted)
                 {
                     diagnostics.Add(CreateTypeParamRedeclarationError(
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <vector>
+#include <span>
 
 #include "SrcLocation.hpp"
 #include "Scope.hpp"
@@ -22,12 +23,12 @@ namespace Ace
         const std::shared_ptr<Scope>& prototypeScope,
         const AccessModifier accessModifier,
         const Ident& name,
-        const std::vector<std::shared_ptr<const AttributeSyntax>>& attributes,
-        const std::shared_ptr<const TraitSelfSyntax>& self,
-        const std::vector<std::shared_ptr<const PrototypeSyntax>>& prototypes,
-        const std::vector<std::shared_ptr<const TypeParamSyntax>>& typeParams,
-        const std::vector<std::shared_ptr<const TypeReimportSyntax>>& typeParamReimports,
-        const std::vector<std::shared_ptr<const SupertraitSyntax>>& supertraits
+        const std::span<const AttributeSyntax* const> attributes,
+        const TraitSelfSyntax* const self,
+        const std::span<const PrototypeSyntax* const> prototypes,
+        const std::span<const TypeParamSyntax* const> typeParams,
+        const std::span<const TypeReimportSyntax* const> typeParamReimports,
+        const std::span<const SupertraitSyntax* const> supertraits
     )
         : m_SrcLocation{ srcLocation },
           m_BodyScope{ bodyScope },
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <vector>
+#include <span>
 
 #include "SrcLocation.hpp"
 #include "Scope.hpp"
@@ -22,7 +23,7 @@ namespace Ace
         const SymbolName& parentStructName,
         const Ident& name,
         const TypeName& typeName,
-        const std::vector<std::shared_ptr<const AttributeSyntax>>& attributes,
+        const std::span<const AttributeSyntax* const> attributes,
         const size_t index
     )
         : m_SrcLocation{ srcLocation },
@@ -0,0 +1,268 @@
+#include "TimeTrace.hpp"
+
+#include <vector>
+#include <string>
+#include <optional>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <functional>
+#include <nlohmann/json.hpp>
+#include <termcolor/termcolor.hpp>
+
+#include "Log.hpp"
+#include "Diagnostic.hpp"
+#include "Diagnostics/FileSystemDiagnostics.hpp"
+
+namespace Ace
+{
+    static thread_local size_t PhaseDepth = 0;
+
+    TimeTracer::TimeTracer(
+        const bool isSummaryEnabled,
+        const std::optional<std::filesystem::path>& optTraceFilePath
+    ) : m_IsSummaryEnabled{ isSummaryEnabled },
+        m_OptTraceFilePath{ optTraceFilePath }
+    {
+    }
+
+    auto TimeTracer::IsEnabled() const -> bool
+    {
+        return m_IsSummaryEnabled || m_OptTraceFilePath.has_value();
+    }
+
+    auto TimeTracer::IsSummaryEnabled() const -> bool
+    {
+        return m_IsSummaryEnabled;
+    }
+
+    auto TimeTracer::IsTracingFunctions() const -> bool
+    {
+        return m_OptTraceFilePath.has_value();
+    }
+
+    auto TimeTracer::Record(TimeTraceEvent event) -> void
+    {
+        std::lock_guard lock{ m_Mutex };
+
+        event.ThreadIndex = GetThreadIndex();
+        m_Events.push_back(std::move(event));
+    }
+
+    static auto ToMilliseconds(const std::chrono::steady_clock::duration duration) -> double
+    {
+        return std::chrono::duration<double, std::milli>{ duration }.count();
+    }
+
+    static auto ToMicroseconds(const std::chrono::steady_clock::duration duration) -> int64_t
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+    }
+
+    struct PhaseTotal
+    {
+        std::string Name{};
+        size_t Depth{};
+        std::chrono::steady_clock::duration Duration{};
+    };
+
+    auto TimeTracer::PrintSummary(const size_t indentLevel) const -> void
+    {
+        if (!m_IsSummaryEnabled)
+        {
+            return;
+        }
+
+        std::lock_guard lock{ m_Mutex };
+
+        // Phases that run more than once are summed into their first occurrence, so the table
+        // keeps pipeline order.
+        std::vector<PhaseTotal> phaseTotals{};
+        std::chrono::steady_clock::duration totalDuration{};
+        std::for_each(
+            begin(m_Events),
+            end(m_Events),
+            [&](const TimeTraceEvent& event)
+            {
+                if (event.Kind != TimeTraceEventKind::Phase)
+                {
+                    return;
+                }
+
+                if (event.Depth == 0)
+                {
+                    totalDuration += event.Duration;
+                }
+
+                const auto matchingTotalIt = std::find_if(
+                    begin(phaseTotals),
+                    end(phaseTotals),
+                    [&](const PhaseTotal& phaseTotal)
+                    {
+                        return (phaseTotal.Name == event.Name) &&
+                               (phaseTotal.Depth == event.Depth);
+                    }
+                );
+                if (matchingTotalIt != end(phaseTotals))
+                {
+                    matchingTotalIt->Duration += event.Duration;
+                    return;
+                }
+
+                phaseTotals.push_back(PhaseTotal{ event.Name, event.Depth, event.Duration });
+            }
+        );
+
+        const std::string indent(indentLevel, ' ');
+
+        Out << indent << termcolor::bright_green << "Timing";
+        Out << termcolor::reset << " summary\n";
+
+        std::for_each(
+            begin(phaseTotals),
+            end(phaseTotals),
+            [&](const PhaseTotal& phaseTotal)
+            {
+                const auto name = std::string((phaseTotal.Depth + 1) * 2, ' ') + phaseTotal.Name;
+
+                const auto totalMilliseconds = ToMilliseconds(totalDuration);
+                const auto percentage = (totalMilliseconds == 0.0) ? 0.0 :
+                    (ToMilliseconds(phaseTotal.Duration) / totalMilliseconds * 100.0);
+
+                std::ostringstream lineStream{};
+                lineStream << std::left << std::setw(48) << name;
+                lineStream << std::right << std::fixed << std::setprecision(3);
+                lineStream << std::setw(12) << ToMilliseconds(phaseTotal.Duration) << " ms";
+                lineStream << std::setprecision(1) << std::setw(8) << percentage << "%";
+
+                Out << indent << lineStream.str() << "\n";
+            }
+        );
+
+        std::ostringstream totalStream{};
+        totalStream << std::left << std::setw(48) << "  Total";
+        totalStream << std::right << std::fixed << std::setprecision(3);
+        totalStream << std::setw(12) << ToMilliseconds(totalDuration) << " ms";
+
+        Out << indent << totalStream.str() << "\n";
+    }
+
+    auto TimeTracer::WriteTraceFile() const -> Expected<void>
+    {
+        auto diagnostics = DiagnosticBag::Create();
+
+        if (!m_OptTraceFilePath.has_value())
+        {
+            return Void{ std::move(diagnostics) };
+        }
+
+        std::lock_guard lock{ m_Mutex };
+
+        auto traceEvents = nlohmann::json::array();
+        std::for_each(
+            begin(m_Events),
+            end(m_Events),
+            [&](const TimeTraceEvent& event)
+            {
+                auto traceEvent = nlohmann::json::object();
+                traceEvent["name"] = event.Name;
+                traceEvent["cat"] =
+                    (event.Kind == TimeTraceEventKind::Phase) ? "phase" : "function";
+                traceEvent["ph"] = "X";
+                traceEvent["ts"] = ToMicroseconds(event.BeginTime - m_BeginTime);
+                traceEvent["dur"] = ToMicroseconds(event.Duration);
+                traceEvent["pid"] = static_cast<int64_t>(1);
+                traceEvent["tid"] = static_cast<uint64_t>(event.ThreadIndex);
+
+                if (!event.Detail.empty())
+                {
+                    traceEvent["args"]["detail"] = event.Detail;
+                }
+
+                traceEvents.push_back(std::move(traceEvent));
+            }
+        );
+
+        auto trace = nlohmann::json::object();
+        trace["traceEvents"] = std::move(traceEvents);
+        trace["displayTimeUnit"] = "ms";
+
+        std::ofstream fileStream{ m_OptTraceFilePath.value() };
+        if (!fileStream)
+        {
+            diagnostics.Add(CreateFileOpenError(m_OptTraceFilePath.value()));
+            return std::move(diagnostics);
+        }
+
+        fileStream << trace.dump();
+
+        return Void{ std::move(diagnostics) };
+    }
+
+    auto TimeTracer::GetThreadIndex() -> size_t
+    {
+        const auto threadID = std::this_thread::get_id();
+
+        const auto matchingThreadIDIt = std::find(begin(m_ThreadIDs), end(m_ThreadIDs), threadID);
+        if (matchingThreadIDIt != end(m_ThreadIDs))
+        {
+            return std::distance(begin(m_ThreadIDs), matchingThreadIDIt);
+        }
+
+        m_ThreadIDs.push_back(threadID);
+        return m_ThreadIDs.size() - 1;
+    }
+
+    TimeScope::TimeScope(TimeTracer* const tracer, std::string name)
+        : m_Tracer{ (tracer && tracer->IsEnabled()) ? tracer : nullptr }
+    {
+        if (!m_Tracer)
+        {
+            return;
+        }
+
+        m_Event.Kind = TimeTraceEventKind::Phase;
+        m_Event.Name = std::move(name);
+        m_Event.Depth = PhaseDepth++;
+        m_Event.BeginTime = std::chrono::steady_clock::now();
+    }
+
+    TimeScope::TimeScope(
+        TimeTracer* const tracer,
+        std::string name,
+        const std::function<std::string()>& createDetail
+    ) : m_Tracer{ (tracer && tracer->IsTracingFunctions()) ? tracer : nullptr }
+    {
+        if (!m_Tracer)
+        {
+            return;
+        }
+
+        m_Event.Kind = TimeTraceEventKind::Function;
+        m_Event.Name = std::move(name);
+        m_Event.Detail = createDetail();
+        m_Event.Depth = PhaseDepth;
+        m_Event.BeginTime = std::chrono::steady_clock::now();
+    }
+
+    TimeScope::~TimeScope()
+    {
+        if (!m_Tracer)
+        {
+            return;
+        }
+
+        m_Event.Duration = std::chrono::steady_clock::now() - m_Event.BeginTime;
+
+        if (m_Event.Kind == TimeTraceEventKind::Phase)
+        {
+            PhaseDepth--;
+        }
+
+        m_Tracer->Record(std::move(m_Event));
+    }
+}
@@ -1,15 +1,66 @@
 #include "Token.hpp"
 
 #include <string_view>
+#include <iterator>
+
+#include "SrcBuffer.hpp"
+#include "SrcLocation.hpp"
 
 namespace Ace
 {
+    auto Token::Create(
+        const SrcLocation& srcLocation,
+        const TokenKind kind,
+        const size_t stringLength
+    ) -> Token
+    {
+        const std::string_view buffer{ srcLocation.Buffer->GetBuffer() };
+
+        return Token{
+            kind,
+            static_cast<uint32_t>(
+                std::distance(begin(buffer), srcLocation.CharacterBeginIterator)
+            ),
+            static_cast<uint32_t>(std::distance(
+                srcLocation.CharacterBeginIterator, srcLocation.CharacterEndIterator
+            )),
+            static_cast<uint32_t>(stringLength),
+        };
+    }
+
+    auto Token::CreateSrcLocation(const ISrcBuffer* const buffer) const -> SrcLocation
+    {
+        const auto characterBeginIt =
+            begin(std::string_view{ buffer->GetBuffer() }) + CharacterBeginIndex;
+
+        return {
+            buffer,
+            characterBeginIt,
+            characterBeginIt + CharacterLength,
+        };
+    }
+
+    auto Token::GetString(const ISrcBuffer* const buffer) const -> std::string_view
+    {
+        // String literal contents start after the opening quote.
+        const uint32_t stringOffset = (Kind == TokenKind::String) ? 1 : 0;
+
+        return std::string_view{ buffer->GetBuffer() }.substr(
+            CharacterBeginIndex + stringOffset, StringLength
+        );
+    }
+
     auto operator==(const Token& token, const TokenKind kind) -> bool
     {
         return token.Kind == kind;
     }
 
-    auto operator==(const Token& token, const std::string_view string) -> bool
+    auto operator==(const TokenView& token, const TokenKind kind) -> bool
+    {
+        return token.Kind == kind;
+    }
+
+    auto operator==(const TokenView& token, const std::string_view string) -> bool
     {
         if (token.Kind != TokenKind::Ident)
         {
@@ -0,0 +1,209 @@
+#include "TokenCursor.hpp"
+
+#include <span>
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+
+#include "Assert.hpp"
+#include "Token.hpp"
+#include "TokenKind.hpp"
+#include "Lexer.hpp"
+#include "Diagnostic.hpp"
+#include "FileBuffer.hpp"
+#include "TokenQueue.hpp"
+
+namespace Ace
+{
+    TokenCursor::TokenCursor(const FileBuffer* const fileBuffer)
+        : m_FileBuffer{ fileBuffer },
+          m_OptStream{ TokenStream{ fileBuffer } }
+    {
+    }
+
+    TokenCursor::TokenCursor(
+        const FileBuffer* const fileBuffer,
+        const std::span<const Token> tokens
+    ) : m_FileBuffer{ fileBuffer },
+        m_Tokens{ tokens }
+    {
+        ACE_ASSERT(!m_Tokens.empty());
+        ACE_ASSERT(m_Tokens.back().Kind == TokenKind::EndOfFile);
+    }
+
+    TokenCursor::TokenCursor(TokenQueue* const queue)
+        : m_FileBuffer{ queue->GetFileBuffer() },
+          m_Queue{ queue }
+    {
+    }
+
+    auto TokenCursor::GetFileBuffer() const -> const FileBuffer*
+    {
+        return m_FileBuffer;
+    }
+
+    auto TokenCursor::IsEnd() const -> bool
+    {
+        return Peek().Kind == TokenKind::EndOfFile;
+    }
+
+    auto TokenCursor::Peek(const size_t distance) const -> const Token&
+    {
+        ACE_ASSERT(distance < MaxCapacity);
+
+        if (distance >= m_Buffer.size())
+        {
+            Grow(distance + 1);
+        }
+
+        if (m_Count <= distance)
+        {
+            Refill();
+        }
+
+        return m_Buffer[(m_BeginIndex + distance) % m_Buffer.size()];
+    }
+
+    auto TokenCursor::PeekKind(const size_t distance) const -> TokenKind
+    {
+        if (distance < MaxCapacity)
+        {
+            return Peek(distance).Kind;
+        }
+
+        const auto& lastToken = Peek(MaxCapacity - 1);
+        if (lastToken.Kind == TokenKind::EndOfFile)
+        {
+            return TokenKind::EndOfFile;
+        }
+
+        const auto tokenIndex = m_EatenCount + distance;
+        if (!m_OptStream.has_value() && !m_Queue)
+        {
+            return m_Tokens[std::min(tokenIndex, m_Tokens.size() - 1)].Kind;
+        }
+
+        // A scan that starts over behind the last scanned token lexes again from the end of the
+        // buffer, which the buffer's last token marks.
+        if (!m_OptScanStream.has_value() || (tokenIndex < m_ScanIndex))
+        {
+            m_OptScanStream = TokenStream{
+                m_FileBuffer,
+                lastToken.CharacterBeginIndex + lastToken.CharacterLength,
+            };
+            m_ScanIndex = m_EatenCount + MaxCapacity - 1;
+            m_ScanToken = lastToken;
+        }
+
+        return ScanTo(tokenIndex);
+    }
+
+    auto TokenCursor::Eat() -> Token
+    {
+        const auto token = Peek();
+
+        m_BeginIndex = (m_BeginIndex + 1) % m_Buffer.size();
+        m_Count--;
+        m_EatenCount++;
+
+        return token;
+    }
+
+    auto TokenCursor::TakeDiagnostics() -> DiagnosticBag
+    {
+        while (!m_IsEndRead)
+        {
+            ReadNext();
+        }
+
+        if (m_Queue)
+        {
+            m_Diagnostics.Add(m_Queue->TakeDiagnostics());
+        }
+
+        auto diagnostics = std::move(m_Diagnostics);
+        m_Diagnostics = DiagnosticBag::Create();
+        return diagnostics;
+    }
+
+    auto TokenCursor::GetCapacity() const -> size_t
+    {
+        return m_Buffer.size();
+    }
+
+    auto TokenCursor::Grow(const size_t minCapacity) const -> void
+    {
+        auto capacity = m_Buffer.size();
+        while (capacity < minCapacity)
+        {
+            capacity *= 2;
+        }
+
+        // The buffered tokens are moved to the front, so the ring starts over at index 0.
+        std::vector<Token> buffer(capacity);
+        for (size_t i = 0; i < m_Count; i++)
+        {
+            buffer[i] = m_Buffer[(m_BeginIndex + i) % m_Buffer.size()];
+        }
+
+        m_Buffer = std::move(buffer);
+        m_BeginIndex = 0;
+    }
+
+    auto TokenCursor::Refill() const -> void
+    {
+        while (m_Count < m_Buffer.size())
+        {
+            m_Buffer[(m_BeginIndex + m_Count) % m_Buffer.size()] = ReadNext();
+            m_Count++;
+        }
+    }
+
+    auto TokenCursor::ScanTo(const size_t tokenIndex) const -> TokenKind
+    {
+        // Lexing diagnostics of scanned tokens are reported when the cursor reads them.
+        while ((m_ScanIndex < tokenIndex) && (m_ScanToken.Kind != TokenKind::EndOfFile))
+        {
+            m_ScanToken = m_OptScanStream->LexNext().Unwrap();
+            m_ScanIndex++;
+        }
+
+        return m_ScanToken.Kind;
+    }
+
+    auto TokenCursor::ReadNext() const -> Token
+    {
+        const auto token = [&]() -> Token
+        {
+            if (m_OptStream.has_value())
+            {
+                return m_Diagnostics.Collect(m_OptStream->LexNext());
+            }
+
+            // Queued chunks are read like a pre-lexed range, one chunk at a time.
+            if (m_Queue)
+            {
+                if ((m_TokenIndex == m_QueueChunk.size()) && !m_IsEndRead)
+                {
+                    m_QueueChunk = m_Queue->TakeChunk();
+                    m_TokenIndex = 0;
+                }
+
+                const auto index = std::min(m_TokenIndex, m_QueueChunk.size() - 1);
+                m_TokenIndex++;
+                return m_QueueChunk[index];
+            }
+
+            const auto index = std::min(m_TokenIndex, m_Tokens.size() - 1);
+            m_TokenIndex++;
+            return m_Tokens[index];
+        }();
+
+        if (token.Kind == TokenKind::EndOfFile)
+        {
+            m_IsEndRead = true;
+        }
+
+        return token;
+    }
+}
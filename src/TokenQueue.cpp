@@ -0,0 +1,104 @@
+#include "TokenQueue.hpp"
+
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+
+#include "Token.hpp"
+#include "TokenKind.hpp"
+#include "Lexer.hpp"
+#include "Diagnostic.hpp"
+#include "FileBuffer.hpp"
+
+namespace Ace
+{
+    TokenQueue::TokenQueue(const FileBuffer* const fileBuffer)
+        : m_FileBuffer{ fileBuffer }
+    {
+    }
+
+    auto TokenQueue::GetFileBuffer() const -> const FileBuffer*
+    {
+        return m_FileBuffer;
+    }
+
+    auto TokenQueue::Fill() -> void
+    {
+        auto diagnostics = DiagnosticBag::Create();
+
+        TokenStream stream{ m_FileBuffer };
+
+        std::vector<Token> chunk{};
+        chunk.reserve(ChunkSize);
+        while (true)
+        {
+            chunk.push_back(diagnostics.Collect(stream.LexNext()));
+            if (chunk.back().Kind == TokenKind::EndOfFile)
+            {
+                break;
+            }
+
+            if (chunk.size() == ChunkSize)
+            {
+                AddChunk(std::move(chunk));
+                chunk = {};
+                chunk.reserve(ChunkSize);
+            }
+        }
+
+        {
+            std::lock_guard lock{ m_Mutex };
+            m_Diagnostics = std::move(diagnostics);
+        }
+
+        AddChunk(std::move(chunk));
+
+        {
+            std::lock_guard lock{ m_Mutex };
+            m_IsFilled = true;
+        }
+
+        m_ChunkAddedCondition.notify_all();
+    }
+
+    auto TokenQueue::AddChunk(std::vector<Token> chunk) -> void
+    {
+        {
+            std::unique_lock lock{ m_Mutex };
+            m_ChunkTakenCondition.wait(
+                lock,
+                [&]() { return m_Chunks.size() < MaxChunkCount; }
+            );
+
+            m_Chunks.push_back(std::move(chunk));
+        }
+
+        m_ChunkAddedCondition.notify_all();
+    }
+
+    auto TokenQueue::TakeChunk() -> std::vector<Token>
+    {
+        std::vector<Token> chunk{};
+
+        {
+            std::unique_lock lock{ m_Mutex };
+            m_ChunkAddedCondition.wait(lock, [&]() { return !m_Chunks.empty(); });
+
+            chunk = std::move(m_Chunks.front());
+            m_Chunks.pop_front();
+        }
+
+        m_ChunkTakenCondition.notify_all();
+        return chunk;
+    }
+
+    auto TokenQueue::TakeDiagnostics() -> DiagnosticBag
+    {
+        std::unique_lock lock{ m_Mutex };
+        m_ChunkAddedCondition.wait(lock, [&]() { return m_IsFilled; });
+
+        auto diagnostics = std::move(m_Diagnostics);
+        m_Diagnostics = DiagnosticBag::Create();
+        return diagnostics;
+    }
+}
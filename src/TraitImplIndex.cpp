@@ -0,0 +1,82 @@
+#include "TraitImplIndex.hpp"
+
+#include <vector>
+#include <map>
+#include <utility>
+#include <algorithm>
+
+#include "Assert.hpp"
+#include "Symbols/Impls/TraitImplSymbol.hpp"
+#include "Symbols/Types/TypeSymbol.hpp"
+#include "Symbols/Types/TraitTypeSymbol.hpp"
+#include "Symbols/Types/TypeParamTypeSymbol.hpp"
+
+namespace Ace
+{
+    static auto IsPlaceholderImpl(TraitImplSymbol* const impl) -> bool
+    {
+        return dynamic_cast<TypeParamTypeSymbol*>(impl->GetType()->GetUnaliasedType()) != nullptr;
+    }
+
+    auto TraitImplIndex::Add(TraitImplSymbol* const impl) -> void
+    {
+        CollectBucket(impl).push_back(impl);
+    }
+
+    auto TraitImplIndex::Remove(TraitImplSymbol* const impl) -> void
+    {
+        auto& impls = CollectBucket(impl);
+
+        const auto matchingImplIt = std::find(begin(impls), end(impls), impl);
+        ACE_ASSERT(matchingImplIt != end(impls));
+        impls.erase(matchingImplIt);
+    }
+
+    auto TraitImplIndex::Clear() -> void
+    {
+        m_TraitAndTypeRootToImplsMap.clear();
+        m_TraitRootToPlaceholderImplsMap.clear();
+    }
+
+    auto TraitImplIndex::CollectCandidates(
+        TraitTypeSymbol* const trait,
+        ITypeSymbol* const type
+    ) const -> std::vector<TraitImplSymbol*>
+    {
+        auto* const traitRoot = trait->GetRoot();
+
+        std::vector<TraitImplSymbol*> impls{};
+
+        const auto traitAndTypeImplsIt =
+            m_TraitAndTypeRootToImplsMap.find({ traitRoot, type->GetRoot() });
+        if (traitAndTypeImplsIt != end(m_TraitAndTypeRootToImplsMap))
+        {
+            impls.insert(
+                end(impls), begin(traitAndTypeImplsIt->second), end(traitAndTypeImplsIt->second)
+            );
+        }
+
+        const auto placeholderImplsIt = m_TraitRootToPlaceholderImplsMap.find(traitRoot);
+        if (placeholderImplsIt != end(m_TraitRootToPlaceholderImplsMap))
+        {
+            impls.insert(
+                end(impls), begin(placeholderImplsIt->second), end(placeholderImplsIt->second)
+            );
+        }
+
+        return impls;
+    }
+
+    auto TraitImplIndex::CollectBucket(TraitImplSymbol* const impl)
+        -> std::vector<TraitImplSymbol*>&
+    {
+        auto* const traitRoot = impl->GetTrait()->GetRoot();
+
+        if (IsPlaceholderImpl(impl))
+        {
+            return m_TraitRootToPlaceholderImplsMap[traitRoot];
+        }
+
+        return m_TraitAndTypeRootToImplsMap[{ traitRoot, impl->GetType()->GetRoot() }];
+    }
+}
@@ -0,0 +1,124 @@
+#include <memory>
+#include <vector>
+#include <string>
+#include <optional>
+#include <thread>
+
+#include "Assert.hpp"
+#include "Diagnostic.hpp"
+#include "Scope.hpp"
+#include "Symbols/All.hpp"
+#include "AnonymousIdent.hpp"
+#include "BindingSpeculation.hpp"
+
+namespace
+{
+    template <typename TSymbol> auto Declare(std::unique_ptr<TSymbol> symbol) -> TSymbol*
+    {
+        return Ace::DiagnosticBag::CreateNoError().Collect(
+            Ace::Scope::DeclareSymbol(std::move(symbol))
+        );
+    }
+
+    auto Name(const char* const name) -> Ace::Ident
+    {
+        return Ace::Ident{ {}, name };
+    }
+
+    template <typename TFunction>
+    auto TryAbort(TFunction&& function) -> std::optional<Ace::SpeculationAbort>
+    {
+        try
+        {
+            function();
+        }
+        catch (const Ace::SpeculationAbort& abort)
+        {
+            return abort;
+        }
+
+        return std::nullopt;
+    }
+}
+
+auto main() -> int
+{
+    using namespace Ace;
+
+    GlobalScope globalScopeOwner{ nullptr };
+    const auto globalScope = globalScopeOwner.Unwrap();
+
+    const auto instantiate = []()
+    {
+        BindingSpeculation::OnInstantiate(SrcLocation{}, nullptr, InstantiationContext{});
+    };
+
+    const auto body = globalScope->CreateChild();
+    const auto block = body->CreateChild();
+    auto ownedBodyTypeParam = std::make_unique<TypeParamTypeSymbol>(body, Name("T"), 0);
+
+    {
+        BindingSpeculation speculation{ body };
+
+        // Symbols and scopes below the body scope belong to the binding.
+        auto* const label = Declare(std::make_unique<TypeParamTypeSymbol>(block, Name("L"), 0));
+        const auto nestedBlock = block->CreateChild();
+        Declare(std::make_unique<TypeParamTypeSymbol>(nestedBlock, Name("M"), 0));
+        ACE_ASSERT(block->CollectAllSymbols() == std::vector<ISymbol*>{ label });
+
+        // Callers read parameters from the body scope itself, and other scopes are shared.
+        const auto bodyAbort = TryAbort([&]() { Declare(std::move(ownedBodyTypeParam)); });
+        ACE_ASSERT(bodyAbort.has_value());
+        ACE_ASSERT(!bodyAbort.value().OptInstantiationRequest.has_value());
+        ACE_ASSERT(!body->HasSymbolWithName(InternedString{ "T" }));
+
+        ACE_ASSERT(TryAbort([&]() { globalScope->CreateChild(); }).has_value());
+        ACE_ASSERT(TryAbort([&]() { body->CreateChild(); }).has_value());
+
+        // Instantiation is requested from the main thread instead.
+        const auto instantiateAbort = TryAbort(instantiate);
+        ACE_ASSERT(instantiateAbort.has_value());
+        ACE_ASSERT(instantiateAbort.value().OptInstantiationRequest.has_value());
+
+        // Rolling back removes the declared symbols, so a retry can declare them again.
+        speculation.Rollback();
+        ACE_ASSERT(block->CollectAllSymbols().empty());
+        ACE_ASSERT(!block->HasSymbolWithName(InternedString{ "L" }));
+        ACE_ASSERT(nestedBlock->CollectAllSymbols().empty());
+        Declare(std::make_unique<TypeParamTypeSymbol>(block, Name("L"), 0));
+    }
+
+    // Without a speculation nothing aborts.
+    ACE_ASSERT(!TryAbort([&]() { globalScope->CreateChild(); }).has_value());
+    ACE_ASSERT(!TryAbort(instantiate).has_value());
+
+    // Identifiers in a prefix scope are numbered per prefix, whichever thread creates them, and
+    // a scope without a prefix restores the process-wide counter.
+    AnonymousIdent::ResetCounter();
+    {
+        const AnonymousIdent::PrefixScope prefixScope{ "?7" };
+        ACE_ASSERT(AnonymousIdent::Create() == "?7_0");
+        ACE_ASSERT(AnonymousIdent::Create("begin") == "?7_1_begin");
+
+        {
+            const AnonymousIdent::PrefixScope processWideScope{ std::nullopt };
+            ACE_ASSERT(AnonymousIdent::Create() == "?0");
+        }
+
+        std::string otherThreadIdent{};
+        std::thread thread{
+            [&]()
+            {
+                const AnonymousIdent::PrefixScope otherPrefixScope{ "?8" };
+                otherThreadIdent = AnonymousIdent::Create();
+            },
+        };
+        thread.join();
+        ACE_ASSERT(otherThreadIdent == "?8_0");
+
+        ACE_ASSERT(AnonymousIdent::Create() == "?7_2");
+    }
+    ACE_ASSERT(AnonymousIdent::Create() == "?1");
+
+    return 0;
+}
@@ -0,0 +1,281 @@
+#include <vector>
+#include <string>
+#include <string_view>
+#include <filesystem>
+#include <thread>
+#include <sstream>
+#include <optional>
+#include <utility>
+#include <chrono>
+#include <iterator>
+#include <fstream>
+#include <iostream>
+#include <cstring>
+#include <cstdint>
+#include <cstdlib>
+#include <csignal>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "Assert.hpp"
+#include "CompileServer.hpp"
+
+static auto CreateSocketAddress(const std::filesystem::path& socketPath) -> sockaddr_un
+{
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    std::strcpy(address.sun_path, socketPath.c_str());
+    return address;
+}
+
+// Sends a request that claims more strings than the server accepts and returns whether the
+// server closed the connection instead of waiting for them.
+static auto IsOversizedRequestDropped(const std::filesystem::path& socketPath) -> bool
+{
+    const auto address = CreateSocketAddress(socketPath);
+    const auto clientSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (connect(clientSocket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == -1)
+    {
+        close(clientSocket);
+        return false;
+    }
+
+    const int fileDescriptors[]{ STDOUT_FILENO, STDERR_FILENO };
+    char payload{};
+    iovec payloadVector{ &payload, sizeof(payload) };
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(fileDescriptors))]{};
+
+    msghdr message{};
+    message.msg_iov = &payloadVector;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+
+    auto* const controlMessage = CMSG_FIRSTHDR(&message);
+    controlMessage->cmsg_level = SOL_SOCKET;
+    controlMessage->cmsg_type = SCM_RIGHTS;
+    controlMessage->cmsg_len = CMSG_LEN(sizeof(fileDescriptors));
+    std::memcpy(CMSG_DATA(controlMessage), fileDescriptors, sizeof(fileDescriptors));
+
+    const uint32_t count = UINT32_MAX;
+    const bool didSend = (sendmsg(clientSocket, &message, 0) == sizeof(payload)) &&
+        (send(clientSocket, &count, sizeof(count), 0) == sizeof(count));
+
+    char response{};
+    const bool isDropped = didSend && (recv(clientSocket, &response, sizeof(response), 0) == 0);
+
+    close(clientSocket);
+    return isDropped;
+}
+
+// Passes a single descriptor instead of stdout and stderr and returns whether the server closed the
+// connection after rejecting it.
+static auto IsMalformedFileDescriptorMessageDropped(const std::filesystem::path& socketPath)
+    -> bool
+{
+    const auto address = CreateSocketAddress(socketPath);
+    const auto clientSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (connect(clientSocket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == -1)
+    {
+        close(clientSocket);
+        return false;
+    }
+
+    const int fileDescriptor = STDOUT_FILENO;
+    char payload{};
+    iovec payloadVector{ &payload, sizeof(payload) };
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(fileDescriptor))]{};
+
+    msghdr message{};
+    message.msg_iov = &payloadVector;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+
+    auto* const controlMessage = CMSG_FIRSTHDR(&message);
+    controlMessage->cmsg_level = SOL_SOCKET;
+    controlMessage->cmsg_type = SCM_RIGHTS;
+    controlMessage->cmsg_len = CMSG_LEN(sizeof(fileDescriptor));
+    std::memcpy(CMSG_DATA(controlMessage), &fileDescriptor, sizeof(fileDescriptor));
+
+    const bool didSend = sendmsg(clientSocket, &message, 0) == sizeof(payload);
+
+    char response{};
+    const bool isDropped = didSend && (recv(clientSocket, &response, sizeof(response), 0) == 0);
+
+    close(clientSocket);
+    return isDropped;
+}
+
+static auto CountOpenFileDescriptors(const pid_t processID) -> size_t
+{
+    const auto directoryPath = std::filesystem::path{ "/proc" } / std::to_string(processID) /
+        "fd";
+
+    const std::filesystem::directory_iterator directory{ directoryPath };
+    return std::distance(begin(directory), end(directory));
+}
+
+// Connects with stdout pointed at a temporary file and returns the exit code of the compilation
+// together with what the server printed to the forwarded stdout.
+static auto ConnectCapturingStdout(
+    const std::filesystem::path& socketPath,
+    const std::vector<std::string_view>& args
+) -> std::optional<std::pair<int, std::string>>
+{
+    const auto outputPath = std::filesystem::temp_directory_path() /
+        ("ace_compile_server_tests_" + std::to_string(getpid()) + ".out");
+
+    std::cout.flush();
+    const auto savedStdout = dup(STDOUT_FILENO);
+    const auto outputFile = open(outputPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    dup2(outputFile, STDOUT_FILENO);
+    close(outputFile);
+
+    auto expExitCode = Ace::CompileServer::Connect(socketPath, args);
+
+    dup2(savedStdout, STDOUT_FILENO);
+    close(savedStdout);
+
+    std::stringstream output{};
+    output << std::ifstream{ outputPath }.rdbuf();
+    std::filesystem::remove(outputPath);
+
+    if (!expExitCode)
+    {
+        return std::nullopt;
+    }
+
+    return std::pair{ expExitCode.Unwrap(), output.str() };
+}
+
+auto main() -> int
+{
+    using namespace Ace;
+
+    const auto socketPath = std::filesystem::temp_directory_path() /
+        ("ace_compile_server_tests_" + std::to_string(getpid()) + ".sock");
+    const auto workingDirectory = std::filesystem::current_path();
+
+    // A socket file left behind by a server that is gone is replaced.
+    {
+        const auto address = CreateSocketAddress(socketPath);
+        const auto staleSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+        ACE_ASSERT(
+            bind(staleSocket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != -1
+        );
+        close(staleSocket);
+        ACE_ASSERT(std::filesystem::is_socket(socketPath));
+    }
+
+    // The server runs in its own process, so it only sees the client's environment and writes to
+    // the client's stdout when both are forwarded.
+    const auto serverID = fork();
+    ACE_ASSERT(serverID != -1);
+    if (serverID == 0)
+    {
+        CompileServer::Serve(
+            socketPath,
+            [&](const std::vector<std::string_view>& args)
+            {
+                if (std::filesystem::current_path() != workingDirectory)
+                {
+                    return 2;
+                }
+
+                if ((args.size() != 2) || (args.at(1) != "-O0"))
+                {
+                    return 3;
+                }
+
+                const auto* const value = std::getenv("ACE_COMPILE_SERVER_TESTS_VALUE");
+                std::cout << "compiled " << args.at(0) << " " << (value ? value : "") << "\n";
+                return 7;
+            }
+        );
+        _exit(1);
+    }
+
+    setenv("ACE_COMPILE_SERVER_TESTS_VALUE", "with client environment", 1);
+
+    std::optional<std::pair<int, std::string>> optResult{};
+    for (size_t i = 0; (i < 100) && !optResult.has_value(); i++)
+    {
+        optResult = ConnectCapturingStdout(socketPath, { "package.json", "-O0" });
+        if (!optResult.has_value())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds{ 10 });
+        }
+    }
+
+    ACE_ASSERT(optResult.has_value());
+    ACE_ASSERT(optResult.value().first == 7);
+    ACE_ASSERT(optResult.value().second == "compiled package.json with client environment\n");
+
+    // Only the server's user can connect to the socket.
+    {
+        using std::filesystem::perms;
+        const auto permissions = std::filesystem::status(socketPath).permissions();
+        ACE_ASSERT((permissions & (perms::group_all | perms::others_all)) == perms::none);
+    }
+
+    // Requests are served one after another on the same socket.
+    auto expSecondExitCode = CompileServer::Connect(socketPath, { "package.json" });
+    ACE_ASSERT(expSecondExitCode);
+    ACE_ASSERT(expSecondExitCode.Unwrap() == 3);
+
+    // Requests the server would have to allocate unbounded memory for are dropped, and the
+    // server keeps serving.
+    ACE_ASSERT(IsOversizedRequestDropped(socketPath));
+
+    // Descriptors passed with a rejected request are closed by the server.
+    {
+        const auto fileDescriptorCount = CountOpenFileDescriptors(serverID);
+        for (size_t i = 0; i < 16; i++)
+        {
+            ACE_ASSERT(IsMalformedFileDescriptorMessageDropped(socketPath));
+        }
+
+        ACE_ASSERT(CountOpenFileDescriptors(serverID) == fileDescriptorCount);
+    }
+
+    // A client that connects and never sends its request does not stall later requests.
+    {
+        const auto address = CreateSocketAddress(socketPath);
+        const auto idleSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+        ACE_ASSERT(
+            connect(idleSocket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) !=
+            -1
+        );
+
+        auto expExitCode = CompileServer::Connect(socketPath, { "package.json" });
+        ACE_ASSERT(expExitCode);
+        ACE_ASSERT(expExitCode.Unwrap() == 3);
+
+        close(idleSocket);
+    }
+
+    // A second server must neither take over the socket of a running server nor delete a file
+    // that is not a socket.
+    const auto compileNothing = [](const std::vector<std::string_view>& args) { return 0; };
+    ACE_ASSERT(!CompileServer::Serve(socketPath, compileNothing));
+
+    auto expThirdExitCode = CompileServer::Connect(socketPath, { "package.json", "-O0" });
+    ACE_ASSERT(expThirdExitCode);
+    ACE_ASSERT(expThirdExitCode.Unwrap() == 7);
+
+    const auto filePath = std::filesystem::temp_directory_path() /
+        ("ace_compile_server_tests_" + std::to_string(getpid()) + ".txt");
+    std::ofstream{ filePath } << "not a socket\n";
+    ACE_ASSERT(!CompileServer::Serve(filePath, compileNothing));
+    ACE_ASSERT(std::filesystem::exists(filePath));
+
+    std::filesystem::remove(filePath);
+
+    kill(serverID, SIGTERM);
+    waitpid(serverID, nullptr, 0);
+    std::filesystem::remove(socketPath);
+}
@@ -0,0 +1,81 @@
+#include <memory>
+#include <vector>
+
+#include "Assert.hpp"
+#include "ControlFlow.hpp"
+#include "Diagnostic.hpp"
+#include "Scope.hpp"
+#include "Diagnoses/InvalidControlFlowDiagnosis.hpp"
+#include "Symbols/LabelSymbol.hpp"
+
+namespace
+{
+    auto IsValid(std::vector<Ace::ControlFlowInstruction> instructions) -> bool
+    {
+        const auto diagnosed = Ace::DiagnoseInvalidControlFlow(
+            Ace::SrcLocation{},
+            Ace::ControlFlowGraph{ std::move(instructions) }
+        );
+
+        return !diagnosed.GetDiagnostics().HasErrors();
+    }
+}
+
+auto main() -> int
+{
+    using namespace Ace;
+
+    GlobalScope globalScopeOwner{ nullptr };
+    const auto globalScope = globalScopeOwner.Unwrap();
+
+    LabelSymbol loopStartLabel{ globalScope, Ident{ {}, "loop_start" } };
+    LabelSymbol loopEndLabel{ globalScope, Ident{ {}, "loop_end" } };
+    LabelSymbol elseLabel{ globalScope, Ident{ {}, "else" } };
+
+    const ControlFlowInstruction ret{ ControlFlowKind::Ret, nullptr };
+
+    // Blocks start at labels and after terminators, and jumps link to their label's block.
+    const ControlFlowGraph graph{ {
+        { ControlFlowKind::ConditionalJump, &elseLabel },
+        ret,
+        { ControlFlowKind::Label, &elseLabel },
+        ret,
+    } };
+    ACE_ASSERT(graph.GetBlocks().size() == 3);
+    ACE_ASSERT(graph.GetBlocks().at(0).SuccessorIndices.size() == 2);
+    ACE_ASSERT(graph.GetBlocks().at(0).SuccessorIndices.front() == 2);
+    ACE_ASSERT(graph.GetBlocks().at(2).SuccessorIndices.empty());
+
+    ACE_ASSERT(!IsValid({}));
+    ACE_ASSERT(IsValid({ ret }));
+
+    // Only one branch returns.
+    ACE_ASSERT(!IsValid({
+        { ControlFlowKind::ConditionalJump, &elseLabel },
+        ret,
+        { ControlFlowKind::Label, &elseLabel },
+    }));
+
+    // A loop whose only exit returns never falls off the end.
+    ACE_ASSERT(IsValid({
+        { ControlFlowKind::Label, &loopStartLabel },
+        { ControlFlowKind::ConditionalJump, &loopEndLabel },
+        { ControlFlowKind::Jump, &loopStartLabel },
+        { ControlFlowKind::Label, &loopEndLabel },
+        ret,
+    }));
+
+    // An infinite loop never falls off the end either.
+    ACE_ASSERT(IsValid({
+        { ControlFlowKind::Label, &loopStartLabel },
+        { ControlFlowKind::Jump, &loopStartLabel },
+    }));
+
+    // Code after an exit is unreachable.
+    ACE_ASSERT(IsValid({
+        { ControlFlowKind::Exit, nullptr },
+        { ControlFlowKind::Label, &loopEndLabel },
+    }));
+
+    return 0;
+}
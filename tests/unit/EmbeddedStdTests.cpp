@@ -3,7 +3,9 @@
 #include <string>
 
 #include "FileBuffer.hpp"
+#include "Lexer.hpp"
 #include "Std.hpp"
+#include "StdImage.hpp"
 
 int main()
 {
@@ -34,6 +36,35 @@ int main()
         {
             return 1;
         }
+
+        const auto optImageTokens = Ace::Std::FindImageTokens(fileBuffer.get());
+        if (!optImageTokens.has_value())
+        {
+            return 1;
+        }
+
+        auto diagnostics = Ace::DiagnosticBag::Create();
+        const auto lexedTokens = diagnostics.Collect(Ace::LexTokens(fileBuffer.get()));
+        if (optImageTokens.value().size() != lexedTokens.size())
+        {
+            return 1;
+        }
+
+        for (size_t j = 0; j < lexedTokens.size(); ++j)
+        {
+            const auto& imageToken = optImageTokens.value()[j];
+            const auto& lexedToken = lexedTokens.at(j);
+
+            const bool isSameToken =
+                (imageToken.Kind == lexedToken.Kind) &&
+                (imageToken.CharacterBeginIndex == lexedToken.CharacterBeginIndex) &&
+                (imageToken.CharacterLength == lexedToken.CharacterLength) &&
+                (imageToken.StringLength == lexedToken.StringLength);
+            if (!isSameToken)
+            {
+                return 1;
+            }
+        }
     }
 
     return 0;
@@ -0,0 +1,77 @@
+#include <string>
+#include <string_view>
+#include <filesystem>
+#include <fstream>
+
+#include "Assert.hpp"
+#include "Diagnostic.hpp"
+#include "FileBuffer.hpp"
+#include "SrcBuffer.hpp"
+#include "SrcLocation.hpp"
+
+namespace
+{
+    auto CreateLocation(const Ace::FileBuffer& fileBuffer, const size_t characterIndex)
+        -> Ace::SrcLocation
+    {
+        const auto bufferBeginIt = begin(std::string_view{ fileBuffer.GetBuffer() });
+        return {
+            &fileBuffer,
+            bufferBeginIt + characterIndex,
+            bufferBeginIt + characterIndex + 1,
+        };
+    }
+}
+
+auto main() -> int
+{
+    using namespace Ace;
+
+    const auto fileBuffer = FileBuffer::Create(
+        nullptr, "main.ace", "\nfirst\n\nthird\nlast\n", SourceOrigin::Compiler
+    );
+
+    // A trailing newline does not start a line, but leading and empty lines do.
+    ACE_ASSERT(fileBuffer->GetLineCount() == 5);
+    ACE_ASSERT(fileBuffer->GetLine(0).empty());
+    ACE_ASSERT(fileBuffer->GetLine(1) == "first");
+    ACE_ASSERT(fileBuffer->GetLine(2).empty());
+    ACE_ASSERT(fileBuffer->GetLine(3) == "third");
+    ACE_ASSERT(fileBuffer->GetLine(4) == "last");
+
+    ACE_ASSERT(fileBuffer->FormatLocation(fileBuffer->CreateFirstLocation()) == "main.ace:1:1");
+    ACE_ASSERT(fileBuffer->FormatLocation(CreateLocation(*fileBuffer, 3)) == "main.ace:2:3");
+    ACE_ASSERT(fileBuffer->FormatLocation(CreateLocation(*fileBuffer, 12)) == "main.ace:4:5");
+
+    // Lookups outside the previously found line fall back to the binary search.
+    ACE_ASSERT(fileBuffer->FormatLocation(CreateLocation(*fileBuffer, 16)) == "main.ace:5:3");
+    ACE_ASSERT(fileBuffer->FormatLocation(CreateLocation(*fileBuffer, 1)) == "main.ace:2:1");
+    ACE_ASSERT(fileBuffer->FormatLocation(CreateLocation(*fileBuffer, 1)) == "main.ace:2:1");
+
+    // A newline belongs to the line it ends.
+    const auto& srcBuffer = static_cast<const ISrcBuffer&>(*fileBuffer);
+    const auto newlineIt = CreateLocation(*fileBuffer, 6).CharacterBeginIterator;
+    ACE_ASSERT(srcBuffer.FindLine(newlineIt) == "first");
+
+    const auto noTrailingNewlineBuffer =
+        FileBuffer::Create(nullptr, "other.ace", "a\nbc", SourceOrigin::Compiler);
+    ACE_ASSERT(noTrailingNewlineBuffer->GetLineCount() == 2);
+    ACE_ASSERT(noTrailingNewlineBuffer->GetLine(1) == "bc");
+
+    // Read files end with a newline even if the file does not.
+    const auto path = std::filesystem::temp_directory_path() / "ace_file_buffer_tests.ace";
+    {
+        std::ofstream fileStream{ path };
+        fileStream << "first\nsecond";
+    }
+
+    const auto optReadBuffer = DiagnosticBag::Create().Collect(FileBuffer::Read(nullptr, path));
+    std::filesystem::remove(path);
+
+    ACE_ASSERT(optReadBuffer.has_value());
+    ACE_ASSERT(optReadBuffer.value()->GetBuffer() == "first\nsecond\n");
+    ACE_ASSERT(optReadBuffer.value()->GetLineCount() == 2);
+    ACE_ASSERT(optReadBuffer.value()->GetLine(1) == "second");
+
+    return 0;
+}
@@ -0,0 +1,63 @@
+#include <memory>
+#include <vector>
+#include <optional>
+
+#include "Assert.hpp"
+#include "Diagnostic.hpp"
+#include "Scope.hpp"
+#include "GenericInstanceKey.hpp"
+#include "GenericInstantiator.hpp"
+#include "Symbols/All.hpp"
+
+namespace
+{
+    template <typename TSymbol> auto Declare(std::unique_ptr<TSymbol> symbol) -> TSymbol*
+    {
+        return Ace::DiagnosticBag::CreateNoError().Collect(
+            Ace::Scope::DeclareSymbol(std::move(symbol))
+        );
+    }
+
+    auto Name(const char* const name) -> Ace::Ident
+    {
+        return Ace::Ident{ {}, name };
+    }
+}
+
+auto main() -> int
+{
+    using namespace Ace;
+
+    GlobalScope globalScopeOwner{ nullptr };
+    const auto globalScope = globalScopeOwner.Unwrap();
+
+    auto* const argStruct = Declare(std::make_unique<StructTypeSymbol>(
+        globalScope->CreateChild(), AccessModifier::Pub, Name("Arg"), std::vector<ITypeSymbol*>{}
+    ));
+
+    const auto wrapperBody = globalScope->CreateChild();
+    auto* const typeParam =
+        Declare(std::make_unique<TypeParamTypeSymbol>(wrapperBody, Name("T"), 0));
+    auto* const wrapper = Declare(std::make_unique<StructTypeSymbol>(
+        wrapperBody, AccessModifier::Pub, Name("Wrapper"), std::vector<ITypeSymbol*>{ typeParam }
+    ));
+
+    // Keys compare and hash by root, type args and self type.
+    const auto wrapperKey = CreateGenericInstanceKey(wrapper, { typeParam }, std::nullopt);
+    const auto argKey = CreateGenericInstanceKey(wrapper, { argStruct }, std::nullopt);
+    ACE_ASSERT(wrapperKey.has_value());
+    ACE_ASSERT(argKey.has_value());
+    ACE_ASSERT(wrapperKey == CreateGenericInstanceKey(wrapper, { typeParam }, argStruct));
+    ACE_ASSERT(!(wrapperKey.value() == argKey.value()));
+    ACE_ASSERT(
+        GenericInstanceKeyHash{}(wrapperKey.value()) ==
+        GenericInstanceKeyHash{}(CreateGenericInstanceKey(wrapper, { typeParam }, {}).value())
+    );
+
+    // A root is found as the instance for its own type params, other type args are not found.
+    ACE_ASSERT(GenericInstantiator::FindInstance(wrapper, { typeParam }, std::nullopt) == wrapper);
+    ACE_ASSERT(!GenericInstantiator::FindInstance(wrapper, { argStruct }, {}).has_value());
+    ACE_ASSERT(GenericInstantiator::FindInstance(argStruct, {}, std::nullopt) == argStruct);
+
+    return 0;
+}
@@ -0,0 +1,70 @@
+#include <memory>
+#include <vector>
+
+#include "Assert.hpp"
+#include "Diagnostic.hpp"
+#include "Scope.hpp"
+#include "InherentImplIndex.hpp"
+#include "Symbols/All.hpp"
+
+namespace
+{
+    template <typename TSymbol> auto Declare(std::unique_ptr<TSymbol> symbol) -> TSymbol*
+    {
+        return Ace::DiagnosticBag::CreateNoError().Collect(
+            Ace::Scope::DeclareSymbol(std::move(symbol))
+        );
+    }
+
+    auto Name(const char* const name) -> Ace::Ident
+    {
+        return Ace::Ident{ {}, name };
+    }
+
+    auto DeclareStruct(const std::shared_ptr<Ace::Scope>& scope, const char* const name)
+        -> Ace::StructTypeSymbol*
+    {
+        return Declare(std::make_unique<Ace::StructTypeSymbol>(
+            scope->CreateChild(),
+            Ace::AccessModifier::Pub,
+            Name(name),
+            std::vector<Ace::ITypeSymbol*>{}
+        ));
+    }
+}
+
+auto main() -> int
+{
+    using namespace Ace;
+
+    GlobalScope globalScopeOwner{ nullptr };
+    const auto globalScope = globalScopeOwner.Unwrap();
+
+    auto* const implementedStruct = DeclareStruct(globalScope, "Implemented");
+    auto* const otherStruct = DeclareStruct(globalScope, "Other");
+
+    auto* const firstImpl = Declare(std::make_unique<InherentImplSymbol>(
+        SrcLocation{}, globalScope->CreateChild(), implementedStruct
+    ));
+    auto* const secondImpl = Declare(std::make_unique<InherentImplSymbol>(
+        SrcLocation{}, globalScope->CreateChild(), implementedStruct
+    ));
+
+    const auto& index = globalScope->GetInherentImplIndex();
+    ACE_ASSERT(&index == &implementedStruct->GetBodyScope()->GetInherentImplIndex());
+
+    // Impls are only candidates for their own type, in declaration order.
+    const auto candidates = index.CollectCandidates(implementedStruct);
+    ACE_ASSERT(candidates.size() == 2);
+    ACE_ASSERT(candidates.at(0) == firstImpl);
+    ACE_ASSERT(candidates.at(1) == secondImpl);
+    ACE_ASSERT(index.CollectCandidates(otherStruct).empty());
+
+    // Removing an impl removes it from the index.
+    Scope::RemoveSymbol(firstImpl);
+    const auto remainingCandidates = index.CollectCandidates(implementedStruct);
+    ACE_ASSERT(remainingCandidates.size() == 1);
+    ACE_ASSERT(remainingCandidates.front() == secondImpl);
+
+    return 0;
+}
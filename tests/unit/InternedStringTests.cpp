@@ -0,0 +1,69 @@
+#include <vector>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#include "Assert.hpp"
+#include "InternedString.hpp"
+
+auto main() -> int
+{
+    using namespace Ace;
+
+    const InternedString empty{};
+    ACE_ASSERT(empty.GetString().empty());
+    ACE_ASSERT(empty == InternedString{ "" });
+
+    const InternedString lhs{ "value" };
+    const InternedString rhs{ std::string{ "val" } + "ue" };
+    ACE_ASSERT(lhs == rhs);
+    ACE_ASSERT(lhs.GetID() == rhs.GetID());
+    ACE_ASSERT(&lhs.GetString() == &rhs.GetString());
+    ACE_ASSERT(lhs == "value");
+    ACE_ASSERT(lhs == std::string{ "value" });
+    ACE_ASSERT(!(lhs == InternedString{ "other" }));
+    ACE_ASSERT(("`" + lhs + "`") == "`value`");
+
+    std::unordered_map<InternedString, int> map{};
+    map[lhs] = 1;
+    ACE_ASSERT(map.at(InternedString{ "value" }) == 1);
+    ACE_ASSERT(!map.contains(InternedString{ "missing" }));
+
+    // Threads interning the same strings concurrently must agree on every handle.
+    constexpr size_t threadCount = 4;
+    constexpr size_t stringCount = 1000;
+
+    std::vector<std::vector<uint32_t>> threadIDs(threadCount);
+    std::vector<std::thread> threads{};
+    for (size_t i = 0; i < threadCount; i++)
+    {
+        threads.emplace_back(
+            [&, i]()
+            {
+                for (size_t j = 0; j < stringCount; j++)
+                {
+                    threadIDs.at(i).push_back(
+                        InternedString{ "name_" + std::to_string(j) }.GetID()
+                    );
+                }
+            }
+        );
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (size_t i = 1; i < threadCount; i++)
+    {
+        ACE_ASSERT(threadIDs.at(i) == threadIDs.front());
+    }
+
+    // After a reset, strings get the IDs a fresh process would give them.
+    ResetInternedStrings();
+    ACE_ASSERT(InternedString{}.GetString().empty());
+    ACE_ASSERT(InternedString{ "after_reset" }.GetID() == 1);
+    ACE_ASSERT(InternedString{ "after_reset" }.GetString() == "after_reset");
+    ACE_ASSERT(InternedString{ "value" }.GetID() == 2);
+}
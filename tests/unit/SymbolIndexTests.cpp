@@ -0,0 +1,145 @@
+#include <memory>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <span>
+#include <thread>
+
+#include "Assert.hpp"
+#include "Diagnostic.hpp"
+#include "Scope.hpp"
+#include "Symbols/All.hpp"
+
+namespace
+{
+    template <typename TSymbol> auto Declare(std::unique_ptr<TSymbol> symbol) -> TSymbol*
+    {
+        return Ace::DiagnosticBag::CreateNoError().Collect(
+            Ace::Scope::DeclareSymbol(std::move(symbol))
+        );
+    }
+
+    auto Name(const char* const name) -> Ace::Ident
+    {
+        return Ace::Ident{ {}, name };
+    }
+
+    template <typename TSymbol>
+    auto Contains(const std::span<TSymbol* const> symbols, TSymbol* const symbol) -> bool
+    {
+        return std::find(begin(symbols), end(symbols), symbol) != end(symbols);
+    }
+}
+
+auto main() -> int
+{
+    using namespace Ace;
+
+    GlobalScope globalScopeOwner{ nullptr };
+    const auto globalScope = globalScopeOwner.Unwrap();
+
+    const auto body = globalScope->CreateChild();
+    auto* const firstTypeParam =
+        Declare(std::make_unique<TypeParamTypeSymbol>(body, Name("T"), 0));
+    auto* const param =
+        Declare(std::make_unique<NormalParamVarSymbol>(body, Name("value"), firstTypeParam, 0));
+
+    // An index built after symbols were declared contains them in declaration order.
+    const auto typeParams = body->CollectSymbols<TypeParamTypeSymbol>();
+    ACE_ASSERT(typeParams.size() == 1);
+    ACE_ASSERT(typeParams.front() == firstTypeParam);
+    ACE_ASSERT(body->CollectSymbols<NormalParamVarSymbol>().size() == 1);
+    ACE_ASSERT(body->CollectSymbols<FieldVarSymbol>().empty());
+
+    // Indices that already exist are updated by later declarations, including interface indices.
+    auto* const secondTypeParam =
+        Declare(std::make_unique<TypeParamTypeSymbol>(body, Name("U"), 1));
+    const auto updatedTypeParams = body->CollectSymbols<TypeParamTypeSymbol>();
+    ACE_ASSERT(updatedTypeParams.size() == 2);
+    ACE_ASSERT(updatedTypeParams.back() == secondTypeParam);
+
+    const auto typeSymbols = body->CollectSymbols<ITypeSymbol>();
+    ACE_ASSERT(typeSymbols.size() == 2);
+    ACE_ASSERT(Contains<ITypeSymbol>(typeSymbols, secondTypeParam));
+    ACE_ASSERT(!Contains<ITypeSymbol>(typeSymbols, nullptr));
+
+    // All symbols are collected in declaration order, not in name order.
+    const auto allSymbols = body->CollectAllSymbols();
+    ACE_ASSERT((allSymbols == std::vector<ISymbol*>{ firstTypeParam, param, secondTypeParam }));
+
+    const auto orderedBody = globalScope->CreateChild();
+    auto* const laterName =
+        Declare(std::make_unique<TypeParamTypeSymbol>(orderedBody, Name("Z"), 0));
+    auto* const earlierName =
+        Declare(std::make_unique<TypeParamTypeSymbol>(orderedBody, Name("A"), 1));
+    auto* const reusedName =
+        Declare(std::make_unique<TypeParamTypeSymbol>(orderedBody, Name("T"), 2));
+    ACE_ASSERT((
+        orderedBody->CollectAllSymbols() ==
+        std::vector<ISymbol*>{ laterName, earlierName, reusedName }
+    ));
+
+    // Removing a symbol removes it from every index.
+    Scope::RemoveSymbol(firstTypeParam);
+    const auto remainingTypeParams = body->CollectSymbols<TypeParamTypeSymbol>();
+    ACE_ASSERT(remainingTypeParams.size() == 1);
+    ACE_ASSERT(remainingTypeParams.front() == secondTypeParam);
+    ACE_ASSERT(body->CollectSymbols<ITypeSymbol>().size() == 1);
+    ACE_ASSERT(body->CollectAllSymbols().size() == 2);
+
+    // Recursive collection gathers symbols from child scopes.
+    const auto childBody = body->CreateChild();
+    auto* const childTypeParam =
+        Declare(std::make_unique<TypeParamTypeSymbol>(childBody, Name("V"), 0));
+    const auto recursiveTypeParams = body->CollectSymbolsRecursive<TypeParamTypeSymbol>();
+    ACE_ASSERT(recursiveTypeParams.size() == 2);
+    ACE_ASSERT(recursiveTypeParams.back() == childTypeParam);
+
+    // Declaring while looping over collected symbols is safe on a copy of the span.
+    const auto declaringBody = globalScope->CreateChild();
+    Declare(std::make_unique<TypeParamTypeSymbol>(declaringBody, Name("A"), 0));
+    const auto declaredTypeParams = declaringBody->CollectSymbols<TypeParamTypeSymbol>();
+    const std::vector<TypeParamTypeSymbol*> typeParamsCopy{
+        begin(declaredTypeParams),
+        end(declaredTypeParams),
+    };
+    for (auto* const typeParam : typeParamsCopy)
+    {
+        for (size_t i = 0; i < 64; i++)
+        {
+            const Ident name{ {}, "B" + std::to_string(i) };
+            Declare(std::make_unique<TypeParamTypeSymbol>(declaringBody, name, i + 1));
+        }
+
+        ACE_ASSERT(typeParam->GetName().String.GetString() == "A");
+    }
+    ACE_ASSERT(declaringBody->CollectSymbols<TypeParamTypeSymbol>().size() == 65);
+
+    // Threads querying a type for the first time concurrently build its index once.
+    constexpr size_t threadCount = 4;
+
+    std::vector<size_t> typeSymbolCounts(threadCount);
+    std::vector<std::thread> threads{};
+    for (size_t i = 0; i < threadCount; i++)
+    {
+        threads.emplace_back(
+            [&, i]()
+            {
+                typeSymbolCounts.at(i) = declaringBody->CollectSymbols<ITypeSymbol>().size();
+                declaringBody->CollectSymbols<NormalParamVarSymbol>();
+            }
+        );
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (const auto typeSymbolCount : typeSymbolCounts)
+    {
+        ACE_ASSERT(typeSymbolCount == 65);
+    }
+
+    return 0;
+}
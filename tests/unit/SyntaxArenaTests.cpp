@@ -0,0 +1,92 @@
+#include <memory>
+#include <vector>
+#include <span>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+#include "Assert.hpp"
+#include "SyntaxArena.hpp"
+
+namespace
+{
+    std::vector<size_t> DestroyedNodeValues{};
+
+    struct alignas(16) Node
+    {
+        Node(const size_t value, const std::span<const Node* const> children)
+            : Value{ value },
+              Children{ children }
+        {
+        }
+
+        ~Node()
+        {
+            DestroyedNodeValues.push_back(Value);
+        }
+
+        size_t Value{};
+        std::span<const Node* const> Children{};
+    };
+
+    struct TrivialNode
+    {
+        size_t Value{};
+    };
+}
+
+auto main() -> int
+{
+    using namespace Ace;
+
+    {
+        SyntaxArena arena{};
+        ACE_ASSERT(arena.GetByteSize() == 0);
+
+        // Child lists built in vectors are copied into the arena when a node is created.
+        std::vector<const Node*> leaves{};
+        for (size_t i = 0; i < 10000; i++)
+        {
+            leaves.push_back(arena.Create<Node>(i, std::vector<const Node*>{}));
+        }
+
+        const auto* const root = arena.Create<Node>(10000, leaves);
+        leaves.clear();
+        leaves.shrink_to_fit();
+
+        ACE_ASSERT(root->Children.size() == 10000);
+        for (size_t i = 0; i < root->Children.size(); i++)
+        {
+            const auto* const leaf = root->Children[i];
+            ACE_ASSERT(leaf->Value == i);
+            ACE_ASSERT(leaf->Children.empty());
+            ACE_ASSERT((reinterpret_cast<uintptr_t>(leaf) % alignof(Node)) == 0);
+        }
+
+        const auto strings = arena.CreateSpan(std::vector<std::string>(3, std::string(64, 'a')));
+        ACE_ASSERT(strings.size() == 3);
+        ACE_ASSERT(strings.back() == std::string(64, 'a'));
+
+        ACE_ASSERT(arena.GetByteSize() >= (10001 * sizeof(Node)));
+
+        // Nodes stay alive until the arena is destroyed.
+        ACE_ASSERT(DestroyedNodeValues.empty());
+
+        const auto byteSize = arena.GetByteSize();
+        auto* const small = arena.Create<TrivialNode>(TrivialNode{ 1 });
+        auto* const large = arena.Allocate(1024 * 1024, alignof(std::max_align_t));
+        ACE_ASSERT(arena.GetByteSize() >= (byteSize + (1024 * 1024)));
+
+        // A large allocation does not retire the current block.
+        auto* const nextSmall = arena.Create<TrivialNode>(TrivialNode{ 2 });
+        ACE_ASSERT(nextSmall == (small + 1));
+        ACE_ASSERT(large != small);
+    }
+
+    // The arena destroys its nodes in reverse order of creation.
+    ACE_ASSERT(DestroyedNodeValues.size() == 10001);
+    ACE_ASSERT(DestroyedNodeValues.front() == 10000);
+    ACE_ASSERT(DestroyedNodeValues.back() == 0);
+
+    return 0;
+}
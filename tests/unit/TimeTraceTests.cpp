@@ -0,0 +1,97 @@
+#include <cstddef>
+#include <string>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <nlohmann/json.hpp>
+
+#include "Assert.hpp"
+#include "TimeTrace.hpp"
+
+auto main() -> int
+{
+    using namespace Ace;
+
+    const auto traceFilePath =
+        std::filesystem::temp_directory_path() / "ace_time_trace_tests.json";
+
+    {
+        TimeTracer disabledTracer{ false, std::nullopt };
+        ACE_ASSERT(!disabledTracer.IsEnabled());
+        ACE_ASSERT(!disabledTracer.IsTracingFunctions());
+
+        bool didCreateDetail = false;
+        {
+            const TimeScope phaseTimeScope{ &disabledTracer, "Phase" };
+            const TimeScope functionTimeScope{
+                &disabledTracer,
+                "Function",
+                [&]()
+                {
+                    didCreateDetail = true;
+                    return std::string{ "f" };
+                },
+            };
+        }
+
+        ACE_ASSERT(!didCreateDetail);
+        ACE_ASSERT(disabledTracer.WriteTraceFile());
+    }
+
+    {
+        bool didCreateDetail = false;
+        {
+            const TimeScope phaseTimeScope{ nullptr, "Phase" };
+            const TimeScope functionTimeScope{
+                nullptr,
+                "Function",
+                [&]()
+                {
+                    didCreateDetail = true;
+                    return std::string{ "f" };
+                },
+            };
+        }
+
+        ACE_ASSERT(!didCreateDetail);
+    }
+
+    {
+        TimeTracer tracer{ false, traceFilePath };
+        ACE_ASSERT(tracer.IsEnabled());
+        ACE_ASSERT(tracer.IsTracingFunctions());
+
+        {
+            const TimeScope outerTimeScope{ &tracer, "Outer" };
+            const TimeScope innerTimeScope{ &tracer, "Inner" };
+            const TimeScope functionTimeScope{
+                &tracer,
+                "Function",
+                []() { return std::string{ "pkg::f" }; },
+            };
+        }
+
+        ACE_ASSERT(tracer.WriteTraceFile());
+    }
+
+    std::ifstream traceFileStream{ traceFilePath };
+    ACE_ASSERT(traceFileStream);
+
+    std::stringstream traceStringStream{};
+    traceStringStream << traceFileStream.rdbuf();
+
+    const auto trace = nlohmann::json::parse(traceStringStream.str());
+    const auto& traceEvents = trace["traceEvents"];
+    ACE_ASSERT(traceEvents.size() == 3);
+
+    // Scopes are recorded when they end, so the innermost span comes first.
+    ACE_ASSERT(std::string(traceEvents.at(0)["name"]) == "Function");
+    ACE_ASSERT(std::string(traceEvents.at(0)["cat"]) == "function");
+    ACE_ASSERT(std::string(traceEvents.at(0)["args"]["detail"]) == "pkg::f");
+    ACE_ASSERT(std::string(traceEvents.at(1)["name"]) == "Inner");
+    ACE_ASSERT(std::string(traceEvents.at(1)["cat"]) == "phase");
+    ACE_ASSERT(std::string(traceEvents.at(2)["name"]) == "Outer");
+    ACE_ASSERT(std::string(traceEvents.at(2)["ph"]) == "X");
+
+    std::filesystem::remove(traceFilePath);
+}
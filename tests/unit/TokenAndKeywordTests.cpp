@@ -1,47 +1,52 @@
 #include <cstddef>
+#include <string_view>
 
 #include "Assert.hpp"
 #include "DiagnosticStringConversions.hpp"
 #include "Keyword.hpp"
 #include "TokenKind.hpp"
 
-namespace
-{
-    auto IsKeywordTokenKind(const Ace::TokenKind tokenKind) -> bool
-    {
-        return (tokenKind >= Ace::TokenKind::AddressOfKeyword) &&
-               (tokenKind <= Ace::TokenKind::VoidKeyword);
-    }
-}
-
 auto main() -> int
 {
     using namespace Ace;
 
+    size_t keywordCount = 0;
     for (size_t index = 0; index < static_cast<size_t>(TokenKind::Count); ++index)
     {
         const auto tokenKind = static_cast<TokenKind>(index);
         ACE_ASSERT(!CreateTokenKindString(tokenKind).empty());
 
-        const bool isKeyword = IsKeywordTokenKind(tokenKind);
-        ACE_ASSERT(TokenKindToKeywordMap.contains(tokenKind) == isKeyword);
-    }
+        const bool isKeyword =
+            (tokenKind >= TokenKind::AddressOfKeyword) && (tokenKind <= TokenKind::VoidKeyword);
+        ACE_ASSERT(IsKeywordTokenKind(tokenKind) == isKeyword);
+        if (!isKeyword)
+        {
+            continue;
+        }
 
-    ACE_ASSERT(KeywordToTokenKindMap.size() == TokenKindToKeywordMap.size());
+        keywordCount++;
 
-    for (const auto& [keyword, tokenKind] : KeywordToTokenKindMap)
-    {
-        const auto tokenKindIt = TokenKindToKeywordMap.find(tokenKind);
-        ACE_ASSERT(tokenKindIt != end(TokenKindToKeywordMap));
-        ACE_ASSERT(tokenKindIt->second == keyword);
-    }
+        const auto keyword = GetKeyword(tokenKind);
+        ACE_ASSERT(!keyword.empty());
 
-    for (const auto& [tokenKind, keyword] : TokenKindToKeywordMap)
-    {
-        ACE_ASSERT(IsKeywordTokenKind(tokenKind));
+        const auto optKeywordTokenKind = FindKeywordTokenKind(keyword);
+        ACE_ASSERT(optKeywordTokenKind.has_value());
+        ACE_ASSERT(optKeywordTokenKind.value() == tokenKind);
 
-        const auto keywordIt = KeywordToTokenKindMap.find(keyword);
-        ACE_ASSERT(keywordIt != end(KeywordToTokenKindMap));
-        ACE_ASSERT(keywordIt->second == tokenKind);
+        const std::string_view keywordPrefix = keyword.substr(0, keyword.size() - 1);
+        ACE_ASSERT(!FindKeywordTokenKind(keywordPrefix).has_value());
     }
+
+    ACE_ASSERT(keywordCount == 45);
+
+    ACE_ASSERT(FindKeywordTokenKind("u8").value() == TokenKind::UInt8Keyword);
+    ACE_ASSERT(FindKeywordTokenKind("Self").value() == TokenKind::UpperSelfKeyword);
+    ACE_ASSERT(FindKeywordTokenKind("self").value() == TokenKind::LowerSelfKeyword);
+
+    ACE_ASSERT(!FindKeywordTokenKind("").has_value());
+    ACE_ASSERT(!FindKeywordTokenKind("u128").has_value());
+    ACE_ASSERT(!FindKeywordTokenKind("elsif").has_value());
+    ACE_ASSERT(!FindKeywordTokenKind("While").has_value());
+    ACE_ASSERT(!FindKeywordTokenKind("selfish").has_value());
+    ACE_ASSERT(!FindKeywordTokenKind("__type_info_ptr_").has_value());
 }
@@ -0,0 +1,194 @@
+#include <string>
+#include <vector>
+#include <span>
+#include <thread>
+
+#include "Assert.hpp"
+#include "Diagnostic.hpp"
+#include "FileBuffer.hpp"
+#include "Lexer.hpp"
+#include "Token.hpp"
+#include "TokenCursor.hpp"
+#include "TokenQueue.hpp"
+#include "TokenKind.hpp"
+
+namespace
+{
+    auto IsSameToken(const Ace::Token& lhs, const Ace::Token& rhs) -> bool
+    {
+        return (lhs.Kind == rhs.Kind) && (lhs.CharacterBeginIndex == rhs.CharacterBeginIndex) &&
+               (lhs.CharacterLength == rhs.CharacterLength) &&
+               (lhs.StringLength == rhs.StringLength);
+    }
+
+    // Walks the cursor to the end, peeking as far ahead as its buffer holds at every token.
+    auto CheckCursor(Ace::TokenCursor& cursor, const std::vector<Ace::Token>& tokens) -> void
+    {
+        using namespace Ace;
+
+        const auto capacity = cursor.GetCapacity();
+        for (size_t i = 0; i < (tokens.size() - 1); i++)
+        {
+            ACE_ASSERT(!cursor.IsEnd());
+
+            const auto lastIndex = std::min(i + capacity - 1, tokens.size() - 1);
+            ACE_ASSERT(IsSameToken(cursor.Peek(lastIndex - i), tokens.at(lastIndex)));
+            ACE_ASSERT(IsSameToken(cursor.Eat(), tokens.at(i)));
+        }
+
+        ACE_ASSERT(cursor.GetCapacity() == capacity);
+        ACE_ASSERT(cursor.IsEnd());
+        ACE_ASSERT(cursor.Peek().Kind == TokenKind::EndOfFile);
+        ACE_ASSERT(cursor.Peek(capacity - 1).Kind == TokenKind::EndOfFile);
+    }
+
+    // Peeks beyond the initial buffer partway through the file, then walks the rest of it.
+    auto CheckGrowingCursor(Ace::TokenCursor& cursor, const std::vector<Ace::Token>& tokens)
+        -> void
+    {
+        using namespace Ace;
+
+        const size_t eatenCount = 100;
+        for (size_t i = 0; i < eatenCount; i++)
+        {
+            ACE_ASSERT(IsSameToken(cursor.Eat(), tokens.at(i)));
+        }
+
+        const auto distance = 3 * TokenCursor::InitialCapacity;
+        ACE_ASSERT(IsSameToken(cursor.Peek(distance), tokens.at(eatenCount + distance)));
+        ACE_ASSERT(cursor.GetCapacity() > distance);
+
+        for (size_t i = eatenCount; i < (tokens.size() - 1); i++)
+        {
+            ACE_ASSERT(IsSameToken(cursor.Peek(), tokens.at(i)));
+            ACE_ASSERT(IsSameToken(cursor.Eat(), tokens.at(i)));
+        }
+
+        ACE_ASSERT(cursor.IsEnd());
+        ACE_ASSERT(cursor.Peek(8 * TokenCursor::InitialCapacity).Kind == TokenKind::EndOfFile);
+    }
+
+    // Scans further ahead than the buffer can hold, as a speculative scan over a very long header
+    // does, then starts a new scan behind the last one.
+    auto CheckScanningCursor(Ace::TokenCursor& cursor, const std::vector<Ace::Token>& tokens)
+        -> void
+    {
+        using namespace Ace;
+
+        const size_t eatenCount = 10;
+        for (size_t i = 0; i < eatenCount; i++)
+        {
+            ACE_ASSERT(IsSameToken(cursor.Eat(), tokens.at(i)));
+        }
+
+        for (size_t distance = 0; distance < (tokens.size() + 10); distance++)
+        {
+            const auto index = std::min(eatenCount + distance, tokens.size() - 1);
+            ACE_ASSERT(cursor.PeekKind(distance) == tokens.at(index).Kind);
+        }
+
+        ACE_ASSERT(cursor.GetCapacity() == TokenCursor::MaxCapacity);
+
+        ACE_ASSERT(IsSameToken(cursor.Eat(), tokens.at(eatenCount)));
+
+        const auto distance = TokenCursor::MaxCapacity + 7;
+        const auto index = eatenCount + 1 + distance;
+        ACE_ASSERT(cursor.PeekKind(distance) == tokens.at(index).Kind);
+        ACE_ASSERT(cursor.PeekKind(distance + 1) == tokens.at(index + 1).Kind);
+
+        for (size_t i = eatenCount + 1; i < (tokens.size() - 1); i++)
+        {
+            ACE_ASSERT(IsSameToken(cursor.Eat(), tokens.at(i)));
+        }
+
+        ACE_ASSERT(cursor.IsEnd());
+        ACE_ASSERT(cursor.GetCapacity() == TokenCursor::MaxCapacity);
+    }
+}
+
+auto main() -> int
+{
+    using namespace Ace;
+
+    std::string source{};
+    for (size_t i = 0; i < 200; i++)
+    {
+        source += "value_" + std::to_string(i) + ": i32 = " + std::to_string(i) + "i32; # end\n";
+    }
+
+    const auto fileBuffer = FileBuffer::Create(nullptr, "main.ace", source, SourceOrigin::User);
+
+    auto diagnostics = DiagnosticBag::Create();
+    const auto tokens = diagnostics.Collect(LexTokens(fileBuffer.get()));
+    ACE_ASSERT(!diagnostics.HasErrors());
+    ACE_ASSERT(tokens.size() > (4 * TokenCursor::InitialCapacity));
+    ACE_ASSERT(tokens.back().Kind == TokenKind::EndOfFile);
+
+    TokenCursor lexingCursor{ fileBuffer.get() };
+    CheckCursor(lexingCursor, tokens);
+    ACE_ASSERT(!lexingCursor.TakeDiagnostics().HasErrors());
+
+    TokenCursor preLexedCursor{ fileBuffer.get(), std::span<const Token>{ tokens } };
+    CheckCursor(preLexedCursor, tokens);
+
+    // Speculative scans may look further ahead than the initial buffer holds.
+    TokenCursor growingLexingCursor{ fileBuffer.get() };
+    CheckGrowingCursor(growingLexingCursor, tokens);
+    ACE_ASSERT(!growingLexingCursor.TakeDiagnostics().HasErrors());
+
+    TokenCursor growingPreLexedCursor{ fileBuffer.get(), std::span<const Token>{ tokens } };
+    CheckGrowingCursor(growingPreLexedCursor, tokens);
+
+    // Scans past the largest buffer lex ahead without growing it.
+    std::string longSource{};
+    for (size_t i = 0; i < 3000; i++)
+    {
+        longSource += "value_" + std::to_string(i) + ": i32;\n";
+    }
+
+    const auto longFileBuffer =
+        FileBuffer::Create(nullptr, "long.ace", longSource, SourceOrigin::User);
+    const auto longTokens = diagnostics.Collect(LexTokens(longFileBuffer.get()));
+    ACE_ASSERT(longTokens.size() > (2 * TokenCursor::MaxCapacity));
+
+    TokenCursor scanningLexingCursor{ longFileBuffer.get() };
+    CheckScanningCursor(scanningLexingCursor, longTokens);
+    ACE_ASSERT(!scanningLexingCursor.TakeDiagnostics().HasErrors());
+
+    TokenCursor scanningPreLexedCursor{
+        longFileBuffer.get(),
+        std::span<const Token>{ longTokens },
+    };
+    CheckScanningCursor(scanningPreLexedCursor, longTokens);
+
+    // Cursors over a queue that another thread lexes into read the same tokens, also when a scan
+    // looks past the buffer.
+    TokenQueue queue{ fileBuffer.get() };
+    std::thread lexingThread{ [&]() { queue.Fill(); } };
+    TokenCursor queuedCursor{ &queue };
+    CheckCursor(queuedCursor, tokens);
+    ACE_ASSERT(!queuedCursor.TakeDiagnostics().HasErrors());
+    lexingThread.join();
+
+    TokenQueue longQueue{ longFileBuffer.get() };
+    std::thread longLexingThread{ [&]() { longQueue.Fill(); } };
+    TokenCursor scanningQueuedCursor{ &longQueue };
+    CheckScanningCursor(scanningQueuedCursor, longTokens);
+    ACE_ASSERT(!scanningQueuedCursor.TakeDiagnostics().HasErrors());
+    longLexingThread.join();
+
+    // Lexing diagnostics cover the whole file, even past the tokens that were read.
+    const auto invalidBuffer = FileBuffer::Create(
+        nullptr, "invalid.ace", source + "\"unterminated\n", SourceOrigin::User
+    );
+    TokenCursor invalidCursor{ invalidBuffer.get() };
+    invalidCursor.Eat();
+    ACE_ASSERT(invalidCursor.TakeDiagnostics().HasErrors());
+
+    TokenQueue invalidQueue{ invalidBuffer.get() };
+    std::thread invalidLexingThread{ [&]() { invalidQueue.Fill(); } };
+    TokenCursor invalidQueuedCursor{ &invalidQueue };
+    invalidQueuedCursor.Eat();
+    ACE_ASSERT(invalidQueuedCursor.TakeDiagnostics().HasErrors());
+    invalidLexingThread.join();
+}
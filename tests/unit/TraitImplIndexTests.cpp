@@ -0,0 +1,97 @@
+#include <memory>
+#include <vector>
+
+#include "Assert.hpp"
+#include "Diagnostic.hpp"
+#include "Scope.hpp"
+#include "TraitImplIndex.hpp"
+#include "Symbols/All.hpp"
+
+namespace
+{
+    template <typename TSymbol> auto Declare(std::unique_ptr<TSymbol> symbol) -> TSymbol*
+    {
+        return Ace::DiagnosticBag::CreateNoError().Collect(
+            Ace::Scope::DeclareSymbol(std::move(symbol))
+        );
+    }
+
+    auto Name(const char* const name) -> Ace::Ident
+    {
+        return Ace::Ident{ {}, name };
+    }
+
+    auto DeclareStruct(const std::shared_ptr<Ace::Scope>& scope, const char* const name)
+        -> Ace::StructTypeSymbol*
+    {
+        return Declare(std::make_unique<Ace::StructTypeSymbol>(
+            scope->CreateChild(),
+            Ace::AccessModifier::Pub,
+            Name(name),
+            std::vector<Ace::ITypeSymbol*>{}
+        ));
+    }
+
+    auto DeclareTrait(const std::shared_ptr<Ace::Scope>& scope, const char* const name)
+        -> Ace::TraitTypeSymbol*
+    {
+        const auto body = scope->CreateChild();
+        return Declare(std::make_unique<Ace::TraitTypeSymbol>(
+            body,
+            body->CreateChild(),
+            Ace::AccessModifier::Pub,
+            Name(name),
+            std::vector<Ace::ITypeSymbol*>{}
+        ));
+    }
+}
+
+auto main() -> int
+{
+    using namespace Ace;
+
+    GlobalScope globalScopeOwner{ nullptr };
+    const auto globalScope = globalScopeOwner.Unwrap();
+
+    auto* const implementedStruct = DeclareStruct(globalScope, "Implemented");
+    auto* const otherStruct = DeclareStruct(globalScope, "Other");
+    auto* const trait = DeclareTrait(globalScope, "Trait");
+    auto* const blanketTrait = DeclareTrait(globalScope, "Blanket");
+
+    auto* const impl = Declare(std::make_unique<TraitImplSymbol>(
+        SrcLocation{}, globalScope->CreateChild(), trait, implementedStruct
+    ));
+
+    const auto blanketImplBody = globalScope->CreateChild();
+    auto* const blanketTypeParam =
+        Declare(std::make_unique<TypeParamTypeSymbol>(blanketImplBody, Name("T"), 0));
+    auto* const blanketImpl = Declare(std::make_unique<TraitImplSymbol>(
+        SrcLocation{}, blanketImplBody, blanketTrait, blanketTypeParam
+    ));
+
+    // Every scope shares the index of the global scope.
+    const auto& index = blanketImplBody->GetTraitImplIndex();
+    ACE_ASSERT(&index == &globalScope->GetTraitImplIndex());
+
+    // Impls for a concrete type are only candidates for that type.
+    const auto implementedCandidates = index.CollectCandidates(trait, implementedStruct);
+    ACE_ASSERT(implementedCandidates.size() == 1);
+    ACE_ASSERT(implementedCandidates.front() == impl);
+    ACE_ASSERT(index.CollectCandidates(trait, otherStruct).empty());
+
+    // Impls for a type parameter are candidates for every type.
+    const auto blanketCandidates = index.CollectCandidates(blanketTrait, otherStruct);
+    ACE_ASSERT(blanketCandidates.size() == 1);
+    ACE_ASSERT(blanketCandidates.front() == blanketImpl);
+
+    ACE_ASSERT(Scope::HasImpl(trait, implementedStruct));
+    ACE_ASSERT(!Scope::HasImpl(trait, otherStruct));
+    ACE_ASSERT(Scope::CollectImplOfFor(trait, implementedStruct) == impl);
+
+    // Removing an impl removes it from the index.
+    Scope::RemoveSymbol(impl);
+    ACE_ASSERT(index.CollectCandidates(trait, implementedStruct).empty());
+    ACE_ASSERT(!Scope::HasImpl(trait, implementedStruct));
+
+    return 0;
+}
@@ -0,0 +1,72 @@
+#include <vector>
+#include <memory>
+#include <string>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+
+#include "Diagnostic.hpp"
+#include "FileBuffer.hpp"
+#include "Lexer.hpp"
+
+// Lexes the given source files repeatedly and prints lexer throughput in MB/s.
+// Usage: ace_lex_bench [-n <iterations>] <file>...
+auto main(const int argc, const char* argv[]) -> int
+{
+    size_t iterationCount = 20;
+    std::vector<std::filesystem::path> paths{};
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string arg{ argv[i] };
+        if ((arg == "-n") && ((i + 1) < argc))
+        {
+            iterationCount = std::stoul(argv[++i]);
+            continue;
+        }
+
+        paths.emplace_back(arg);
+    }
+
+    if (paths.empty() || (iterationCount == 0))
+    {
+        std::cerr << "usage: ace_lex_bench [-n <iterations>] <file>...\n";
+        return 1;
+    }
+
+    std::vector<std::shared_ptr<const Ace::FileBuffer>> fileBuffers{};
+    size_t byteCount = 0;
+    for (const auto& path : paths)
+    {
+        auto diagnostics = Ace::DiagnosticBag::Create();
+        const auto optFileBuffer = diagnostics.Collect(Ace::FileBuffer::Read(nullptr, path));
+        if (!optFileBuffer.has_value())
+        {
+            std::cerr << "cannot read " << path.string() << "\n";
+            return 1;
+        }
+
+        byteCount += optFileBuffer.value()->GetBuffer().size();
+        fileBuffers.push_back(optFileBuffer.value());
+    }
+
+    size_t tokenCount = 0;
+    const auto beginTime = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterationCount; i++)
+    {
+        for (const auto& fileBuffer : fileBuffers)
+        {
+            auto diagnostics = Ace::DiagnosticBag::Create();
+            tokenCount += diagnostics.Collect(Ace::LexTokens(fileBuffer.get())).size();
+        }
+    }
+    const auto endTime = std::chrono::steady_clock::now();
+
+    const auto seconds = std::chrono::duration<double>(endTime - beginTime).count();
+    const auto megabytes = static_cast<double>(byteCount * iterationCount) / (1024.0 * 1024.0);
+
+    std::cout << fileBuffers.size() << " files, " << byteCount << " bytes, ";
+    std::cout << (tokenCount / iterationCount) << " tokens\n";
+    std::cout << (megabytes / seconds) << " MB/s\n";
+
+    return 0;
+}
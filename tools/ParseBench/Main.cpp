@@ -0,0 +1,126 @@
+#include <vector>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+
+#include "Diagnostic.hpp"
+#include "SrcBuffer.hpp"
+#include "FileBuffer.hpp"
+#include "Compilation.hpp"
+#include "TokenCursor.hpp"
+#include "Parser.hpp"
+#include "SyntaxArena.hpp"
+
+// One group of module-body declarations: a struct, a trait, a trait impl, a function and a
+// global, so every branch of declaration classification is taken.
+static auto CreateDeclGroup(const size_t index) -> std::string
+{
+    const auto suffix = std::to_string(index);
+
+    std::string group{};
+    group += "Struct" + suffix + ": struct {\n    value: int\n}\n\n";
+    group += "Trait" + suffix + ": trait {\n    self ::\n    get(): int;\n}\n\n";
+    group += "impl Trait" + suffix + " for Struct" + suffix + " {\n";
+    group += "    self ::\n    get(): int {\n        ret self.value;\n    }\n}\n\n";
+    group += "function" + suffix + "(a: int, b: int): int {\n    ret a + b;\n}\n\n";
+    group += "global" + suffix + ": int;\n\n";
+    return group;
+}
+
+// Parses generated modules of doubling width and prints the parse time per declaration group,
+// which stays flat when parsing scales linearly with module width, and the size of the syntax
+// arena one parse fills. Each parse gets its own arena, so the time includes freeing the tree.
+// Usage: ace_parse_bench [-n <iterations>] <package> [<compiler option>...]
+auto main(const int argc, const char* argv[]) -> int
+{
+    size_t iterationCount = 5;
+    std::vector<std::string_view> args{};
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string_view arg{ argv[i] };
+        if (args.empty() && (arg == "-n") && ((i + 1) < argc))
+        {
+            iterationCount = std::stoul(argv[++i]);
+            continue;
+        }
+
+        args.push_back(arg);
+    }
+
+    if (args.empty() || (iterationCount == 0))
+    {
+        std::cerr << "usage: ace_parse_bench [-n <iterations>] <package> [<compiler option>...]\n";
+        return 1;
+    }
+
+    std::vector<std::shared_ptr<const Ace::ISrcBuffer>> srcBuffers{};
+
+    auto diagnostics = Ace::DiagnosticBag::Create();
+    const auto optCompilation = diagnostics.Collect(Ace::Compilation::Parse(&srcBuffers, args));
+    if (!optCompilation.has_value())
+    {
+        std::cerr << "cannot create a compilation from the given package\n";
+        return 1;
+    }
+
+    auto* const compilation = optCompilation.value().get();
+    const auto& packageName = compilation->GetPackage().Name;
+
+    std::cout << std::setw(8) << "groups" << std::setw(12) << "bytes";
+    std::cout << std::setw(12) << "ms" << std::setw(16) << "us/group";
+    std::cout << std::setw(12) << "arena KiB" << "\n";
+
+    for (size_t groupCount = 1024; groupCount <= 16384; groupCount *= 2)
+    {
+        std::string source{};
+        for (size_t i = 0; i < groupCount; i++)
+        {
+            source += CreateDeclGroup(i);
+        }
+
+        const auto fileBuffer = Ace::FileBuffer::Create(
+            compilation,
+            "wide_" + std::to_string(groupCount) + ".ace",
+            source,
+            Ace::SourceOrigin::User
+        );
+
+        size_t arenaByteSize = 0;
+        const auto beginTime = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterationCount; i++)
+        {
+            Ace::SyntaxArena arena{};
+            auto parseDiagnostics = Ace::DiagnosticBag::Create();
+            const auto optAST = parseDiagnostics.Collect(Ace::ParseAST(
+                &arena,
+                packageName,
+                fileBuffer.get(),
+                Ace::TokenCursor{ fileBuffer.get() }
+            ));
+            if (!optAST.has_value() || parseDiagnostics.HasErrors())
+            {
+                std::cerr << "cannot parse the generated module\n";
+                return 1;
+            }
+
+            arenaByteSize = arena.GetByteSize();
+        }
+        const auto endTime = std::chrono::steady_clock::now();
+
+        const auto milliseconds =
+            std::chrono::duration<double, std::milli>(endTime - beginTime).count() /
+            static_cast<double>(iterationCount);
+        const auto microsecondsPerGroup =
+            (milliseconds * 1000.0) / static_cast<double>(groupCount);
+
+        std::cout << std::fixed << std::setprecision(2);
+        std::cout << std::setw(8) << groupCount << std::setw(12) << source.size();
+        std::cout << std::setw(12) << milliseconds << std::setw(16) << microsecondsPerGroup;
+        std::cout << std::setw(12) << (static_cast<double>(arenaByteSize) / 1024.0) << "\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,9 @@
+#include "StdImage.hpp"
+
+namespace Ace::Std
+{
+    auto GetImage() -> const Image*
+    {
+        return nullptr;
+    }
+}
@@ -0,0 +1,21 @@
+#include <fstream>
+
+#include "StdImage.hpp"
+
+// Writes the generated source of the std token image. This binary links `EmptyImage.cpp` in place
+// of that source, so it always lexes std itself.
+auto main(const int argc, const char* argv[]) -> int
+{
+    if (argc != 2)
+    {
+        return 1;
+    }
+
+    std::ofstream stream{ argv[1] };
+    if (!stream)
+    {
+        return 1;
+    }
+
+    return Ace::Std::WriteImageSource(stream) ? 0 : 1;
+}